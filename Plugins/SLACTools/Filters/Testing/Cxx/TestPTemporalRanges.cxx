@@ -0,0 +1,199 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPTemporalRanges.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks that vtkPTemporalRanges sharing the time steps between the processes
+// reads each time step on a single process, even when the number of time steps
+// is not a multiple of the number of processes, and that the reduced table is
+// the one computed by vtkTemporalRanges over all the time steps.
+
+#include "vtkDoubleArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPTemporalRanges.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTable.h"
+#include "vtkTemporalRanges.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+const vtkIdType NumberOfTuples = 1000;
+
+// Produces a two components array, whose values depend on the time step, on
+// the points of a polydata, and counts the time steps produced.
+class vtkTemporalFieldSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTemporalFieldSource* New();
+  vtkTypeMacro(vtkTemporalFieldSource, vtkPolyDataAlgorithm);
+
+  int NumberOfSteps = 0;
+  int NumberOfExecutions = 0;
+
+protected:
+  vtkTemporalFieldSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    std::vector<double> times(this->NumberOfSteps);
+    for (int step = 0; step < this->NumberOfSteps; ++step)
+    {
+      times[step] = step;
+    }
+    double range[2] = { 0, static_cast<double>(this->NumberOfSteps - 1) };
+    outInfo->Set(
+      vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times.data(), this->NumberOfSteps);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const int step = static_cast<int>(
+      std::floor(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) + 0.5));
+    ++this->NumberOfExecutions;
+
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(NumberOfTuples);
+    vtkNew<vtkDoubleArray> field;
+    field->SetName("field");
+    field->SetNumberOfComponents(2);
+    field->SetNumberOfTuples(NumberOfTuples);
+    for (vtkIdType tuple = 0; tuple < NumberOfTuples; ++tuple)
+    {
+      points->SetPoint(tuple, static_cast<double>(tuple), 0, 0);
+      field->SetTypedComponent(tuple, 0, static_cast<double>((tuple * 3 + step * 7) % 53) - step);
+      field->SetTypedComponent(tuple, 1,
+        (tuple + step) % 11 == 0 ? std::numeric_limits<double>::quiet_NaN()
+                                 : 0.5 * static_cast<double>(tuple % 17) * step);
+    }
+
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(field);
+    return 1;
+  }
+
+private:
+  vtkTemporalFieldSource(const vtkTemporalFieldSource&) = delete;
+  void operator=(const vtkTemporalFieldSource&) = delete;
+};
+vtkStandardNewMacro(vtkTemporalFieldSource);
+
+bool SameTables(vtkTable* table, vtkTable* reference)
+{
+  if (table->GetNumberOfColumns() != reference->GetNumberOfColumns())
+  {
+    cerr << "ERROR: wrong number of columns: " << table->GetNumberOfColumns() << endl;
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < reference->GetNumberOfColumns(); ++cc)
+  {
+    vtkDoubleArray* expected = vtkDoubleArray::SafeDownCast(reference->GetColumn(cc));
+    if (!expected)
+    {
+      continue;
+    }
+    vtkDoubleArray* column =
+      vtkDoubleArray::SafeDownCast(table->GetColumnByName(expected->GetName()));
+    if (!column || column->GetNumberOfTuples() != expected->GetNumberOfTuples())
+    {
+      cerr << "ERROR: missing column " << expected->GetName() << endl;
+      return false;
+    }
+    for (vtkIdType row = 0; row < expected->GetNumberOfTuples(); ++row)
+    {
+      const double value = expected->GetValue(row);
+      if (std::abs(column->GetValue(row) - value) > 1e-9 * std::max(1.0, std::abs(value)))
+      {
+        cerr << "ERROR: wrong value in row " << row << " of " << expected->GetName() << ": "
+             << column->GetValue(row) << ", expected " << value << endl;
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+// Accumulates the ranges of numberOfSteps time steps with the time steps
+// shared between the processes, and checks the result.
+bool TestTimeParallel(vtkMultiProcessController* controller, int numberOfSteps)
+{
+  vtkNew<vtkTemporalFieldSource> source;
+  source->NumberOfSteps = numberOfSteps;
+  vtkNew<vtkPTemporalRanges> ranges;
+  ranges->SetController(controller);
+  ranges->SetTimeParallel(true);
+  ranges->SetInputConnection(source->GetOutputPort());
+  ranges->Update();
+
+  int numberOfExecutions = 0;
+  controller->AllReduce(
+    &source->NumberOfExecutions, &numberOfExecutions, 1, vtkCommunicator::SUM_OP);
+  if (numberOfExecutions != numberOfSteps)
+  {
+    cerr << "ERROR: " << numberOfExecutions << " time steps read for " << numberOfSteps
+         << " time steps." << endl;
+    return false;
+  }
+  if (controller->GetLocalProcessId() != 0)
+  {
+    return true;
+  }
+
+  vtkNew<vtkTemporalFieldSource> serialSource;
+  serialSource->NumberOfSteps = numberOfSteps;
+  vtkNew<vtkTemporalRanges> serialRanges;
+  serialRanges->SetInputConnection(serialSource->GetOutputPort());
+  serialRanges->Update();
+  return SameTables(ranges->GetOutput(), serialRanges->GetOutput());
+}
+}
+
+int TestPTemporalRanges(int argc, char* argv[])
+{
+  vtkMPIController* controller = vtkMPIController::New();
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  // Neither number of time steps is a multiple of the number of processes
+  // the test runs with.
+  const int numProcs = controller->GetNumberOfProcesses();
+  const bool first = TestTimeParallel(controller, 2 * numProcs + 1);
+  const bool second = TestTimeParallel(controller, 3 * numProcs - 1);
+  int success = first && second ? 1 : 0;
+
+  int all_success;
+  controller->AllReduce(&success, &all_success, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  controller->Delete();
+  return all_success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
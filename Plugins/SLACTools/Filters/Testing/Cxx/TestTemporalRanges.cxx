@@ -0,0 +1,232 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestTemporalRanges.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the table computed by vtkTemporalRanges against a serial reference,
+// for a multi-component float array and a double array holding NaNs, over
+// enough tuples for the accumulation to be split between threads.
+
+#include "vtkDoubleArray.h"
+#include "vtkFloatArray.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkMath.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkPolyDataAlgorithm.h"
+#include "vtkStreamingDemandDrivenPipeline.h"
+#include "vtkTable.h"
+#include "vtkTemporalRanges.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <map>
+#include <string>
+
+namespace
+{
+const int NumberOfSteps = 5;
+const vtkIdType NumberOfTuples = 20000;
+const int NumberOfComponents = 3;
+
+double Value(int step, vtkIdType tuple, int component)
+{
+  if ((tuple + step) % 97 == 0 && tuple % NumberOfComponents == component)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  return static_cast<double>((tuple * 7 + component * 3 + step * 11) % 101) - 50 + 0.25 * step;
+}
+
+double ScalarValue(int step, vtkIdType tuple)
+{
+  if ((tuple + step) % 13 == 0)
+  {
+    return std::numeric_limits<double>::quiet_NaN();
+  }
+  return 0.5 * static_cast<double>(tuple % 37) - step;
+}
+
+// Produces a "vector" float array and a "scalar" double array, whose values
+// depend on the time step, on the points of a polydata.
+class vtkTemporalFieldSource : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkTemporalFieldSource* New();
+  vtkTypeMacro(vtkTemporalFieldSource, vtkPolyDataAlgorithm);
+
+protected:
+  vtkTemporalFieldSource() { this->SetNumberOfInputPorts(0); }
+
+  int RequestInformation(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    double times[NumberOfSteps];
+    for (int step = 0; step < NumberOfSteps; ++step)
+    {
+      times[step] = step;
+    }
+    double range[2] = { 0, NumberOfSteps - 1 };
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_STEPS(), times, NumberOfSteps);
+    outInfo->Set(vtkStreamingDemandDrivenPipeline::TIME_RANGE(), range, 2);
+    return 1;
+  }
+
+  int RequestData(vtkInformation*, vtkInformationVector**,
+    vtkInformationVector* outputVector) override
+  {
+    vtkInformation* outInfo = outputVector->GetInformationObject(0);
+    const int step = static_cast<int>(
+      std::floor(outInfo->Get(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP()) + 0.5));
+
+    vtkNew<vtkPoints> points;
+    points->SetNumberOfPoints(NumberOfTuples);
+    vtkNew<vtkFloatArray> vector;
+    vector->SetName("vector");
+    vector->SetNumberOfComponents(NumberOfComponents);
+    vector->SetNumberOfTuples(NumberOfTuples);
+    vtkNew<vtkDoubleArray> scalar;
+    scalar->SetName("scalar");
+    scalar->SetNumberOfTuples(NumberOfTuples);
+    for (vtkIdType tuple = 0; tuple < NumberOfTuples; ++tuple)
+    {
+      points->SetPoint(tuple, static_cast<double>(tuple), 0, 0);
+      for (int component = 0; component < NumberOfComponents; ++component)
+      {
+        vector->SetTypedComponent(
+          tuple, component, static_cast<float>(Value(step, tuple, component)));
+      }
+      scalar->SetValue(tuple, ScalarValue(step, tuple));
+    }
+
+    vtkPolyData* output = vtkPolyData::GetData(outInfo);
+    output->SetPoints(points);
+    output->GetPointData()->AddArray(vector);
+    output->GetPointData()->AddArray(scalar);
+    return 1;
+  }
+
+private:
+  vtkTemporalFieldSource(const vtkTemporalFieldSource&) = delete;
+  void operator=(const vtkTemporalFieldSource&) = delete;
+};
+vtkStandardNewMacro(vtkTemporalFieldSource);
+
+// Serial reference statistics of a column.
+struct Reference
+{
+  double Sum = 0.0;
+  double Minimum = std::numeric_limits<double>::max();
+  double Maximum = std::numeric_limits<double>::lowest();
+  double Count = 0.0;
+
+  void Add(double value)
+  {
+    if (!vtkMath::IsNan(value))
+    {
+      this->Sum += value;
+      this->Minimum = std::min(this->Minimum, value);
+      this->Maximum = std::max(this->Maximum, value);
+      this->Count += 1;
+    }
+  }
+};
+
+std::map<std::string, Reference> ComputeReference()
+{
+  std::map<std::string, Reference> reference;
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    for (vtkIdType tuple = 0; tuple < NumberOfTuples; ++tuple)
+    {
+      // The magnitude of a tuple with a NaN component is NaN.
+      double magnitude = 0.0;
+      for (int component = 0; component < NumberOfComponents; ++component)
+      {
+        const double value = static_cast<float>(Value(step, tuple, component));
+        reference["vector_" + std::to_string(component)].Add(value);
+        magnitude += value * value;
+      }
+      reference["vector_M"].Add(std::sqrt(magnitude));
+      reference["scalar"].Add(ScalarValue(step, tuple));
+    }
+  }
+  return reference;
+}
+
+bool CheckColumn(vtkTable* table, const std::string& name, const Reference& reference)
+{
+  vtkDoubleArray* column = vtkDoubleArray::SafeDownCast(table->GetColumnByName(name.c_str()));
+  if (!column || column->GetNumberOfTuples() != vtkTemporalRanges::NUMBER_OF_ROWS)
+  {
+    cerr << "ERROR: missing column " << name << endl;
+    return false;
+  }
+
+  const double average = reference.Sum / reference.Count;
+  const double computed = column->GetValue(vtkTemporalRanges::AVERAGE_ROW);
+  if (column->GetValue(vtkTemporalRanges::COUNT_ROW) != reference.Count ||
+    column->GetValue(vtkTemporalRanges::MINIMUM_ROW) != reference.Minimum ||
+    column->GetValue(vtkTemporalRanges::MAXIMUM_ROW) != reference.Maximum ||
+    std::abs(computed - average) > 1e-9 * std::max(1.0, std::abs(average)))
+  {
+    cerr << "ERROR: wrong statistics for " << name << ": " << computed << " "
+         << column->GetValue(vtkTemporalRanges::MINIMUM_ROW) << " "
+         << column->GetValue(vtkTemporalRanges::MAXIMUM_ROW) << " "
+         << column->GetValue(vtkTemporalRanges::COUNT_ROW) << ", expected " << average << " "
+         << reference.Minimum << " " << reference.Maximum << " " << reference.Count << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestTemporalRanges(int, char* [])
+{
+  vtkNew<vtkTemporalFieldSource> source;
+  vtkNew<vtkTemporalRanges> ranges;
+  ranges->SetInputConnection(source->GetOutputPort());
+  ranges->Update();
+
+  vtkTable* table = ranges->GetOutput();
+  // The range names, the components and magnitude of "vector", and "scalar".
+  if (table->GetNumberOfColumns() != NumberOfComponents + 3)
+  {
+    cerr << "ERROR: wrong number of columns: " << table->GetNumberOfColumns() << endl;
+    return EXIT_FAILURE;
+  }
+  for (const auto& column : ComputeReference())
+  {
+    if (!CheckColumn(table, column.first, column.second))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  // Updating again accumulates all the time steps from scratch.
+  source->Modified();
+  ranges->Update();
+  for (const auto& column : ComputeReference())
+  {
+    if (!CheckColumn(ranges->GetOutput(), column.first, column.second))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -90,6 +90,7 @@ vtkCxxSetObjectMacro(vtkPTemporalRanges, Controller, vtkMultiProcessController);
 vtkPTemporalRanges::vtkPTemporalRanges()
 {
   this->Controller = NULL;
+  this->TimeParallel = false;
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
@@ -103,6 +104,52 @@ void vtkPTemporalRanges::PrintSelf(ostream& os, vtkIndent indent)
   this->Superclass::PrintSelf(os, indent);
 
   os << indent << "Controller: " << this->Controller << endl;
+  os << indent << "TimeParallel: " << this->TimeParallel << endl;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkPTemporalRanges::IsTimeParallel(int numberOfTimeSteps)
+{
+  return this->TimeParallel && this->Controller &&
+    this->Controller->GetNumberOfProcesses() > 1 &&
+    numberOfTimeSteps >= this->Controller->GetNumberOfProcesses();
+}
+
+//-----------------------------------------------------------------------------
+void vtkPTemporalRanges::GetTimeIndexRange(int numberOfTimeSteps, int range[2])
+{
+  if (!this->IsTimeParallel(numberOfTimeSteps))
+  {
+    this->Superclass::GetTimeIndexRange(numberOfTimeSteps, range);
+    return;
+  }
+
+  // Contiguous blocks keep the time steps read by each process in order.
+  const int rank = this->Controller->GetLocalProcessId();
+  const int numProcs = this->Controller->GetNumberOfProcesses();
+  range[0] = static_cast<int>(static_cast<long long>(numberOfTimeSteps) * rank / numProcs);
+  range[1] = static_cast<int>(static_cast<long long>(numberOfTimeSteps) * (rank + 1) / numProcs);
+}
+
+//-----------------------------------------------------------------------------
+int vtkPTemporalRanges::RequestUpdateExtent(
+  vtkInformation* request, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  if (!this->Superclass::RequestUpdateExtent(request, inputVector, outputVector))
+  {
+    return 0;
+  }
+
+  vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
+  if (this->IsTimeParallel(inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS())))
+  {
+    // Each process accumulates the whole data for its time steps.
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_PIECE_NUMBER(), 0);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_PIECES(), 1);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_NUMBER_OF_GHOST_LEVELS(), 0);
+  }
+
+  return 1;
 }
 
 //-----------------------------------------------------------------------------
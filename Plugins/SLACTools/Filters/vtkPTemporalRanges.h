@@ -23,7 +23,8 @@
 // .SECTION Description
 //
 // vtkPTemporalRanges works basically like its superclass, vtkTemporalRanges,
-// except that it works in a data parallel manner.
+// except that it works in a data parallel manner. Alternatively, the processes
+// can share the time steps instead of the data (see TimeParallel).
 //
 
 #ifndef vtkPTemporalRanges_h
@@ -44,14 +45,36 @@ public:
   vtkGetObjectMacro(Controller, vtkMultiProcessController);
   virtual void SetController(vtkMultiProcessController*);
 
+  // Description:
+  // When on, and when there are at least as many time steps as processes, each
+  // process accumulates the whole input over a contiguous block of the time
+  // steps instead of its piece of the input over all of them. The processes
+  // then sweep through time concurrently, which is faster when updating the
+  // input for a time step costs more than accumulating it, but each process
+  // holds a whole time step. The input must be able to produce the whole data
+  // on each process, as readers do. Off by default.
+  vtkGetMacro(TimeParallel, bool);
+  vtkSetMacro(TimeParallel, bool);
+  vtkBooleanMacro(TimeParallel, bool);
+
 protected:
   vtkPTemporalRanges();
   ~vtkPTemporalRanges();
 
   vtkMultiProcessController* Controller;
+  bool TimeParallel;
+
+  virtual int RequestUpdateExtent(
+    vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
   virtual int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  virtual void GetTimeIndexRange(int numberOfTimeSteps, int range[2]) override;
+
+  // Description:
+  // Returns true when the time steps are shared between the processes.
+  bool IsTimeParallel(int numberOfTimeSteps);
+
   virtual void Reduce(vtkTable* table);
 
 private:
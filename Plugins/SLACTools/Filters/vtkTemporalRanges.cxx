@@ -20,10 +20,12 @@
 
 #include "vtkTemporalRanges.h"
 
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDoubleArray.h"
 #include "vtkInformation.h"
@@ -31,6 +33,8 @@
 #include "vtkMath.h"
 #include "vtkObjectFactory.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
@@ -40,6 +44,7 @@
 #define VTK_CREATE(type, name) vtkSmartPointer<type> name = vtkSmartPointer<type>::New()
 
 #include <algorithm>
+#include <cmath>
 #include <sstream>
 #include <vector>
 
@@ -63,16 +68,117 @@ inline void InitializeColumn(vtkDoubleArray* column)
   column->SetValue(COUNT_ROW, 0.0);
 }
 
-inline void AccumulateValue(double value, vtkDoubleArray* column)
+// Partial sum, minimum, maximum and count of the values of a column.
+struct Accumulator
 {
-  if (!vtkMath::IsNan(value))
+  double Sum = 0.0;
+  double Minimum = vtkTypeTraits<double>::Max();
+  double Maximum = vtkTypeTraits<double>::Min();
+  double Count = 0.0;
+
+  void Add(double value)
   {
-    column->SetValue(AVERAGE_ROW, value + column->GetValue(AVERAGE_ROW));
-    column->SetValue(MINIMUM_ROW, std::min(column->GetValue(MINIMUM_ROW), value));
-    column->SetValue(MAXIMUM_ROW, std::max(column->GetValue(MAXIMUM_ROW), value));
-    column->SetValue(COUNT_ROW, column->GetValue(COUNT_ROW) + 1);
+    if (!vtkMath::IsNan(value))
+    {
+      this->Sum += value;
+      this->Minimum = std::min(this->Minimum, value);
+      this->Maximum = std::max(this->Maximum, value);
+      this->Count += 1;
+    }
+  }
+
+  void Merge(const Accumulator& other)
+  {
+    this->Sum += other.Sum;
+    this->Minimum = std::min(this->Minimum, other.Minimum);
+    this->Maximum = std::max(this->Maximum, other.Maximum);
+    this->Count += other.Count;
+  }
+
+  // Stores the statistics of the accumulated values in a column.
+  void Store(vtkDoubleArray* column) const
+  {
+    column->SetValue(AVERAGE_ROW, this->Sum / this->Count);
+    column->SetValue(MINIMUM_ROW, this->Minimum);
+    column->SetValue(MAXIMUM_ROW, this->Maximum);
+    column->SetValue(COUNT_ROW, this->Count);
+  }
+};
+
+// Accumulates the components of the tuples of an array, and their magnitude,
+// over ranges of tuples processed concurrently. The partial results of all
+// the threads are merged by Reduce.
+template <typename ArrayT>
+class AccumulateFunctor
+{
+public:
+  AccumulateFunctor(ArrayT* array, bool magnitude)
+    : Array(array)
+    , NumberOfComponents(array->GetNumberOfComponents())
+    , Magnitude(magnitude)
+  {
+  }
+
+  void Initialize()
+  {
+    this->Accumulators.Local().assign(this->NumberOfComponents + 1, Accumulator());
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<Accumulator>& accumulators = this->Accumulators.Local();
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    for (const auto tuple : tuples)
+    {
+      double mag = 0.0;
+      for (int j = 0; j < this->NumberOfComponents; j++)
+      {
+        const double value = static_cast<double>(tuple[j]);
+        mag += value * value;
+        accumulators[j].Add(value);
+      }
+      if (this->Magnitude)
+      {
+        accumulators[this->NumberOfComponents].Add(sqrt(mag));
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    this->Result.assign(this->NumberOfComponents + 1, Accumulator());
+    for (auto iter = this->Accumulators.begin(); iter != this->Accumulators.end(); ++iter)
+    {
+      for (int j = 0; j <= this->NumberOfComponents; j++)
+      {
+        this->Result[j].Merge((*iter)[j]);
+      }
+    }
   }
-}
+
+  // Accumulators of the components, followed by the one of the magnitude.
+  std::vector<Accumulator> Result;
+
+private:
+  ArrayT* Array;
+  int NumberOfComponents;
+  bool Magnitude;
+  vtkSMPThreadLocal<std::vector<Accumulator> > Accumulators;
+};
+
+struct AccumulateWorker
+{
+  bool Magnitude;
+  std::vector<Accumulator> Result;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    AccumulateFunctor<ArrayT> functor(array, this->Magnitude);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    this->Result = functor.Result;
+  }
+};
 
 inline void AccumulateColumn(vtkDoubleArray* source, vtkDoubleArray* target)
 {
@@ -150,8 +256,10 @@ int vtkTemporalRanges::RequestUpdateExtent(vtkInformation* vtkNotUsed(request),
   double* inTimes = inInfo->Get(vtkStreamingDemandDrivenPipeline::TIME_STEPS());
   if (inTimes)
   {
-    inInfo->Set(
-      vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(), inTimes[this->CurrentTimeIndex]);
+    int range[2];
+    this->GetTimeIndexRange(inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()), range);
+    inInfo->Set(vtkStreamingDemandDrivenPipeline::UPDATE_TIME_STEP(),
+      inTimes[range[0] + this->CurrentTimeIndex]);
   }
 
   return 1;
@@ -190,7 +298,9 @@ int vtkTemporalRanges::RequestData(
 
   this->CurrentTimeIndex++;
 
-  if (this->CurrentTimeIndex < inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()))
+  int range[2];
+  this->GetTimeIndexRange(inInfo->Length(vtkStreamingDemandDrivenPipeline::TIME_STEPS()), range);
+  if (this->CurrentTimeIndex < range[1] - range[0])
   {
     // There is still more to do.
     request->Set(vtkStreamingDemandDrivenPipeline::CONTINUE_EXECUTING(), 1);
@@ -205,6 +315,13 @@ int vtkTemporalRanges::RequestData(
   return 1;
 }
 
+//-----------------------------------------------------------------------------
+void vtkTemporalRanges::GetTimeIndexRange(int numberOfTimeSteps, int range[2])
+{
+  range[0] = 0;
+  range[1] = numberOfTimeSteps;
+}
+
 //-----------------------------------------------------------------------------
 void vtkTemporalRanges::InitializeTable(vtkTable* output)
 {
@@ -268,56 +385,29 @@ void vtkTemporalRanges::AccumulateFields(vtkFieldData* fields, vtkTable* output)
 void vtkTemporalRanges::AccumulateArray(vtkDataArray* field, vtkTable* output)
 {
   int numComponents = field->GetNumberOfComponents();
-  vtkIdType numTuples = field->GetNumberOfTuples();
-  vtkDoubleArray* magnitudeColumn = NULL;
-  std::vector<vtkDoubleArray*> componentColumns(numComponents);
-  VTK_CREATE(vtkDoubleArray, magnitudeAccumulate);
-  std::vector<vtkSmartPointer<vtkDoubleArray> > componentAccumulate(numComponents);
-  if (numComponents > 1)
+  AccumulateWorker worker;
+  worker.Magnitude = (numComponents > 1);
+  if (!vtkArrayDispatch::Dispatch::Execute(field, worker))
   {
-    magnitudeColumn = this->GetColumn(output, field->GetName(), -1);
-    InitializeColumn(magnitudeAccumulate);
-    for (int i = 0; i < numComponents; i++)
-    {
-      componentColumns[i] = this->GetColumn(output, field->GetName(), i);
-      componentAccumulate[i] = vtkSmartPointer<vtkDoubleArray>::New();
-      InitializeColumn(componentAccumulate[i]);
-    }
-  }
-  else
-  {
-    componentColumns[0] = this->GetColumn(output, field->GetName());
-    componentAccumulate[0] = vtkSmartPointer<vtkDoubleArray>::New();
-    InitializeColumn(componentAccumulate[0]);
+    worker(field);
   }
 
-  for (vtkIdType i = 0; i < numTuples; i++)
+  VTK_CREATE(vtkDoubleArray, accumulate);
+  InitializeColumn(accumulate);
+  if (numComponents > 1)
   {
-    double mag = 0.0;
-    for (int j = 0; j < numComponents; j++)
-    {
-      double value = field->GetComponent(i, j);
-      mag += value * value;
-      AccumulateValue(value, componentAccumulate[j]);
-    }
-    if (magnitudeColumn)
+    for (int i = 0; i < numComponents; i++)
     {
-      mag = sqrt(mag);
-      AccumulateValue(mag, magnitudeAccumulate);
+      worker.Result[i].Store(accumulate);
+      AccumulateColumn(accumulate, this->GetColumn(output, field->GetName(), i));
     }
+    worker.Result[numComponents].Store(accumulate);
+    AccumulateColumn(accumulate, this->GetColumn(output, field->GetName(), -1));
   }
-
-  for (int j = 0; j < numComponents; j++)
-  {
-    componentAccumulate[j]->SetValue(AVERAGE_ROW, (componentAccumulate[j]->GetValue(AVERAGE_ROW) /
-                                                    componentAccumulate[j]->GetValue(COUNT_ROW)));
-    AccumulateColumn(componentAccumulate[j], componentColumns[j]);
-  }
-  if (magnitudeColumn)
+  else
   {
-    magnitudeAccumulate->SetValue(AVERAGE_ROW,
-      (magnitudeAccumulate->GetValue(AVERAGE_ROW) / magnitudeAccumulate->GetValue(COUNT_ROW)));
-    AccumulateColumn(magnitudeAccumulate, magnitudeColumn);
+    worker.Result[0].Store(accumulate);
+    AccumulateColumn(accumulate, this->GetColumn(output, field->GetName()));
   }
 }
 
@@ -75,6 +75,14 @@ protected:
 
   virtual int RequestData(vtkInformation*, vtkInformationVector**, vtkInformationVector*) override;
 
+  // Description:
+  // Get the range [range[0], range[1]) of the indices of the input time steps
+  // accumulated by this filter, which iterates over them starting at
+  // range[0]. The default accumulates all the time steps. Subclasses can
+  // override this to share the time steps between several filters whose
+  // results are then merged with AccumulateTable.
+  virtual void GetTimeIndexRange(int numberOfTimeSteps, int range[2]);
+
   virtual void InitializeTable(vtkTable* output);
 
   virtual void AccumulateCompositeData(vtkCompositeDataSet* input, vtkTable* output);
@@ -65,6 +65,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "vtkStringList.h"
 
 // Qt Includes.
+#include <QHash>
 #include <QList>
 #include <QMap>
 #include <QPointer>
@@ -79,15 +80,161 @@ public:
   typedef QMap<vtkIdType, QPointer<pqServer> > ServerMap;
   ServerMap Servers;
 
-  typedef QMap<vtkSMProxy*, QPointer<pqProxy> > ProxyMap;
+  typedef QHash<vtkSMProxy*, QPointer<pqProxy> > ProxyMap;
   ProxyMap Proxies;
 
   typedef QMap<vtkSMOutputPort*, QPointer<pqOutputPort> > OutputPortMap;
   OutputPortMap OutputPorts;
 
-  QList<QPointer<pqServerManagerModelItem> > ItemList;
+  typedef QList<QPointer<pqServerManagerModelItem> > ItemListType;
+  ItemListType ItemList;
+
+  // Items of each type looked up by findItems(), kept in the order of
+  // ItemList. A type is added on its first lookup and kept up to date as items
+  // are added and removed.
+  typedef QHash<const QMetaObject*, ItemListType> ItemsByTypeMap;
+  ItemsByTypeMap ItemsByType;
+
+  // Proxy items indexed by global id and by SM name. Items sharing a key are
+  // kept in the order of ItemList so that lookups return the same item as a
+  // search of ItemList would.
+  typedef QList<QPointer<pqProxy> > ProxyListType;
+  QHash<vtkTypeUInt32, ProxyListType> ProxiesByID;
+  QHash<QString, ProxyListType> ProxiesByName;
+
+  // Keys a proxy item is indexed with, and its rank in ItemList.
+  struct IndexedProxy
+  {
+    quint64 Rank;
+    vtkTypeUInt32 ID;
+    QString Name;
+  };
+  QHash<pqProxy*, IndexedProxy> IndexedProxies;
+  quint64 NextRank;
 
   pqServerResource ActiveResource;
+
+  pqInternal()
+    : NextRank(0)
+  {
+  }
+
+  void addItem(pqServerManagerModelItem* item)
+  {
+    this->ItemList.push_back(item);
+    for (ItemsByTypeMap::iterator iter = this->ItemsByType.begin();
+         iter != this->ItemsByType.end(); ++iter)
+    {
+      if (iter.key()->cast(item))
+      {
+        iter.value().push_back(item);
+      }
+    }
+
+    if (pqProxy* proxy = qobject_cast<pqProxy*>(item))
+    {
+      IndexedProxy& indexed = this->IndexedProxies[proxy];
+      indexed.Rank = this->NextRank++;
+      indexed.ID = proxy->getProxy()->GetGlobalID();
+      indexed.Name = proxy->getSMName();
+      this->insert(this->ProxiesByID[indexed.ID], proxy);
+      this->insert(this->ProxiesByName[indexed.Name], proxy);
+    }
+  }
+
+  void removeItem(pqServerManagerModelItem* item)
+  {
+    this->ItemList.removeAll(item);
+    for (ItemsByTypeMap::iterator iter = this->ItemsByType.begin();
+         iter != this->ItemsByType.end(); ++iter)
+    {
+      iter.value().removeAll(item);
+    }
+
+    pqProxy* proxy = qobject_cast<pqProxy*>(item);
+    QHash<pqProxy*, IndexedProxy>::iterator iter = this->IndexedProxies.find(proxy);
+    if (proxy && iter != this->IndexedProxies.end())
+    {
+      this->remove(this->ProxiesByID, iter.value().ID, proxy);
+      this->remove(this->ProxiesByName, iter.value().Name, proxy);
+      this->IndexedProxies.erase(iter);
+    }
+  }
+
+  void renameItem(pqProxy* proxy)
+  {
+    QHash<pqProxy*, IndexedProxy>::iterator iter = this->IndexedProxies.find(proxy);
+    if (iter != this->IndexedProxies.end() && iter.value().Name != proxy->getSMName())
+    {
+      this->remove(this->ProxiesByName, iter.value().Name, proxy);
+      iter.value().Name = proxy->getSMName();
+      this->insert(this->ProxiesByName[iter.value().Name], proxy);
+    }
+  }
+
+  const ItemListType& itemsOfType(const QMetaObject& mo)
+  {
+    ItemsByTypeMap::iterator iter = this->ItemsByType.find(&mo);
+    if (iter == this->ItemsByType.end())
+    {
+      iter = this->ItemsByType.insert(&mo, ItemListType());
+      foreach (pqServerManagerModelItem* item, this->ItemList)
+      {
+        if (item && mo.cast(item))
+        {
+          iter.value().push_back(item);
+        }
+      }
+    }
+    return iter.value();
+  }
+
+  template <class Key>
+  static pqProxy* find(
+    const QHash<Key, ProxyListType>& index, const Key& key, const QMetaObject& mo)
+  {
+    typename QHash<Key, ProxyListType>::const_iterator iter = index.find(key);
+    if (iter != index.end())
+    {
+      foreach (pqProxy* proxy, iter.value())
+      {
+        if (proxy && mo.cast(proxy))
+        {
+          return proxy;
+        }
+      }
+    }
+    return 0;
+  }
+
+private:
+  // Inserts proxy in a list of proxies sharing a key, keeping the list sorted
+  // by rank. Lists are short, the new proxy usually goes at the end.
+  void insert(ProxyListType& list, pqProxy* proxy)
+  {
+    const quint64 rank = this->IndexedProxies[proxy].Rank;
+    int index = list.size();
+    while (index > 0 &&
+      (!list[index - 1] || this->IndexedProxies.value(list[index - 1]).Rank > rank))
+    {
+      --index;
+    }
+    list.insert(index, proxy);
+  }
+
+  template <class Key>
+  static void remove(QHash<Key, ProxyListType>& index, const Key& key, pqProxy* proxy)
+  {
+    typename QHash<Key, ProxyListType>::iterator iter = index.find(key);
+    if (iter != index.end())
+    {
+      iter.value().removeAll(proxy);
+      if (iter.value().isEmpty())
+      {
+        index.erase(iter);
+      }
+    }
+  }
 };
 
 //-----------------------------------------------------------------------------
@@ -194,38 +341,14 @@ pqServerManagerModelItem* pqServerManagerModel::findItemHelper(
 pqServerManagerModelItem* pqServerManagerModel::findItemHelper(
   const pqServerManagerModel* const model, const QMetaObject& mo, vtkTypeUInt32 id)
 {
-  foreach (pqServerManagerModelItem* item, model->Internal->ItemList)
-  {
-    if (item && mo.cast(item))
-    {
-      pqProxy* proxy = qobject_cast<pqProxy*>(item);
-      if (proxy && proxy->getProxy()->GetGlobalID() == id)
-      {
-        return proxy;
-      }
-    }
-  }
-
-  return 0;
+  return pqInternal::find(model->Internal->ProxiesByID, id, mo);
 }
 
 //-----------------------------------------------------------------------------
 pqServerManagerModelItem* pqServerManagerModel::findItemHelper(
   const pqServerManagerModel* const model, const QMetaObject& mo, const QString& name)
 {
-  foreach (pqServerManagerModelItem* item, model->Internal->ItemList)
-  {
-    if (item && mo.cast(item))
-    {
-      pqProxy* proxy = qobject_cast<pqProxy*>(item);
-      if (proxy && proxy->getSMName() == name)
-      {
-        return proxy;
-      }
-    }
-  }
-
-  return 0;
+  return pqInternal::find(model->Internal->ProxiesByName, name, mo);
 }
 
 //-----------------------------------------------------------------------------
@@ -237,9 +360,9 @@ void pqServerManagerModel::findItemsHelper(const pqServerManagerModel* const mod
     return;
   }
 
-  foreach (pqServerManagerModelItem* item, model->Internal->ItemList)
+  foreach (pqServerManagerModelItem* item, model->Internal->itemsOfType(mo))
   {
-    if (item && mo.cast(item))
+    if (item)
     {
       if (server)
       {
@@ -352,7 +475,9 @@ void pqServerManagerModel::onProxyRegistered(
   }
 
   this->Internal->Proxies[proxy] = item;
-  this->Internal->ItemList.push_back(item);
+  this->Internal->addItem(item);
+  QObject::connect(item, SIGNAL(nameChanged(pqServerManagerModelItem*)), this,
+    SLOT(onProxyNameChanged(pqServerManagerModelItem*)));
 
   Q_EMIT this->itemAdded(item);
   Q_EMIT this->proxyAdded(item);
@@ -434,7 +559,7 @@ void pqServerManagerModel::onProxyUnRegistered(
   Q_EMIT this->preItemRemoved(item);
 
   QObject::disconnect(item, 0, this, 0);
-  this->Internal->ItemList.removeAll(item);
+  this->Internal->removeItem(item);
   this->Internal->Proxies.remove(item->getProxy());
 
   if (view)
@@ -456,6 +581,15 @@ void pqServerManagerModel::onProxyUnRegistered(
   delete item;
 }
 
+//-----------------------------------------------------------------------------
+void pqServerManagerModel::onProxyNameChanged(pqServerManagerModelItem* item)
+{
+  if (pqProxy* proxy = qobject_cast<pqProxy*>(item))
+  {
+    this->Internal->renameItem(proxy);
+  }
+}
+
 //-----------------------------------------------------------------------------
 void pqServerManagerModel::onConnectionCreated(vtkIdType id)
 {
@@ -486,7 +620,7 @@ void pqServerManagerModel::onConnectionCreated(vtkIdType id)
   Q_EMIT this->preServerAdded(server);
 
   this->Internal->Servers[id] = server;
-  this->Internal->ItemList.push_back(server);
+  this->Internal->addItem(server);
 
   // Lets the world know when the server name changes.
   this->connect(server, SIGNAL(nameChanged(pqServerManagerModelItem*)), this,
@@ -593,7 +727,7 @@ void pqServerManagerModel::onConnectionClosed(vtkIdType id)
   Q_EMIT this->preItemRemoved(server);
 
   this->Internal->Servers.remove(server->GetConnectionID());
-  this->Internal->ItemList.removeAll(server);
+  this->Internal->removeItem(server);
 
   Q_EMIT this->serverRemoved(server);
   Q_EMIT this->itemRemoved(server);
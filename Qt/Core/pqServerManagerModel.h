@@ -360,6 +360,12 @@ protected Q_SLOTS:
   */
   virtual void onStateLoaded(vtkPVXMLElement*, vtkSMProxyLocator*);
 
+private Q_SLOTS:
+  /**
+  * Called when the SM name of a proxy changes to update the lookup by name.
+  */
+  void onProxyNameChanged(pqServerManagerModelItem*);
+
 private:
   Q_DISABLE_COPY(pqServerManagerModel)
 
@@ -72,6 +72,7 @@ SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
 #include "pqSMAdaptor.h"
 #include "pqTimer.h"
 
+#include <algorithm>
 #include <cassert>
 
 static uint qHash(pqSpreadSheetViewModel::vtkIndex index)
@@ -100,6 +101,7 @@ public:
   QItemSelectionModel SelectionModel;
   pqTimer Timer;
   pqTimer SelectionTimer;
+  pqTimer PrefetchTimer;
   int DecimalPrecision;
   bool FixedRepresentation;
   vtkIdType LastRowCount;
@@ -132,6 +134,12 @@ pqSpreadSheetViewModel::pqSpreadSheetViewModel(vtkSMProxy* view, QObject* parent
   this->Internal->Timer.setInterval(500); // milliseconds.
   QObject::connect(&this->Internal->Timer, SIGNAL(timeout()), this, SLOT(delayedUpdate()));
 
+  // blocks are prefetched one at a time, when idle, so that the UI remains
+  // responsive.
+  this->Internal->PrefetchTimer.setSingleShot(true);
+  this->Internal->PrefetchTimer.setInterval(50); // milliseconds.
+  QObject::connect(&this->Internal->PrefetchTimer, SIGNAL(timeout()), this, SLOT(prefetch()));
+
   this->Internal->SelectionTimer.setSingleShot(true);
   this->Internal->SelectionTimer.setInterval(100); // milliseconds.
   QObject::connect(
@@ -212,6 +220,7 @@ void pqSpreadSheetViewModel::forceUpdate()
   this->Internal->SelectionModel.clear();
   this->Internal->Timer.stop();
   this->Internal->SelectionTimer.stop();
+  this->Internal->PrefetchTimer.stop();
 
   vtkIdType& rows = this->Internal->LastRowCount;
   vtkIdType& columns = this->Internal->LastColumnCount;
@@ -244,7 +253,27 @@ void pqSpreadSheetViewModel::delayedUpdate()
 {
   if (this->Internal->ActiveRegion[0] >= 0)
   {
+    this->Internal->VTKView->SetVisibleRows(this->Internal->ActiveRegion[0],
+      std::min<vtkIdType>(this->Internal->ActiveRegion[1], this->rowCount() - 1));
     this->Internal->VTKView->GetValue(this->Internal->ActiveRegion[0], 0);
+    // the visible region may span two blocks.
+    if (this->Internal->ActiveRegion[1] > this->Internal->ActiveRegion[0] &&
+      this->Internal->ActiveRegion[1] < this->rowCount())
+    {
+      this->Internal->VTKView->GetValue(this->Internal->ActiveRegion[1], 0);
+    }
+    this->Internal->PrefetchTimer.start();
+  }
+}
+
+//-----------------------------------------------------------------------------
+void pqSpreadSheetViewModel::prefetch()
+{
+  // fetch the next block the user is likely to scroll to, unless some data is
+  // still pending for the visible region.
+  if (!this->Internal->Timer.isActive() && this->Internal->VTKView->PrefetchBlock())
+  {
+    this->Internal->PrefetchTimer.start();
   }
 }
 
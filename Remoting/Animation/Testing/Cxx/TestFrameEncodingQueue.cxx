@@ -0,0 +1,253 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestFrameEncodingQueue.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the queue used by vtkSMSaveAnimationProxy to write frames on
+// background threads: frames are written in order by a single encoder and
+// exactly once by several encoders, Push() blocks while the queue is full,
+// and a failed write stops the animation and is reported by Finish().
+
+#include "vtkSMFrameEncodingQueue.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <cstdlib>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace vtkSMSaveAnimationProxyNS;
+
+namespace
+{
+// State shared by the encoders and the test.
+struct EncodingLog
+{
+  std::mutex Mutex;
+  std::condition_variable Changed;
+  std::vector<int> Frames;
+  int NumberOfStartedFrames = 0;
+  int NumberOfFinalizedEncoders = 0;
+  bool Blocked = false;
+
+  void SetBlocked(bool blocked)
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Blocked = blocked;
+    }
+    this->Changed.notify_all();
+  }
+};
+
+// Records the index of the frames it writes, held by their first file name.
+// It fails to write the frame FailingFrame and to finalize if FailFinalize is
+// set, and waits while the log is blocked.
+class LoggingEncoder : public FrameEncoder
+{
+public:
+  LoggingEncoder(EncodingLog& log, int failingFrame = -1, bool failFinalize = false)
+    : Log(log)
+    , FailingFrame(failingFrame)
+    , FailFinalize(failFinalize)
+  {
+  }
+
+  bool Encode(const Frame& frame) override
+  {
+    const int index = std::stoi(frame.FileNames[0]);
+    std::unique_lock<std::mutex> lock(this->Log.Mutex);
+    ++this->Log.NumberOfStartedFrames;
+    this->Log.Changed.notify_all();
+    this->Log.Changed.wait(lock, [this]() { return !this->Log.Blocked; });
+    this->Log.Frames.push_back(index);
+    return index != this->FailingFrame;
+  }
+
+  bool Finalize() override
+  {
+    std::lock_guard<std::mutex> lock(this->Log.Mutex);
+    ++this->Log.NumberOfFinalizedEncoders;
+    return !this->FailFinalize;
+  }
+
+private:
+  EncodingLog& Log;
+  int FailingFrame;
+  bool FailFinalize;
+};
+
+std::vector<std::unique_ptr<FrameEncoder> > CreateEncoders(
+  EncodingLog& log, int count, int failingFrame = -1, bool failFinalize = false)
+{
+  std::vector<std::unique_ptr<FrameEncoder> > encoders;
+  for (int cc = 0; cc < count; ++cc)
+  {
+    encoders.emplace_back(new LoggingEncoder(log, failingFrame, failFinalize));
+  }
+  return encoders;
+}
+
+Frame MakeFrame(int index)
+{
+  Frame frame;
+  frame.Images[0] = vtkSmartPointer<vtkImageData>::New();
+  frame.FileNames[0] = std::to_string(index);
+  return frame;
+}
+
+std::vector<int> Range(int count)
+{
+  std::vector<int> range(count);
+  std::iota(range.begin(), range.end(), 0);
+  return range;
+}
+
+bool TestOrdering(int numberOfEncoders)
+{
+  const int numberOfFrames = 100;
+  EncodingLog log;
+  FrameEncodingQueue queue;
+  queue.Start(CreateEncoders(log, numberOfEncoders));
+  for (int cc = 0; cc < numberOfFrames; ++cc)
+  {
+    if (!queue.Push(MakeFrame(cc)))
+    {
+      std::cerr << "ERROR: failed to push frame " << cc << std::endl;
+      return false;
+    }
+  }
+  if (!queue.Finish())
+  {
+    std::cerr << "ERROR: encoding failed." << std::endl;
+    return false;
+  }
+
+  // A single encoder writes the frames in order, several encoders each frame
+  // once in any order.
+  std::vector<int> frames = log.Frames;
+  if (numberOfEncoders > 1)
+  {
+    std::sort(frames.begin(), frames.end());
+  }
+  if (frames != Range(numberOfFrames) || log.NumberOfFinalizedEncoders != numberOfEncoders)
+  {
+    std::cerr << "ERROR: wrong frames written by " << numberOfEncoders << " encoders."
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestBackPressure()
+{
+  const int numberOfFrames = 10;
+  EncodingLog log;
+  log.Blocked = true;
+  FrameEncodingQueue queue;
+  queue.Start(CreateEncoders(log, 1));
+
+  std::atomic<int> numberOfPushedFrames(0);
+  std::thread producer([&]() {
+    for (int cc = 0; cc < numberOfFrames; ++cc)
+    {
+      queue.Push(MakeFrame(cc));
+      ++numberOfPushedFrames;
+    }
+  });
+
+  // The encoder holds the first frame and the queue is full with the next
+  // ones: the producer must stay blocked.
+  const int expected = 1 + static_cast<int>(FRAMES_PER_ENCODING_THREAD);
+  {
+    std::unique_lock<std::mutex> lock(log.Mutex);
+    log.Changed.wait(lock, [&]() { return log.NumberOfStartedFrames > 0; });
+  }
+  for (int cc = 0; cc < 100 && numberOfPushedFrames < expected; ++cc)
+  {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  std::this_thread::sleep_for(std::chrono::milliseconds(100));
+  const int blockedCount = numberOfPushedFrames;
+
+  log.SetBlocked(false);
+  producer.join();
+  const bool status = queue.Finish();
+  if (blockedCount != expected)
+  {
+    std::cerr << "ERROR: " << blockedCount << " frames pushed while the encoder was blocked, "
+              << "expected " << expected << "." << std::endl;
+    return false;
+  }
+  if (!status || log.Frames != Range(numberOfFrames))
+  {
+    std::cerr << "ERROR: wrong frames written after the encoder was unblocked." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestEncoderFailure()
+{
+  const int failingFrame = 3;
+  EncodingLog log;
+  FrameEncodingQueue queue;
+  queue.Start(CreateEncoders(log, 1, failingFrame));
+
+  // Once the frame fails, at most the frames already queued may have been
+  // pushed before Push() reports the failure.
+  int numberOfPushedFrames = 0;
+  while (numberOfPushedFrames < 1000 && queue.Push(MakeFrame(numberOfPushedFrames)))
+  {
+    ++numberOfPushedFrames;
+  }
+  const bool status = queue.Finish();
+  if (numberOfPushedFrames > failingFrame + 1 + static_cast<int>(FRAMES_PER_ENCODING_THREAD))
+  {
+    std::cerr << "ERROR: " << numberOfPushedFrames << " frames pushed after a failure."
+              << std::endl;
+    return false;
+  }
+  if (status || log.Frames != Range(failingFrame + 1) || log.NumberOfFinalizedEncoders != 1)
+  {
+    std::cerr << "ERROR: the failure was not reported, or queued frames were written."
+              << std::endl;
+    return false;
+  }
+
+  // A failure to finalize is reported too.
+  EncodingLog finalizeLog;
+  queue.Start(CreateEncoders(finalizeLog, 1, -1, true));
+  if (!queue.Push(MakeFrame(0)) || queue.Finish())
+  {
+    std::cerr << "ERROR: the finalization failure was not reported." << std::endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestFrameEncodingQueue(int, char* [])
+{
+  if (!TestOrdering(1) || !TestOrdering(4) || !TestBackPressure() || !TestEncoderFailure())
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkSMFrameEncodingQueue.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @file   vtkSMFrameEncodingQueue.h
+ * @brief  Queue of animation frames written by background threads.
+ *
+ * Internal to vtkSMSaveAnimationProxy; it is only kept in a header of its own
+ * so that it can be tested.
+ */
+
+#ifndef vtkSMFrameEncodingQueue_h
+#define vtkSMFrameEncodingQueue_h
+
+#include "vtkImageData.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <cassert>
+#include <condition_variable>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace vtkSMSaveAnimationProxyNS
+{
+
+// Number of frames that may wait for an encoding thread, per thread.
+const size_t FRAMES_PER_ENCODING_THREAD = 2;
+
+// A captured frame waiting to be written out. FileNames are only used by
+// image series, which name each frame when it is captured.
+struct Frame
+{
+  vtkSmartPointer<vtkImageData> Images[2];
+  std::string FileNames[2];
+};
+
+// Writes the frames handed over by a FrameEncodingQueue. An encoder is only
+// ever used by a single worker thread, which calls Finalize() once all frames
+// have been written.
+class FrameEncoder
+{
+public:
+  virtual ~FrameEncoder() {}
+  virtual bool Encode(const Frame& frame) = 0;
+  virtual bool Finalize() { return true; }
+};
+
+/**
+ * Bounded queue of frames encoded and written by worker threads, one per
+ * encoder, while the next frames are being rendered. Push() blocks while the
+ * queue is full so that captured images do not pile up in memory when encoding
+ * is slower than rendering. Frames are dequeued in the order they were pushed,
+ * hence a single encoder writes them in order, as movie writers require.
+ *
+ * Once a frame fails to be written, the frames still queued are dropped and
+ * Push() returns false so that the animation can be stopped.
+ */
+class FrameEncodingQueue
+{
+public:
+  FrameEncodingQueue()
+    : Capacity(1)
+    , Done(false)
+    , Failed(false)
+  {
+  }
+  ~FrameEncodingQueue() { this->Finish(); }
+
+  void Start(std::vector<std::unique_ptr<FrameEncoder> > encoders)
+  {
+    assert(this->Workers.empty());
+    this->Encoders = std::move(encoders);
+    this->Capacity = std::max<size_t>(1, FRAMES_PER_ENCODING_THREAD * this->Encoders.size());
+    this->Done = false;
+    this->Failed = false;
+    for (auto& encoder : this->Encoders)
+    {
+      this->Workers.emplace_back(&FrameEncodingQueue::Run, this, encoder.get());
+    }
+  }
+
+  bool Push(Frame&& frame)
+  {
+    std::unique_lock<std::mutex> lock(this->Mutex);
+    this->NotFull.wait(
+      lock, [this]() { return this->Failed || this->Frames.size() < this->Capacity; });
+    if (this->Failed)
+    {
+      return false;
+    }
+    this->Frames.push_back(std::move(frame));
+    this->NotEmpty.notify_one();
+    return true;
+  }
+
+  /**
+   * Waits for all queued frames to be written, then finalizes the encoders
+   * and stops the worker threads. Returns false if any frame failed to be
+   * written.
+   */
+  bool Finish()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Done = true;
+    }
+    this->NotEmpty.notify_all();
+    for (auto& worker : this->Workers)
+    {
+      worker.join();
+    }
+    this->Workers.clear();
+    this->Encoders.clear();
+    return !this->Failed;
+  }
+
+private:
+  FrameEncodingQueue(const FrameEncodingQueue&) = delete;
+  void operator=(const FrameEncodingQueue&) = delete;
+
+  void Run(FrameEncoder* encoder)
+  {
+    while (true)
+    {
+      Frame frame;
+      bool skip;
+      {
+        std::unique_lock<std::mutex> lock(this->Mutex);
+        this->NotEmpty.wait(lock, [this]() { return this->Done || !this->Frames.empty(); });
+        if (this->Frames.empty())
+        {
+          break;
+        }
+        frame = std::move(this->Frames.front());
+        this->Frames.pop_front();
+        skip = this->Failed;
+      }
+      this->NotFull.notify_one();
+      if (!skip && !encoder->Encode(frame))
+      {
+        this->SetFailed();
+      }
+    }
+    if (!encoder->Finalize())
+    {
+      this->SetFailed();
+    }
+  }
+
+  void SetFailed()
+  {
+    {
+      std::lock_guard<std::mutex> lock(this->Mutex);
+      this->Failed = true;
+    }
+    this->NotFull.notify_all();
+  }
+
+  std::vector<std::unique_ptr<FrameEncoder> > Encoders;
+  std::vector<std::thread> Workers;
+  std::deque<Frame> Frames;
+  size_t Capacity;
+  bool Done;
+  bool Failed;
+  std::mutex Mutex;
+  std::condition_variable NotEmpty;
+  std::condition_variable NotFull;
+};
+}
+
+#endif
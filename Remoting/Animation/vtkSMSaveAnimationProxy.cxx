@@ -29,6 +29,7 @@
 #include "vtkRenderWindow.h"
 #include "vtkSMAnimationScene.h"
 #include "vtkSMAnimationSceneWriter.h"
+#include "vtkSMFrameEncodingQueue.h"
 #include "vtkSMParaViewPipelineController.h"
 #include "vtkSMProperty.h"
 #include "vtkSMPropertyHelper.h"
@@ -39,7 +40,11 @@
 #include "vtkSMViewLayoutProxy.h"
 #include "vtkSMViewProxy.h"
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
 #include <vtksys/SystemTools.hxx>
 
 namespace vtkSMSaveAnimationProxyNS
@@ -62,6 +67,16 @@ public:
   }
 };
 
+// Maximum number of threads used to encode and write image series.
+const int MAX_ENCODING_THREADS = 4;
+
+int GetNumberOfEncodingThreads()
+{
+  const int numCores = static_cast<int>(std::thread::hardware_concurrency());
+  // keep a core for the rendering thread.
+  return std::max(1, std::min(numCores - 1, MAX_ENCODING_THREADS));
+}
+
 template <class T>
 class SceneImageWriter : public vtkSMAnimationSceneWriter
 {
@@ -83,10 +98,14 @@ protected:
     // since it's a waste of rendering, the code to save the images will call
     // render anyways.
     this->AnimationScene->SetOverrideStillRender(1);
+
+    // Frames are written by background threads while the next ones are
+    // rendered.
+    this->Queue.Start(this->CreateEncoders());
     return true;
   }
 
-  bool SaveFrame(double time) override
+  bool SaveFrame(double vtkNotUsed(time)) override
   {
     auto image_pair = Friendship::Grab(this->Helper);
 
@@ -101,16 +120,29 @@ protected:
       return true;
     }
 
-    return this->WriteFrameImage(time, image_pair.first, image_pair.second);
+    Frame frame;
+    frame.Images[0] = image_pair.first;
+    frame.Images[1] = image_pair.second;
+    this->PrepareFrame(frame);
+    return this->Queue.Push(std::move(frame));
   }
 
   bool SaveFinalize() override
   {
+    const bool status = this->Queue.Finish();
     this->AnimationScene->SetOverrideStillRender(0);
-    return true;
+    return status;
   }
 
-  virtual bool WriteFrameImage(double time, vtkImageData* dataLeft, vtkImageData* dataRight) = 0;
+  /**
+   * Returns the encoders writing the frames, one per encoding thread.
+   */
+  virtual std::vector<std::unique_ptr<FrameEncoder> > CreateEncoders() = 0;
+
+  /**
+   * Called on each captured frame before it is queued for encoding.
+   */
+  virtual void PrepareFrame(Frame& vtkNotUsed(frame)) {}
 
   std::string GetStereoFileName(const std::string& filename, bool left)
   {
@@ -120,54 +152,33 @@ protected:
 private:
   SceneImageWriter(const SceneImageWriter&) = delete;
   void operator=(const SceneImageWriter&) = delete;
+
+  FrameEncodingQueue Queue;
 };
 
-class SceneImageWriterMovie : public SceneImageWriter<vtkGenericMovieWriter>
+// Writes the frames to the movie writers, one per eye, on a single thread.
+class MovieFrameEncoder : public FrameEncoder
 {
-  vtkGenericMovieWriter* Writers[2] = { nullptr, nullptr };
+  vtkGenericMovieWriter* Writers[2];
+  bool Started;
 
 public:
-  static SceneImageWriterMovie* New();
-  vtkTypeMacro(SceneImageWriterMovie, SceneImageWriter<vtkGenericMovieWriter>);
-
-  /**
-   * Set the writer to use.
-   */
-  void SetWriter(int index, vtkGenericMovieWriter* writer) { this->Writers[index] = writer; }
-
-protected:
-  SceneImageWriterMovie()
+  MovieFrameEncoder(vtkGenericMovieWriter* writers[2])
     : Started(false)
   {
+    this->Writers[0] = writers[0];
+    this->Writers[1] = writers[1];
   }
-  ~SceneImageWriterMovie() {}
 
-  bool SaveInitialize(int startCount) override
+  bool Encode(const Frame& frame) override
   {
-    std::string fname = this->GetFileName();
-    if (auto rWriter = this->Writers[1])
-    {
-      rWriter->SetFileName(this->GetStereoFileName(fname, /*left=*/false).c_str());
-      fname = this->GetStereoFileName(fname, true);
-    }
-
-    auto* writer = this->Writers[0];
-    assert(writer != nullptr);
-    writer->SetFileName(fname.c_str());
-    return this->Superclass::SaveInitialize(startCount);
-  }
-
-  bool WriteFrameImage(
-    double vtkNotUsed(time), vtkImageData* dataLeft, vtkImageData* dataRight) override
-  {
-    vtkImageData* data[] = { dataLeft, dataRight };
     bool status = true;
     for (int cc = 0; cc < 2; ++cc)
     {
       if (auto* writer = this->Writers[cc])
       {
-        assert(data[cc] != nullptr);
-        writer->SetInputData(data[cc]);
+        assert(frame.Images[cc] != nullptr);
+        writer->SetInputData(frame.Images[cc]);
         if (!this->Started)
         {
           writer->Start(); // start needs input data, hence we do it here.
@@ -181,7 +192,7 @@ protected:
     return status;
   }
 
-  bool SaveFinalize() override
+  bool Finalize() override
   {
     if (this->Started)
     {
@@ -194,20 +205,98 @@ protected:
       }
     }
     this->Started = false;
-    return this->Superclass::SaveFinalize();
+    return true;
+  }
+};
+
+class SceneImageWriterMovie : public SceneImageWriter<vtkGenericMovieWriter>
+{
+  vtkGenericMovieWriter* Writers[2] = { nullptr, nullptr };
+
+public:
+  static SceneImageWriterMovie* New();
+  vtkTypeMacro(SceneImageWriterMovie, SceneImageWriter<vtkGenericMovieWriter>);
+
+  /**
+   * Set the writer to use.
+   */
+  void SetWriter(int index, vtkGenericMovieWriter* writer) { this->Writers[index] = writer; }
+
+protected:
+  SceneImageWriterMovie() {}
+  ~SceneImageWriterMovie() {}
+
+  bool SaveInitialize(int startCount) override
+  {
+    std::string fname = this->GetFileName();
+    if (auto rWriter = this->Writers[1])
+    {
+      rWriter->SetFileName(this->GetStereoFileName(fname, /*left=*/false).c_str());
+      fname = this->GetStereoFileName(fname, true);
+    }
+
+    auto* writer = this->Writers[0];
+    assert(writer != nullptr);
+    writer->SetFileName(fname.c_str());
+    return this->Superclass::SaveInitialize(startCount);
+  }
+
+  std::vector<std::unique_ptr<FrameEncoder> > CreateEncoders() override
+  {
+    // movie streams are written sequentially, a single encoder keeps the
+    // frames in order.
+    std::vector<std::unique_ptr<FrameEncoder> > encoders;
+    encoders.emplace_back(new MovieFrameEncoder(this->Writers));
+    return encoders;
   }
 
 private:
   SceneImageWriterMovie(const SceneImageWriterMovie&) = delete;
   void operator=(const SceneImageWriterMovie&) = delete;
-  bool Started;
 };
 vtkStandardNewMacro(SceneImageWriterMovie);
 
-class SceneImageWriterImageSeries : public SceneImageWriter<vtkImageWriter>
+// Writes each frame to the files named by SceneImageWriterImageSeries.
+class ImageFrameEncoder : public FrameEncoder
 {
   vtkImageWriter* Writer;
 
+public:
+  ImageFrameEncoder(vtkImageWriter* writer)
+    : Writer(writer)
+  {
+  }
+
+  bool Encode(const Frame& frame) override
+  {
+    bool success = true;
+
+    auto writer = this->Writer;
+    assert(frame.Images[0]);
+    assert(writer);
+
+    // write right-eye image first.
+    if (frame.Images[1])
+    {
+      writer->SetInputData(frame.Images[1]);
+      writer->SetFileName(frame.FileNames[1].c_str());
+      writer->Write();
+      success &= (writer->GetErrorCode() == vtkErrorCode::NoError);
+    }
+    writer->SetFileName(frame.FileNames[0].c_str());
+    writer->SetInputData(frame.Images[0]);
+    writer->Write();
+    writer->SetInputData(nullptr);
+
+    success &= writer->GetErrorCode() == vtkErrorCode::NoError;
+    return success;
+  }
+};
+
+class SceneImageWriterImageSeries : public SceneImageWriter<vtkImageWriter>
+{
+  std::vector<vtkImageWriter*> Writers;
+
 public:
   static SceneImageWriterImageSeries* New();
   vtkTypeMacro(SceneImageWriterImageSeries, SceneImageWriter<vtkImageWriter>);
@@ -219,9 +308,10 @@ public:
   vtkGetStringMacro(SuffixFormat);
 
   /**
-   * Set the writer to use.
+   * Add a writer to use. Frames are written in parallel, each writer being
+   * used by its own thread.
    */
-  void SetWriter(vtkImageWriter* writer) { this->Writer = writer; }
+  void AddWriter(vtkImageWriter* writer) { this->Writers.push_back(writer); }
 
 protected:
   SceneImageWriterImageSeries()
@@ -241,41 +331,36 @@ protected:
     return this->Superclass::SaveInitialize(startCount);
   }
 
-  bool WriteFrameImage(
-    double vtkNotUsed(time), vtkImageData* dataLeft, vtkImageData* dataRight) override
+  std::vector<std::unique_ptr<FrameEncoder> > CreateEncoders() override
   {
-    bool success = true;
+    assert(!this->Writers.empty());
+    std::vector<std::unique_ptr<FrameEncoder> > encoders;
+    for (auto writer : this->Writers)
+    {
+      encoders.emplace_back(new ImageFrameEncoder(writer));
+    }
+    return encoders;
+  }
 
-    auto writer = this->Writer;
-    assert(dataLeft);
+  void PrepareFrame(Frame& frame) override
+  {
     assert(this->SuffixFormat);
-    assert(writer);
 
     char buffer[1024];
-    snprintf(buffer, 1024, this->SuffixFormat, this->Counter);
+    snprintf(buffer, 1024, this->SuffixFormat, this->Counter++);
 
     std::ostringstream str;
     str << this->Prefix << buffer << this->Extension;
 
     std::string fname = str.str();
-    if (dataRight)
+    if (frame.Images[1])
     {
-      writer->SetInputData(dataRight);
-      writer->SetFileName(this->GetStereoFileName(fname, /*left*/ false).c_str());
-      writer->Write();
-      success &= (writer->GetErrorCode() == vtkErrorCode::NoError);
+      frame.FileNames[1] = this->GetStereoFileName(fname, /*left*/ false);
 
       // update fname for left image.
       fname = this->GetStereoFileName(fname, /*left=*/true);
     }
-    writer->SetFileName(fname.c_str());
-    writer->SetInputData(dataLeft);
-    writer->Write();
-    writer->SetInputData(nullptr);
-
-    success &= writer->GetErrorCode() == vtkErrorCode::NoError;
-    this->Counter += success ? 1 : 0;
-    return success;
+    frame.FileNames[0] = fname;
   }
 
 private:
@@ -389,6 +474,19 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
   // check if we're writing 2-stereo video streams at the same time.
   vtkSmartPointer<vtkSMProxy> otherFormatProxy;
 
+  // additional format proxies providing the writers of the encoding threads.
+  std::vector<vtkSmartPointer<vtkSMProxy> > encodingFormatProxies;
+
+  auto pxm = this->GetSessionProxyManager();
+  auto cloneFormatProxy = [pxm, formatProxy]() -> vtkSmartPointer<vtkSMProxy> {
+    vtkSmartPointer<vtkSMProxy> proxy;
+    proxy.TakeReference(pxm->NewProxy(formatProxy->GetXMLGroup(), formatProxy->GetXMLName()));
+    proxy->SetLocation(formatProxy->GetLocation());
+    proxy->Copy(formatProxy);
+    proxy->UpdateVTKObjects();
+    return proxy;
+  };
+
   // based on the format, we create an appropriate SceneImageWriter.
   auto formatObj = formatProxy->GetClientSideObject();
   if (auto imgWriter = vtkImageWriter::SafeDownCast(formatObj))
@@ -396,7 +494,16 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
     vtkNew<vtkSMSaveAnimationProxyNS::SceneImageWriterImageSeries> realWriter;
     realWriter->SetSuffixFormat(vtkSMPropertyHelper(formatProxy, "SuffixFormat").GetAsString());
     realWriter->SetHelper(this);
-    realWriter->SetWriter(imgWriter);
+    realWriter->AddWriter(imgWriter);
+
+    // images are written by several threads, each one needs its own writer.
+    const int numThreads = vtkSMSaveAnimationProxyNS::GetNumberOfEncodingThreads();
+    for (int cc = 1; cc < numThreads; ++cc)
+    {
+      auto otherProxy = cloneFormatProxy();
+      encodingFormatProxies.push_back(otherProxy);
+      realWriter->AddWriter(vtkImageWriter::SafeDownCast(otherProxy->GetClientSideObject()));
+    }
     writer = realWriter;
   }
   else if (auto movieWriter = vtkGenericMovieWriter::SafeDownCast(formatObj))
@@ -408,12 +515,7 @@ bool vtkSMSaveAnimationProxy::WriteAnimationLocally(const char* filename)
     // we need two movie writers when writing stereo videos
     if (vtkSMPropertyHelper(this, "StereoMode").GetAsInt() == VTK_STEREO_EMULATE)
     {
-      auto pxm = this->GetSessionProxyManager();
-      otherFormatProxy.TakeReference(
-        pxm->NewProxy(formatProxy->GetXMLGroup(), formatProxy->GetXMLName()));
-      otherFormatProxy->SetLocation(formatProxy->GetLocation());
-      otherFormatProxy->Copy(formatProxy);
-      otherFormatProxy->UpdateVTKObjects();
+      otherFormatProxy = cloneFormatProxy();
       realWriter->SetWriter(
         1, vtkGenericMovieWriter::SafeDownCast(otherFormatProxy->GetClientSideObject()));
     }
@@ -0,0 +1,211 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestMethodDispatch.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Micro-benchmark comparing the two ways wrapped methods can be dispatched:
+// the chain of string comparisons the client/server wrappers used to generate
+// and the switch on the method name hash they generate now. Both dispatchers
+// are registered as command functions and exercised through the interpreter,
+// so the cost of looking up the command function is included.
+
+#include "vtkClientServerInterpreter.h"
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+#include "vtkObject.h"
+#include "vtkTimerLog.h"
+
+#include <cstring>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+// A set of method names typical of a large wrapped class.
+#define BENCHMARK_METHODS(X)                                                                       \
+  X(AddArrayName) X(AddInputConnection) X(GetAbortExecute) X(GetClassName) X(GetDebug)             \
+    X(GetErrorCode) X(GetInformation) X(GetInputArrayInformation) X(GetMTime)                     \
+      X(GetNumberOfInputPorts) X(GetNumberOfOutputPorts) X(GetOutputDataObject) X(GetProgress)    \
+        X(GetReferenceCount) X(GetReleaseDataFlag) X(HasObserver) X(InvokeEvent) X(IsA)           \
+          X(Modified) X(PrintRevisions) X(RemoveAllInputConnections) X(RemoveAllInputs)           \
+            X(RemoveObserver) X(SetAbortExecute) X(SetArrayName) X(SetCellArrayStatus)            \
+              X(SetDebug) X(SetFileName) X(SetGlobalWarningDisplay) X(SetInputArrayToProcess)     \
+                X(SetInputConnection) X(SetInputData) X(SetNumberOfPieces) X(SetPiece)            \
+                  X(SetPointArrayStatus) X(SetProgress) X(SetProgressText) X(SetReleaseDataFlag)  \
+                    X(SetScalarRange) X(SetTimeValue) X(SetUpdateExtent) X(SetVisibility)         \
+                      X(Update) X(UpdateInformation) X(UpdatePiece) X(UpdateTimeStep)             \
+                        X(UpdateWholeExtent)
+
+namespace
+{
+// Compile-time version of vtkClientServerInterpreter::HashMethodName, so that
+// case labels can be written the way the wrapper generator emits them.
+constexpr vtkTypeUInt32 Hash(const char* name, vtkTypeUInt32 hash = 2166136261u)
+{
+  return *name ? Hash(name + 1, (hash ^ static_cast<unsigned char>(*name)) * 16777619u) : hash;
+}
+
+#define BENCHMARK_NAME(name) #name,
+const char* const MethodNames[] = { BENCHMARK_METHODS(BENCHMARK_NAME) };
+#undef BENCHMARK_NAME
+const int NumberOfMethods = static_cast<int>(sizeof(MethodNames) / sizeof(MethodNames[0]));
+
+// Name of the method found by the last dispatch.
+const char* LastMethod = nullptr;
+
+int ChainDispatch(vtkClientServerInterpreter*, vtkObjectBase*, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream&, void*)
+{
+#define BENCHMARK_CHAIN(name)                                                                      \
+  if (!strcmp(#name, method) && msg.GetNumberOfArguments(0) == 2)                                  \
+  {                                                                                                \
+    LastMethod = #name;                                                                            \
+    return 1;                                                                                      \
+  }
+  BENCHMARK_METHODS(BENCHMARK_CHAIN)
+#undef BENCHMARK_CHAIN
+  return 0;
+}
+
+int HashDispatch(vtkClientServerInterpreter*, vtkObjectBase*, const char* method,
+  const vtkClientServerStream& msg, vtkClientServerStream&, void*)
+{
+  switch (vtkClientServerInterpreter::HashMethodName(method))
+  {
+#define BENCHMARK_CASE(name)                                                                       \
+  case Hash(#name):                                                                                \
+    if (!strcmp(#name, method) && msg.GetNumberOfArguments(0) == 2)                                \
+    {                                                                                              \
+      LastMethod = #name;                                                                          \
+      return 1;                                                                                    \
+    }                                                                                              \
+    break;
+    BENCHMARK_METHODS(BENCHMARK_CASE)
+#undef BENCHMARK_CASE
+    default:
+      break;
+  }
+  return 0;
+}
+
+bool Dispatched(const char* method)
+{
+  return LastMethod != nullptr && strcmp(LastMethod, method) == 0;
+}
+}
+
+int TestMethodDispatch(int, char* [])
+{
+  // Make sure the compile-time hash matches the one used at run-time.
+  for (int cc = 0; cc < NumberOfMethods; ++cc)
+  {
+    if (Hash(MethodNames[cc]) != vtkClientServerInterpreter::HashMethodName(MethodNames[cc]))
+    {
+      cerr << "ERROR: hash mismatch for " << MethodNames[cc] << endl;
+      return TEST_FAILED;
+    }
+  }
+  // Reference values of the 32-bit FNV-1a hash.
+  if (vtkClientServerInterpreter::HashMethodName("") != 0x811c9dc5u ||
+    vtkClientServerInterpreter::HashMethodName("a") != 0xe40c292cu)
+  {
+    cerr << "ERROR: unexpected method name hash." << endl;
+    return TEST_FAILED;
+  }
+
+  vtkNew<vtkClientServerInterpreter> interp;
+  // Register the two dispatchers under the names of classes that are
+  // otherwise unknown to this interpreter.
+  interp->AddCommandFunction("vtkObject", ChainDispatch);
+  interp->AddCommandFunction("vtkDataObject", HashDispatch);
+
+  vtkObject* chainObject = vtkObject::New();
+  interp->NewInstance(chainObject, vtkClientServerID(1));
+
+  // GetClassName() of the second object is "vtkObject" as well, so the
+  // command function is called explicitly for it.
+  vtkNew<vtkObject> hashObject;
+
+  vtkClientServerStream results;
+  const int iterations = 2000;
+  vtkNew<vtkTimerLog> timer;
+
+  // Dispatch through ProcessStream, which resolves the command function for
+  // the object ID once and reuses it.
+  timer->StartTimer();
+  for (int iter = 0; iter < iterations; ++iter)
+  {
+    for (int cc = 0; cc < NumberOfMethods; ++cc)
+    {
+      vtkClientServerStream stream;
+      stream << vtkClientServerStream::Invoke << vtkClientServerID(1) << MethodNames[cc]
+             << vtkClientServerStream::End;
+      LastMethod = nullptr;
+      if (!interp->ProcessStream(stream) || !Dispatched(MethodNames[cc]))
+      {
+        cerr << "ERROR: string compare dispatch failed for " << MethodNames[cc] << endl;
+        return TEST_FAILED;
+      }
+    }
+  }
+  timer->StopTimer();
+  const double streamTime = timer->GetElapsedTime();
+
+  double chainTime = 0;
+  double hashTime = 0;
+  for (int pass = 0; pass < 2; ++pass)
+  {
+    const char* cname = pass == 0 ? "vtkObject" : "vtkDataObject";
+    vtkObjectBase* obj = pass == 0 ? static_cast<vtkObjectBase*>(chainObject) : hashObject.Get();
+    timer->StartTimer();
+    for (int iter = 0; iter < iterations; ++iter)
+    {
+      for (int cc = 0; cc < NumberOfMethods; ++cc)
+      {
+        vtkClientServerStream msg;
+        msg << vtkClientServerStream::Invoke << obj << MethodNames[cc]
+            << vtkClientServerStream::End;
+        LastMethod = nullptr;
+        if (!interp->CallCommandFunction(cname, obj, MethodNames[cc], msg, results) ||
+          !Dispatched(MethodNames[cc]))
+        {
+          cerr << "ERROR: dispatch failed for " << MethodNames[cc] << " (" << cname << ")" << endl;
+          return TEST_FAILED;
+        }
+      }
+    }
+    timer->StopTimer();
+    (pass == 0 ? chainTime : hashTime) = timer->GetElapsedTime();
+  }
+
+  // Unknown methods must not be dispatched by either implementation.
+  vtkClientServerStream unknown;
+  unknown << vtkClientServerStream::Invoke << chainObject << "NotAMethod"
+          << vtkClientServerStream::End;
+  if (interp->CallCommandFunction("vtkObject", chainObject, "NotAMethod", unknown, results) ||
+    interp->CallCommandFunction("vtkDataObject", hashObject, "NotAMethod", unknown, results))
+  {
+    cerr << "ERROR: unknown method was dispatched." << endl;
+    return TEST_FAILED;
+  }
+
+  const double calls = static_cast<double>(iterations) * NumberOfMethods;
+  cout << "Dispatching " << calls << " calls over " << NumberOfMethods << " methods:" << endl
+       << "  string compare chain: " << chainTime << "s" << endl
+       << "  method name hash:     " << hashTime << "s" << endl
+       << "  through ProcessStream (string compare chain): " << streamTime << "s" << endl;
+
+  vtkClientServerStream deleteStream;
+  deleteStream << vtkClientServerStream::Delete << vtkClientServerID(1)
+               << vtkClientServerStream::End;
+  interp->ProcessStream(deleteStream);
+  return TEST_SUCCESS;
+}
@@ -0,0 +1,149 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestStreamThroughput.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Benchmark for building and parsing vtkClientServerStream, mimicking the
+// streams sent for proxy property updates: many short-lived streams each
+// holding a handful of Invoke messages. Timings are reported with and without
+// the buffer pool.
+
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+#include "vtkTimerLog.h"
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+const int NumberOfMessages = 8;
+
+void BuildStream(vtkClientServerStream& stream, int iteration)
+{
+  const double position[3] = { 1.0, 2.0, static_cast<double>(iteration) };
+  double values[64];
+  for (int cc = 0; cc < 64; ++cc)
+  {
+    values[cc] = cc * 0.5;
+  }
+
+  for (int cc = 0; cc < NumberOfMessages; ++cc)
+  {
+    stream << vtkClientServerStream::Invoke << vtkClientServerID(cc + 1);
+    switch (cc % 4)
+    {
+      case 0:
+        stream << "SetPosition" << vtkClientServerStream::InsertArray(position, 3);
+        break;
+      case 1:
+        stream << "SetScalarRange" << vtkClientServerStream::InsertArray(values, 64);
+        break;
+      case 2:
+        stream << "SetFileName"
+               << "/path/to/some/data/file.vtu";
+        break;
+      default:
+        stream << "SetVisibility" << iteration;
+        break;
+    }
+    stream << vtkClientServerStream::End;
+  }
+}
+
+// Transfers the stream in binary form, as done between processes, and checks
+// a few arguments of the received copy.
+bool ParseStream(const vtkClientServerStream& stream, int iteration)
+{
+  const unsigned char* data;
+  size_t length;
+  if (!stream.GetData(&data, &length))
+  {
+    return false;
+  }
+
+  vtkClientServerStream received;
+  if (!received.SetData(data, length) || received.GetNumberOfMessages() != NumberOfMessages)
+  {
+    return false;
+  }
+
+  double position[3];
+  const char* fileName;
+  int visibility;
+  return received.GetArgument(0, 2, position, 3) && position[2] == iteration &&
+    received.GetArgument(2, 2, &fileName) && received.GetArgument(3, 2, &visibility) &&
+    visibility == iteration;
+}
+
+bool Run(int iterations, double& buildTime, double& parseTime)
+{
+  vtkNew<vtkTimerLog> timer;
+  buildTime = parseTime = 0;
+  for (int iter = 0; iter < iterations; ++iter)
+  {
+    timer->StartTimer();
+    vtkClientServerStream stream;
+    BuildStream(stream, iter);
+    timer->StopTimer();
+    buildTime += timer->GetElapsedTime();
+
+    timer->StartTimer();
+    bool valid = ParseStream(stream, iter);
+    timer->StopTimer();
+    parseTime += timer->GetElapsedTime();
+    if (!valid)
+    {
+      cerr << "ERROR: stream " << iter << " did not round trip." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestStreamThroughput(int, char* [])
+{
+  const int iterations = 20000;
+  const int poolSize = vtkClientServerStream::GetBufferPoolSize();
+
+  // A reset stream must be reusable.
+  vtkClientServerStream stream;
+  BuildStream(stream, 1);
+  stream.Reset();
+  BuildStream(stream, 2);
+  if (!ParseStream(stream, 2))
+  {
+    cerr << "ERROR: reset stream did not round trip." << endl;
+    return TEST_FAILED;
+  }
+
+  double buildTime, parseTime;
+  vtkClientServerStream::SetBufferPoolSize(0);
+  if (!Run(iterations, buildTime, parseTime))
+  {
+    return TEST_FAILED;
+  }
+  cout << "Without buffer pool: build " << buildTime << "s, transfer and parse " << parseTime
+       << "s" << endl;
+
+  vtkClientServerStream::SetBufferPoolSize(poolSize > 0 ? poolSize : 16);
+  if (!Run(iterations, buildTime, parseTime))
+  {
+    return TEST_FAILED;
+  }
+  cout << "With buffer pool:    build " << buildTime << "s, transfer and parse " << parseTime
+       << "s" << endl;
+
+  vtkClientServerStream::SetBufferPoolSize(poolSize);
+  return TEST_SUCCESS;
+}
@@ -25,6 +25,8 @@
 #include <map>
 #include <sstream>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 vtkStandardNewMacro(vtkClientServerInterpreter);
@@ -76,6 +78,68 @@ public:
   NewInstanceFunctionsType NewInstanceFunctions;
   ClassToFunctionMapType ClassToFunctionMap;
   IDToMessageMapType IDToMessageMap;
+
+  // Command functions are looked up for every Invoke, and once more for
+  // every superclass the generated code falls back to. Class names are
+  // almost always string literals, so resolved entries are cached by the
+  // address of the name. The name is still compared on a hit since the
+  // address may be that of a buffer which has been reused since.
+  typedef std::unordered_map<const char*, ClassToFunctionMapType::const_iterator>
+    CommandFunctionCacheType;
+  CommandFunctionCacheType CommandFunctionCache;
+
+  // Command function resolved for the object of each ID that was invoked.
+  typedef std::unordered_map<vtkTypeUInt32, std::pair<vtkObjectBase*, const CommandFunction*> >
+    IDToCommandFunctionMapType;
+  IDToCommandFunctionMapType IDToCommandFunctionMap;
+
+  const CommandFunction* FindCommandFunction(const char* cname)
+  {
+    CommandFunctionCacheType::const_iterator cached = this->CommandFunctionCache.find(cname);
+    if (cached != this->CommandFunctionCache.end() && cached->second->first == cname)
+    {
+      return cached->second->second;
+    }
+    ClassToFunctionMapType::const_iterator iter = this->ClassToFunctionMap.find(cname);
+    if (iter == this->ClassToFunctionMap.end())
+    {
+      return nullptr;
+    }
+    if (this->CommandFunctionCache.size() >= 4 * this->ClassToFunctionMap.size())
+    {
+      // names from transient buffers must not make the cache grow forever.
+      this->CommandFunctionCache.clear();
+    }
+    this->CommandFunctionCache[cname] = iter;
+    return iter->second;
+  }
+
+  const CommandFunction* FindCommandFunction(vtkTypeUInt32 id, vtkObjectBase* obj)
+  {
+    if (id == 0)
+    {
+      return this->FindCommandFunction(obj->GetClassName());
+    }
+    IDToCommandFunctionMapType::const_iterator cached = this->IDToCommandFunctionMap.find(id);
+    if (cached != this->IDToCommandFunctionMap.end() && cached->second.first == obj)
+    {
+      return cached->second.second;
+    }
+    const CommandFunction* function = this->FindCommandFunction(obj->GetClassName());
+    if (function)
+    {
+      this->IDToCommandFunctionMap[id] = std::make_pair(obj, function);
+    }
+    return function;
+  }
+
+  static int Call(const CommandFunction* command, vtkClientServerInterpreter* self,
+    vtkObjectBase* ptr, const char* method, const vtkClientServerStream& msg,
+    vtkClientServerStream& result)
+  {
+    void* ctx = command->Context ? command->Context->Context : 0;
+    return command->Function(self, ptr, method, msg, result, ctx);
+  }
 };
 
 //----------------------------------------------------------------------------
@@ -404,6 +468,15 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
   // result.  Reset the result to empty before processing the message.
   this->LastResultMessage->Reset();
 
+  // Keep track of the ID the object was referred to, if any, to reuse the
+  // command function resolved by previous invocations.
+  vtkClientServerID objectId;
+  if (css.GetNumberOfArguments(midx) >= 1 &&
+    css.GetArgumentType(midx, 0) == vtkClientServerStream::id_value)
+  {
+    css.GetArgument(midx, 0, &objectId);
+  }
+
   // Get the object and method to be invoked.
   vtkObjectBase* obj;
   const char* method;
@@ -419,10 +492,12 @@ int vtkClientServerInterpreter::ProcessCommandInvoke(const vtkClientServerStream
     }
 
     // Find the command function for this object's type.
-    if (obj && this->HasCommandFunction(obj->GetClassName()))
+    const vtkClientServerInterpreterInternals::CommandFunction* command =
+      obj ? this->Internal->FindCommandFunction(objectId.ID, obj) : nullptr;
+    if (command)
     {
-      if (this->CallCommandFunction(
-            obj->GetClassName(), obj, method, msg, *this->LastResultMessage))
+      if (vtkClientServerInterpreterInternals::Call(
+            command, this, obj, method, msg, *this->LastResultMessage))
       {
         return 1;
       }
@@ -499,6 +574,7 @@ int vtkClientServerInterpreter::ProcessCommandDelete(const vtkClientServerStream
 
     // Remove the ID from the map.
     this->Internal->IDToMessageMap.erase(id.ID);
+    this->Internal->IDToCommandFunctionMap.erase(id.ID);
 
     // Delete the entry's value.
     delete item;
@@ -786,27 +862,23 @@ bool vtkClientServerInterpreter::HasCommandFunction(const char* cname)
   {
     return false;
   }
-  return (this->Internal->ClassToFunctionMap.count(cname) > 0);
+  return this->Internal->FindCommandFunction(cname) != nullptr;
 }
 
 //----------------------------------------------------------------------------
 int vtkClientServerInterpreter::CallCommandFunction(const char* cname, vtkObjectBase* ptr,
   const char* method, const vtkClientServerStream& msg, vtkClientServerStream& result)
 {
-  vtkClientServerInterpreterInternals::ClassToFunctionMapType::const_iterator f =
-    this->Internal->ClassToFunctionMap.find(cname);
+  const vtkClientServerInterpreterInternals::CommandFunction* n =
+    this->Internal->FindCommandFunction(cname);
 
-  if (f == this->Internal->ClassToFunctionMap.end())
+  if (!n)
   {
     vtkErrorMacro("Cannot find command function for \"" << cname << "\".");
     return 1;
   }
 
-  const vtkClientServerInterpreterInternals::CommandFunction* n = f->second;
-
-  vtkClientServerCommandFunction function = n->Function;
-  void* ctx = n->Context ? n->Context->Context : 0;
-  return function(this, ptr, method, msg, result, ctx);
+  return vtkClientServerInterpreterInternals::Call(n, this, ptr, method, msg, result);
 }
 
 void vtkClientServerInterpreter::AddNewInstanceFunction(const char* name,
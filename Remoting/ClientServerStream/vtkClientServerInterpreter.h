@@ -149,6 +149,22 @@ public:
   int CallCommandFunction(const char* classname, vtkObjectBase* ptr, const char* method,
     const vtkClientServerStream& msg, vtkClientServerStream& result);
 
+  /**
+   * Hash of a method name used by the generated wrapper code to dispatch
+   * method calls. This is the 32-bit FNV-1a hash and must match the one
+   * computed by vtkWrapClientServer when generating the wrappers.
+   */
+  static vtkTypeUInt32 HashMethodName(const char* method)
+  {
+    vtkTypeUInt32 hash = 2166136261u;
+    for (; *method; ++method)
+    {
+      hash ^= static_cast<unsigned char>(*method);
+      hash *= 16777619u;
+    }
+    return hash;
+  }
+
   /**
    * Add a function used to create new objects.
    */
@@ -24,6 +24,7 @@
 #include "vtkVariantExtract.h"
 
 #include <algorithm>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <typeinfo>
@@ -136,7 +137,9 @@ public:
   vtkClientServerStreamInternals(vtkObjectBase* owner)
     : Objects(owner)
   {
+    this->AcquireBuffers();
   }
+  ~vtkClientServerStreamInternals() { this->ReleaseBuffers(); }
   vtkClientServerStreamInternals(const vtkClientServerStreamInternals& r, vtkObjectBase* owner)
     : Data(r.Data)
     , ValueOffsets(r.ValueOffsets)
@@ -237,6 +240,78 @@ public:
   // Buffer for return value from StreamToString.
   std::string String;
 
+  // Streams are mostly short-lived: they are built, sent or processed and
+  // discarded. Destroyed streams give their buffers to a process-wide pool
+  // that new streams take them from, so that the memory grown by previous
+  // streams is reused instead of being allocated again. Buffers larger than
+  // MaximumRetainedCapacity are not kept to bound the memory held.
+  static const size_t MaximumRetainedCapacity = 1 << 20;
+  struct BufferPoolType
+  {
+    std::mutex Mutex;
+    size_t MaximumSize = 16;
+    std::vector<DataType> Data;
+    std::vector<ValueOffsetsType> ValueOffsets;
+    std::vector<MessageIndexesType> MessageIndexes;
+  };
+  static BufferPoolType& GetBufferPool()
+  {
+    // Intentionally leaked: streams may be destroyed during static
+    // destruction, after a static pool would have been.
+    static BufferPoolType* pool = new BufferPoolType;
+    return *pool;
+  }
+
+  void AcquireBuffers()
+  {
+    BufferPoolType& pool = vtkClientServerStreamInternals::GetBufferPool();
+    std::lock_guard<std::mutex> lock(pool.Mutex);
+    if (!pool.Data.empty())
+    {
+      this->Data.swap(pool.Data.back());
+      this->ValueOffsets.swap(pool.ValueOffsets.back());
+      this->MessageIndexes.swap(pool.MessageIndexes.back());
+      pool.Data.pop_back();
+      pool.ValueOffsets.pop_back();
+      pool.MessageIndexes.pop_back();
+    }
+  }
+
+  // Releases the memory of a buffer larger than MaximumRetainedCapacity.
+  template <typename BufferType>
+  static void TrimBuffer(BufferType& buffer)
+  {
+    if (buffer.capacity() * sizeof(typename BufferType::value_type) > MaximumRetainedCapacity)
+    {
+      BufferType().swap(buffer);
+    }
+  }
+
+  void ReleaseBuffers()
+  {
+    TrimBuffer(this->Data);
+    TrimBuffer(this->ValueOffsets);
+    TrimBuffer(this->MessageIndexes);
+    if (this->Data.capacity() == 0)
+    {
+      return;
+    }
+    BufferPoolType& pool = vtkClientServerStreamInternals::GetBufferPool();
+    std::lock_guard<std::mutex> lock(pool.Mutex);
+    if (pool.Data.size() < pool.MaximumSize)
+    {
+      this->Data.clear();
+      this->ValueOffsets.clear();
+      this->MessageIndexes.clear();
+      pool.Data.push_back(DataType());
+      pool.Data.back().swap(this->Data);
+      pool.ValueOffsets.push_back(ValueOffsetsType());
+      pool.ValueOffsets.back().swap(this->ValueOffsets);
+      pool.MessageIndexes.push_back(MessageIndexesType());
+      pool.MessageIndexes.back().swap(this->MessageIndexes);
+    }
+  }
+
   // Access to protected members of vtkClientServerStream.
   static vtkClientServerStream& Write(vtkClientServerStream& css, const void* data, size_t length)
   {
@@ -301,9 +376,9 @@ vtkClientServerStream& vtkClientServerStream::Write(const void* data, size_t len
     return *this;
   }
 
-  // Copy the value into the data.
-  this->Internal->Data.resize(this->Internal->Data.size() + length);
-  memcpy(&*(this->Internal->Data.end() - length), data, length);
+  // Append the value to the data.
+  const unsigned char* bytes = static_cast<const unsigned char*>(data);
+  this->Internal->Data.insert(this->Internal->Data.end(), bytes, bytes + length);
   return *this;
 }
 
@@ -316,13 +391,14 @@ void vtkClientServerStream::Reserve(size_t size)
 //----------------------------------------------------------------------------
 void vtkClientServerStream::Reset()
 {
-  // Empty the entire stream.
-  vtkClientServerStreamInternals::DataType().swap(this->Internal->Data);
-
-  this->Internal->ValueOffsets.erase(
-    this->Internal->ValueOffsets.begin(), this->Internal->ValueOffsets.end());
-  this->Internal->MessageIndexes.erase(
-    this->Internal->MessageIndexes.begin(), this->Internal->MessageIndexes.end());
+  // Empty the entire stream.  The memory is kept to build the next
+  // messages, unless the stream grew unusually large.
+  vtkClientServerStreamInternals::TrimBuffer(this->Internal->Data);
+  vtkClientServerStreamInternals::TrimBuffer(this->Internal->ValueOffsets);
+  vtkClientServerStreamInternals::TrimBuffer(this->Internal->MessageIndexes);
+  this->Internal->Data.clear();
+  this->Internal->ValueOffsets.clear();
+  this->Internal->MessageIndexes.clear();
   this->Internal->Objects.Clear();
 
   // No message has yet been started.
@@ -337,6 +413,30 @@ void vtkClientServerStream::Reset()
 #endif
 }
 
+//----------------------------------------------------------------------------
+void vtkClientServerStream::SetBufferPoolSize(int size)
+{
+  vtkClientServerStreamInternals::BufferPoolType& pool =
+    vtkClientServerStreamInternals::GetBufferPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  pool.MaximumSize = static_cast<size_t>(std::max(size, 0));
+  if (pool.Data.size() > pool.MaximumSize)
+  {
+    pool.Data.resize(pool.MaximumSize);
+    pool.ValueOffsets.resize(pool.MaximumSize);
+    pool.MessageIndexes.resize(pool.MaximumSize);
+  }
+}
+
+//----------------------------------------------------------------------------
+int vtkClientServerStream::GetBufferPoolSize()
+{
+  vtkClientServerStreamInternals::BufferPoolType& pool =
+    vtkClientServerStreamInternals::GetBufferPool();
+  std::lock_guard<std::mutex> lock(pool.Mutex);
+  return static_cast<int>(pool.MaximumSize);
+}
+
 //----------------------------------------------------------------------------
 vtkClientServerStream& vtkClientServerStream::operator<<(vtkClientServerStream::Commands t)
 {
@@ -1510,12 +1610,12 @@ int vtkClientServerStream::SetData(const unsigned char* data, size_t length)
 {
   // Reset and remove the byte order entry from the stream.
   this->Reset();
-  this->Internal->Data.erase(this->Internal->Data.begin(), this->Internal->Data.end());
+  this->Internal->Data.clear();
 
   // Store the given data in the stream.
   if (data)
   {
-    this->Internal->Data.insert(this->Internal->Data.begin(), data, data + length);
+    this->Internal->Data.assign(data, data + length);
   }
 
   // Parse the stream to fill in ValueOffsets and MessageIndexes and
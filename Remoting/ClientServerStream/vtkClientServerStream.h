@@ -111,10 +111,23 @@ public:
   void Reserve(size_t size);
 
   /**
-   * Reset the stream to an empty state.
+   * Reset the stream to an empty state.  The memory allocated so far is
+   * kept to write the next messages.
    */
   void Reset();
 
+  //@{
+  /**
+   * Streams are typically short-lived: they are built, sent or processed,
+   * and discarded.  Instead of being freed, the buffers of destroyed streams
+   * are kept in a process-wide pool and reused by new streams.  This sets the
+   * maximum number of buffers kept in the pool, 0 disables pooling.
+   * Default is 16.
+   */
+  static void SetBufferPoolSize(int size);
+  static int GetBufferPoolSize();
+  //@}
+
   /**
    * Copy the stream contents from another stream.
    */
@@ -492,7 +505,9 @@ class vtkClientServerStreamDataArg
 {
 public:
   // Constructor checks the argument type and length, allocates
-  // memory, and extracts the data from the message.
+  // memory, and extracts the data from the message.  Small arrays, the
+  // common case for setters such as SetPosition(double[3]), are stored in
+  // a local buffer to avoid a heap allocation.
   vtkClientServerStreamDataArg(const vtkClientServerStream& msg, int message, int argument)
     : Data(0)
   {
@@ -500,36 +515,53 @@ public:
     vtkTypeUInt32 length = 0;
     if (msg.GetArgumentLength(message, argument, &length) && length > 0)
     {
-      // Allocate memory without throwing.
-      try
+      if (length <= LocalSize)
       {
-        this->Data = new T[length];
+        this->Data = this->Local;
       }
-      catch (...)
+      else
       {
+        // Allocate memory without throwing.
+        try
+        {
+          this->Data = new T[length];
+        }
+        catch (...)
+        {
+        }
       }
     }
 
     // Extract the data into the allocated memory.
     if (this->Data && !msg.GetArgument(message, argument, this->Data, length))
     {
-      delete[] this->Data;
-      this->Data = 0;
+      this->Free();
     }
   }
 
   // Destructor frees data memory.
-  ~vtkClientServerStreamDataArg()
+  ~vtkClientServerStreamDataArg() { this->Free(); }
+
+  // Allow this object to be passed as if it were a pointer.
+  operator T*() { return this->Data; }
+private:
+  vtkClientServerStreamDataArg(const vtkClientServerStreamDataArg&) = delete;
+  void operator=(const vtkClientServerStreamDataArg&) = delete;
+
+  void Free()
   {
-    if (this->Data)
+    if (this->Data && this->Data != this->Local)
     {
       delete[] this->Data;
     }
+    this->Data = 0;
   }
 
-  // Allow this object to be passed as if it were a pointer.
-  operator T*() { return this->Data; }
-private:
+  enum
+  {
+    LocalSize = 16
+  };
+  T Local[LocalSize];
   T* Data;
 };
 #endif
@@ -0,0 +1,117 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestDataInformationCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVArrayInformation.h"
+#include "vtkPVDataInformation.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> GetPolyData(double value)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(value, 0, 0);
+  sphere->Update();
+
+  vtkSmartPointer<vtkPolyData> pd = sphere->GetOutput();
+  vtkNew<vtkDoubleArray> array;
+  array->SetName("values");
+  array->SetNumberOfTuples(pd->GetNumberOfPoints());
+  array->FillComponent(0, value);
+  pd->GetPointData()->AddArray(array);
+
+  vtkNew<vtkDoubleArray> field;
+  field->SetName("field");
+  field->SetNumberOfTuples(1);
+  field->SetValue(0, value);
+  pd->GetFieldData()->AddArray(field);
+  return pd;
+}
+
+bool Check(vtkDataObject* data, vtkTypeInt64 hits, vtkTypeInt64 misses, double maxValue,
+  double maxFieldValue)
+{
+  vtkPVDataInformation::ResetCacheCounters();
+  vtkNew<vtkPVDataInformation> info;
+  info->CopyFromObject(data);
+  if (vtkPVDataInformation::GetNumberOfCacheHits() != hits ||
+    vtkPVDataInformation::GetNumberOfCacheMisses() != misses)
+  {
+    cerr << "ERROR: expected " << hits << " hits and " << misses << " misses, got "
+         << vtkPVDataInformation::GetNumberOfCacheHits() << " and "
+         << vtkPVDataInformation::GetNumberOfCacheMisses() << endl;
+    return false;
+  }
+
+  vtkPVArrayInformation* ainfo = info->GetArrayInformation("values", vtkDataObject::POINT);
+  vtkPVArrayInformation* finfo = info->GetArrayInformation("field", vtkDataObject::FIELD);
+  if (info->GetNumberOfDataSets() != 3 || !ainfo ||
+    ainfo->GetComponentRange(0)[0] != 0 || ainfo->GetComponentRange(0)[1] != maxValue ||
+    !finfo || finfo->GetComponentRange(0)[1] != maxFieldValue)
+  {
+    cerr << "ERROR: unexpected data information." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDataInformationCache(int, char* [])
+{
+  vtkNew<vtkMultiBlockDataSet> data;
+  for (unsigned int cc = 0; cc < 3; ++cc)
+  {
+    data->SetBlock(cc, GetPolyData(cc));
+  }
+
+  // The first gather computes the information of every block, the next ones
+  // reuse it until a block is modified.
+  if (!Check(data, 0, 3, 2, 2) || !Check(data, 3, 0, 2, 2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkPolyData* block = vtkPolyData::SafeDownCast(data->GetBlock(1));
+  vtkDataArray* array = block->GetPointData()->GetArray("values");
+  array->FillComponent(0, 5);
+  array->Modified();
+  if (!Check(data, 2, 1, 5, 2))
+  {
+    return EXIT_FAILURE;
+  }
+
+  // Field data does not contribute to the MTime of the dataset, but must
+  // invalidate its information too.
+  vtkDataArray* field = data->GetBlock(0)->GetFieldData()->GetArray("field");
+  field->SetTuple1(0, 7);
+  field->Modified();
+  if (!Check(data, 2, 1, 5, 7))
+  {
+    return EXIT_FAILURE;
+  }
+
+  vtkPVDataInformation::ClearCache();
+  if (!Check(data, 0, 3, 5, 7))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
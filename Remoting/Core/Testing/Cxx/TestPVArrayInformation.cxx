@@ -12,12 +12,16 @@
      PURPOSE.  See the above copyright notice for more information.
 
 =========================================================================*/
+#include "vtkDoubleArray.h"
 #include "vtkFloatArray.h"
+#include "vtkMath.h"
 #include "vtkMathUtilities.h"
 #include "vtkNew.h"
 #include "vtkPVArrayInformation.h"
 #include "vtkSmartPointer.h"
 
+#include <cmath>
+
 vtkSmartPointer<vtkFloatArray> GetPolyData()
 {
   vtkIdType numPts = 101;
@@ -138,5 +142,50 @@ int TestPVArrayInformation(int, char* [])
     return EXIT_FAILURE;
   }
 
+  // Compare the ranges of a tensor array, including the magnitude, with the
+  // ones computed by vtkDataArray.
+  vtkNew<vtkDoubleArray> tensors;
+  tensors->SetNumberOfComponents(9);
+  tensors->SetNumberOfTuples(10000);
+  for (vtkIdType cc = 0; cc < tensors->GetNumberOfTuples(); ++cc)
+  {
+    for (int comp = 0; comp < 9; ++comp)
+    {
+      tensors->SetTypedComponent(cc, comp, ((cc * 7 + comp * 13) % 101) - 50.0 + comp);
+    }
+  }
+  tensors->SetTypedComponent(10, 2, vtkMath::Inf());
+  tensors->SetTypedComponent(20, 3, -vtkMath::Inf());
+  tensors->SetTypedComponent(30, 4, vtkMath::Nan());
+  info->CopyFromObject(tensors.Get());
+  // The bounds can be infinite, which FuzzyCompare does not handle, and are
+  // compared exactly then. Finite bounds of the magnitude may differ by
+  // rounding.
+  auto sameBound = [](double value, double expected) {
+    return std::isfinite(value) && std::isfinite(expected)
+      ? vtkMathUtilities::FuzzyCompare(value, expected)
+      : value == expected;
+  };
+  for (int comp = -1; comp < 9; ++comp)
+  {
+    double expected[2];
+    tensors->GetRange(expected, comp);
+    info->GetComponentRange(comp, rangeArray);
+    if (!sameBound(rangeArray[0], expected[0]) || !sameBound(rangeArray[1], expected[1]))
+    {
+      cerr << "ERROR: wrong range for component " << comp << ": " << rangeArray[0] << ", "
+           << rangeArray[1] << " instead of " << expected[0] << ", " << expected[1] << endl;
+      return EXIT_FAILURE;
+    }
+    tensors->GetFiniteRange(expected, comp);
+    info->GetComponentFiniteRange(comp, rangeArray);
+    if (!sameBound(rangeArray[0], expected[0]) || !sameBound(rangeArray[1], expected[1]))
+    {
+      cerr << "ERROR: wrong finite range for component " << comp << ": " << rangeArray[0] << ", "
+           << rangeArray[1] << " instead of " << expected[0] << ", " << expected[1] << endl;
+      return EXIT_FAILURE;
+    }
+  }
+
   return EXIT_SUCCESS;
 }
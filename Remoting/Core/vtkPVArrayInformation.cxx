@@ -15,19 +15,25 @@
 #include "vtkPVArrayInformation.h"
 
 #include "vtkAbstractArray.h"
+#include "vtkArrayDispatch.h"
 #include "vtkClientServerStream.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkInformation.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
+#include "vtkMath.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVPostFilter.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkVariant.h"
 #include "vtkVariantArray.h"
 
 #include <algorithm>
+#include <cmath>
 #include <map>
 #include <set>
 #include <sstream>
@@ -44,6 +50,135 @@ struct vtkPVArrayInformationInformationKey
 };
 
 typedef std::vector<vtkPVArrayInformationInformationKey> vtkInternalInformationKeysBase;
+
+// Computes the ranges and finite ranges of all the components of an array,
+// and of the vector magnitude for multi-component arrays, in a single
+// threaded pass. The ranges are stored the way vtkPVArrayInformation does,
+// the magnitude first, and match what vtkDataArray::GetRange and
+// GetFiniteRange return: NaN values are ignored, infinite ones only in the
+// finite ranges.
+template <typename ArrayT>
+class ComputeRangesFunctor
+{
+  ArrayT* Array;
+  const int NumberOfComponents;
+  // Offset of the first component range, after the magnitude range.
+  const int Offset;
+  // Ranges, then finite ranges; the magnitude ranges are squared.
+  vtkSMPThreadLocal<std::vector<double> > TLRanges;
+
+public:
+  std::vector<double> Ranges;
+
+  ComputeRangesFunctor(ArrayT* array)
+    : Array(array)
+    , NumberOfComponents(array->GetNumberOfComponents())
+    , Offset(array->GetNumberOfComponents() > 1 ? 2 : 0)
+  {
+  }
+
+  void Initialize()
+  {
+    std::vector<double>& ranges = this->TLRanges.Local();
+    ranges.resize(2 * (this->Offset + 2 * this->NumberOfComponents));
+    for (size_t cc = 0; cc < ranges.size(); cc += 2)
+    {
+      ranges[cc] = VTK_DOUBLE_MAX;
+      ranges[cc + 1] = VTK_DOUBLE_MIN;
+    }
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    std::vector<double>& tlRanges = this->TLRanges.Local();
+    double* ranges = tlRanges.data();
+    double* finiteRanges = ranges + tlRanges.size() / 2;
+    const int numComps = this->NumberOfComponents;
+    const int offset = this->Offset;
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    for (const auto tuple : tuples)
+    {
+      double squaredSum = 0;
+      for (int comp = 0; comp < numComps; ++comp)
+      {
+        const double value = static_cast<double>(tuple[comp]);
+        squaredSum += value * value;
+        if (!vtkMath::IsNan(value))
+        {
+          double* range = ranges + offset + 2 * comp;
+          range[0] = std::min(range[0], value);
+          range[1] = std::max(range[1], value);
+          if (vtkMath::IsFinite(value))
+          {
+            double* finiteRange = finiteRanges + offset + 2 * comp;
+            finiteRange[0] = std::min(finiteRange[0], value);
+            finiteRange[1] = std::max(finiteRange[1], value);
+          }
+        }
+      }
+      if (offset > 0 && !vtkMath::IsNan(squaredSum))
+      {
+        ranges[0] = std::min(ranges[0], squaredSum);
+        ranges[1] = std::max(ranges[1], squaredSum);
+        if (vtkMath::IsFinite(squaredSum))
+        {
+          finiteRanges[0] = std::min(finiteRanges[0], squaredSum);
+          finiteRanges[1] = std::max(finiteRanges[1], squaredSum);
+        }
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    auto iter = this->TLRanges.begin();
+    if (iter == this->TLRanges.end())
+    {
+      return;
+    }
+    this->Ranges = *iter;
+    for (++iter; iter != this->TLRanges.end(); ++iter)
+    {
+      for (size_t cc = 0; cc < this->Ranges.size(); cc += 2)
+      {
+        this->Ranges[cc] = std::min(this->Ranges[cc], (*iter)[cc]);
+        this->Ranges[cc + 1] = std::max(this->Ranges[cc + 1], (*iter)[cc + 1]);
+      }
+    }
+
+    if (this->Offset > 0)
+    {
+      const size_t finiteOffset = this->Ranges.size() / 2;
+      for (size_t cc : { static_cast<size_t>(0), finiteOffset })
+      {
+        if (this->Ranges[cc] <= this->Ranges[cc + 1])
+        {
+          this->Ranges[cc] = std::sqrt(this->Ranges[cc]);
+          this->Ranges[cc + 1] = std::sqrt(this->Ranges[cc + 1]);
+        }
+      }
+    }
+  }
+};
+
+struct ComputeRangesWorker
+{
+  template <typename ArrayT>
+  void operator()(ArrayT* array, double* ranges, double* finiteRanges)
+  {
+    ComputeRangesFunctor<ArrayT> functor(array);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+    if (functor.Ranges.empty())
+    {
+      // Empty array, no thread computed anything.
+      functor.Initialize();
+      functor.Reduce();
+    }
+    const size_t size = functor.Ranges.size() / 2;
+    std::copy(functor.Ranges.begin(), functor.Ranges.begin() + size, ranges);
+    std::copy(functor.Ranges.begin() + size, functor.Ranges.end(), finiteRanges);
+  }
+};
 }
 
 class vtkPVArrayInformation::vtkInternalComponentNames : public vtkInternalComponentNameBase
@@ -632,39 +767,16 @@ void vtkPVArrayInformation::CopyFromObject(vtkObject* obj)
     }
   }
 
-  if (vtkDataArray* const data_array = vtkDataArray::SafeDownCast(obj))
+  vtkDataArray* const data_array = vtkDataArray::SafeDownCast(obj);
+  if (data_array && this->NumberOfComponents > 0)
   {
-    double range[2];
-    double* ptr;
-    int idx;
-
-    ptr = this->Ranges;
-    if (this->NumberOfComponents > 1)
-    {
-      // First store range of vector magnitude.
-      data_array->GetRange(range, -1);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    for (idx = 0; idx < this->NumberOfComponents; ++idx)
-    {
-      data_array->GetRange(range, idx);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    ptr = this->FiniteRanges;
-    if (this->NumberOfComponents > 1)
-    {
-      // First store range of vector magnitude.
-      data_array->GetFiniteRange(range, -1);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
-    }
-    for (idx = 0; idx < this->NumberOfComponents; ++idx)
+    // Compute all the ranges at once instead of sweeping the array for each
+    // component and for the finite ranges.
+    ComputeRangesWorker worker;
+    if (!vtkArrayDispatch::Dispatch::Execute(
+          data_array, worker, this->Ranges, this->FiniteRanges))
     {
-      data_array->GetFiniteRange(range, idx);
-      *ptr++ = range[0];
-      *ptr++ = range[1];
+      worker(data_array, this->Ranges, this->FiniteRanges);
     }
   }
 
@@ -29,6 +29,7 @@
 #include "vtkDataSet.h"
 #include "vtkExecutive.h"
 #include "vtkExplicitStructuredGrid.h"
+#include "vtkFieldData.h"
 #include "vtkGenericDataSet.h"
 #include "vtkGraph.h"
 #include "vtkHyperTreeGrid.h"
@@ -48,21 +49,53 @@
 #include "vtkPointData.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkSelection.h"
+#include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
 #include "vtkStructuredGrid.h"
 #include "vtkTable.h"
 #include "vtkUniformGrid.h"
+#include "vtkWeakPointer.h"
 
 #include <algorithm>
+#include <atomic>
 #include <map>
+#include <mutex>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 vtkStandardNewMacro(vtkPVDataInformation);
 
 std::map<std::string, std::string> helpers;
 
+namespace
+{
+// Information gathered from datasets, see vtkPVDataInformation::ClearCache.
+struct DataSetInformationCacheEntry
+{
+  vtkWeakPointer<vtkDataSet> DataSet;
+  vtkMTimeType MTime;
+  vtkSmartPointer<vtkPVDataInformation> Information;
+};
+
+struct DataSetInformationCache
+{
+  std::mutex Mutex;
+  std::unordered_map<vtkDataSet*, DataSetInformationCacheEntry> Entries;
+  // Entries of deleted datasets are removed when the cache grows past this.
+  size_t PruneSize = 64;
+  std::atomic<vtkTypeInt64> Hits{ 0 };
+  std::atomic<vtkTypeInt64> Misses{ 0 };
+};
+
+DataSetInformationCache& GetDataSetInformationCache()
+{
+  static DataSetInformationCache cache;
+  return cache;
+}
+}
+
 //----------------------------------------------------------------------------
 vtkPVDataInformation::vtkPVDataInformation()
 {
@@ -476,6 +509,29 @@ void vtkPVDataInformation::CopyCommonMetaData(vtkDataObject* data, vtkInformatio
 //----------------------------------------------------------------------------
 void vtkPVDataInformation::CopyFromDataSet(vtkDataSet* data)
 {
+  // Reuse the information gathered the last time if the dataset did not
+  // change since. vtkDataSet::GetMTime does not account for the field data,
+  // whose arrays are gathered too. The MTime is read first in case gathering
+  // the information modifies the dataset.
+  DataSetInformationCache& cache = GetDataSetInformationCache();
+  vtkMTimeType mtime = data->GetMTime();
+  if (vtkFieldData* fd = data->GetFieldData())
+  {
+    mtime = std::max(mtime, fd->GetMTime());
+  }
+  {
+    std::lock_guard<std::mutex> lock(cache.Mutex);
+    auto iter = cache.Entries.find(data);
+    if (iter != cache.Entries.end() && iter->second.DataSet.GetPointer() == data &&
+      iter->second.MTime == mtime)
+    {
+      ++cache.Hits;
+      this->CopyDataSetInformation(iter->second.Information);
+      return;
+    }
+  }
+  ++cache.Misses;
+
   int idx;
   double* bds;
   int* ext = nullptr;
@@ -578,6 +634,78 @@ void vtkPVDataInformation::CopyFromDataSet(vtkDataSet* data)
   {
     this->FieldDataInformation->CopyFromFieldData(fd);
   }
+
+  auto cachedInfo = vtkSmartPointer<vtkPVDataInformation>::New();
+  cachedInfo->CopyDataSetInformation(this);
+
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  DataSetInformationCacheEntry& entry = cache.Entries[data];
+  entry.DataSet = data;
+  entry.MTime = mtime;
+  entry.Information = cachedInfo;
+  if (cache.Entries.size() > cache.PruneSize)
+  {
+    for (auto iter = cache.Entries.begin(); iter != cache.Entries.end();)
+    {
+      if (iter->second.DataSet.GetPointer() == nullptr)
+      {
+        iter = cache.Entries.erase(iter);
+      }
+      else
+      {
+        ++iter;
+      }
+    }
+    cache.PruneSize = std::max(static_cast<size_t>(64), 2 * cache.Entries.size());
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::CopyDataSetInformation(vtkPVDataInformation* dataInfo)
+{
+  // Copies what CopyFromDataSet gathers.
+  this->SetDataClassName(dataInfo->DataClassName);
+  this->DataSetType = dataInfo->DataSetType;
+  this->NumberOfDataSets = dataInfo->NumberOfDataSets;
+  this->NumberOfPoints = dataInfo->NumberOfPoints;
+  this->NumberOfCells = dataInfo->NumberOfCells;
+  this->PolygonCount = dataInfo->PolygonCount;
+  this->MemorySize = dataInfo->MemorySize;
+  std::copy(dataInfo->Bounds, dataInfo->Bounds + 6, this->Bounds);
+  std::copy(dataInfo->Extent, dataInfo->Extent + 6, this->Extent);
+  this->PointArrayInformation->DeepCopy(dataInfo->PointArrayInformation);
+  this->PointDataInformation->DeepCopy(dataInfo->PointDataInformation);
+  this->CellDataInformation->DeepCopy(dataInfo->CellDataInformation);
+  this->FieldDataInformation->DeepCopy(dataInfo->FieldDataInformation);
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVDataInformation::GetNumberOfCacheHits()
+{
+  return GetDataSetInformationCache().Hits;
+}
+
+//----------------------------------------------------------------------------
+vtkTypeInt64 vtkPVDataInformation::GetNumberOfCacheMisses()
+{
+  return GetDataSetInformationCache().Misses;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ResetCacheCounters()
+{
+  DataSetInformationCache& cache = GetDataSetInformationCache();
+  cache.Hits = 0;
+  cache.Misses = 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataInformation::ClearCache()
+{
+  DataSetInformationCache& cache = GetDataSetInformationCache();
+  std::lock_guard<std::mutex> lock(cache.Mutex);
+  cache.Entries.clear();
+  cache.PruneSize = 64;
 }
 
 //----------------------------------------------------------------------------
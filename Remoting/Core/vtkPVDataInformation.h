@@ -296,6 +296,24 @@ public:
    */
   static void RegisterHelper(const char* classname, const char* helperclassname);
 
+  //@{
+  /**
+   * The information gathered from each vtkDataSet, including the blocks of
+   * composite datasets, is cached and reused as long as neither the dataset,
+   * whose MTime includes the MTime of its points, cells and attribute arrays,
+   * nor its field data are modified. Hence only the modified blocks are
+   * scanned again when gathering information.
+   * GetNumberOfCacheHits and GetNumberOfCacheMisses return the number of
+   * datasets whose information was reused or computed since the counters
+   * were last reset, for diagnosis purposes. ClearCache releases all cached
+   * information.
+   */
+  static vtkTypeInt64 GetNumberOfCacheHits();
+  static vtkTypeInt64 GetNumberOfCacheMisses();
+  static void ResetCacheCounters();
+  static void ClearCache();
+  //@}
+
 protected:
   vtkPVDataInformation();
   ~vtkPVDataInformation() override;
@@ -307,6 +325,7 @@ protected:
   void CopyFromCompositeDataSetInitialize(vtkCompositeDataSet* data);
   void CopyFromCompositeDataSetFinalize(vtkCompositeDataSet* data);
   virtual void CopyFromDataSet(vtkDataSet* data);
+  void CopyDataSetInformation(vtkPVDataInformation* dataInfo);
   void CopyFromGenericDataSet(vtkGenericDataSet* data);
   void CopyFromGraph(vtkGraph* graph);
   void CopyFromTable(vtkTable* table);
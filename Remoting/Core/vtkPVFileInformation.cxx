@@ -24,6 +24,7 @@
 #include "vtkPVFileInformationHelper.h"
 #include "vtkProcessModule.h"
 #include "vtkResourceFileLocator.h"
+#include "vtkSMPTools.h"
 #include "vtkSmartPointer.h"
 #include "vtkVersion.h"
 
@@ -50,9 +51,12 @@
 #endif
 
 #include <algorithm>
+#include <map>
+#include <mutex>
 #include <set>
 #include <string>
 #include <time.h>
+#include <vector>
 #include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
 
@@ -356,7 +360,6 @@ vtkPVFileInformation::vtkPVFileInformation()
 {
   this->RootOnly = 1;
   this->Contents = vtkCollection::New();
-  this->SequenceParser = vtkFileSequenceParser::New();
   this->Type = INVALID;
   this->Name = NULL;
   this->FullPath = NULL;
@@ -376,7 +379,6 @@ vtkPVFileInformation::vtkPVFileInformation()
 vtkPVFileInformation::~vtkPVFileInformation()
 {
   this->Contents->Delete();
-  this->SequenceParser->Delete();
   this->SetName(NULL);
   this->SetFullPath(NULL);
   this->SetExtension(NULL);
@@ -830,28 +832,37 @@ support and glibc/Linux system headers:
 #define dirent dirent64
 #endif
 
-//-----------------------------------------------------------------------------
-void vtkPVFileInformation::GetDirectoryListing()
+#if !defined(_WIN32)
+namespace
 {
-#if defined(_WIN32)
-
-  vtkErrorMacro("GetDirectoryListing() cannot be called on Windows systems.");
-  return;
-
-#else
-
-  vtkPVFileInformationSet info_set;
-  std::string prefix = this->FullPath;
-  vtkPVFileInformationAddTerminatingSlash(prefix);
+// An entry of a directory listing.
+struct vtkPVFileInformationEntry
+{
+  std::string Name;
+  int Type; // INVALID when the type must be detected with stat.
+  // Details, only set when stat succeeded.
+  bool HasDetails;
+  std::string Extension;
+  long long Size;
+  time_t ModificationTime;
+};
 
+// Lists the entries of a directory. The type of the entries is taken from
+// readdir when the file system provides it, entries are only stat'ed when
+// details are requested.
+bool vtkPVFileInformationListDirectory(const char* path, const std::string& prefix,
+  bool readDetails, std::vector<vtkPVFileInformationEntry>& entries)
+{
   // Open the directory and make sure it exists.
-  DIR* dir = opendir(this->FullPath);
+  DIR* dir = opendir(path);
   if (!dir)
   {
     // Could add check of errno here.
-    return;
+    return false;
   }
 
+  entries.clear();
+
   // Loop through the directory listing.
   while (const dirent* d = readdir(dir))
   {
@@ -860,56 +871,193 @@ void vtkPVFileInformation::GetDirectoryListing()
     {
       continue;
     }
-    vtkPVFileInformation* info = vtkPVFileInformation::New();
-    info->SetName(d->d_name);
-    info->SetFullPath((prefix + d->d_name).c_str());
-    info->Type = INVALID;
-    info->SetHiddenFlag();
-
-    vtksys::SystemTools::Stat_t status;
-    int res;
-    if (this->ReadDetailedFileInformation)
+    vtkPVFileInformationEntry entry;
+    entry.Name = d->d_name;
+    entry.Type = vtkPVFileInformation::INVALID;
+    entry.HasDetails = false;
+    entry.Size = 0;
+    entry.ModificationTime = 0;
+
+    if (readDetails)
     {
       // Recover status info
-      res = vtksys::SystemTools::Stat(info->FullPath, &status);
-      if (res != -1)
+      vtksys::SystemTools::Stat_t status;
+      if (vtksys::SystemTools::Stat((prefix + entry.Name).c_str(), &status) != -1)
       {
-        if (!S_ISDIR(status.st_mode))
+        if (S_ISDIR(status.st_mode))
         {
-          std::string::size_type pos = std::string(d->d_name).rfind('.');
+          entry.Type = vtkPVFileInformation::DIRECTORY;
+        }
+        else
+        {
+          std::string::size_type pos = entry.Name.rfind('.');
           if (pos != std::string::npos)
           {
-            std::string ext = std::string(d->d_name).substr(pos + 1);
-            info->SetExtension(ext.c_str());
+            entry.Extension = entry.Name.substr(pos + 1);
+          }
+          if (S_ISREG(status.st_mode))
+          {
+            entry.Type = vtkPVFileInformation::SINGLE_FILE;
           }
         }
-        info->Size = status.st_size;
-        info->ModificationTime = status.st_mtime;
+        entry.HasDetails = true;
+        entry.Size = status.st_size;
+        entry.ModificationTime = status.st_mtime;
       }
     }
-// fix to bug #09452 such that directories with trailing names can be
-// shown in the file dialog
-#if defined(__SVR4) && defined(__sun)
-    if (!this->ReadDetailedFileInformation)
+// there is no d_type on Solaris, DetectType() will stat the entry.
+#if !(defined(__SVR4) && defined(__sun))
+    else if (d->d_type == DT_DIR)
     {
-      res = vtksys::SystemTools::Stat(info->FullPath, &status);
+      entry.Type = vtkPVFileInformation::DIRECTORY;
     }
-    if (res != -1 && status.st_mode & S_IFDIR)
+    else if (d->d_type == DT_REG)
     {
-      info->Type = DIRECTORY;
+      entry.Type = vtkPVFileInformation::SINGLE_FILE;
     }
-#else
-    if (d->d_type & DT_DIR)
+// links and unknown types are left to vtkPVFileInformation::DetectType().
+#endif
+
+    entries.push_back(entry);
+  }
+  closedir(dir);
+  return true;
+}
+
+// Caches the listings of the last directories browsed.
+class vtkPVFileInformationListingCache
+{
+public:
+  static bool Find(
+    const std::string& path, time_t mtime, std::vector<vtkPVFileInformationEntry>& entries)
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    auto iter = Items.find(path);
+    if (iter == Items.end() || iter->second.ModificationTime != mtime)
     {
-      info->Type = DIRECTORY;
+      return false;
+    }
+    iter->second.LastUse = ++Clock;
+    entries = iter->second.Entries;
+    return true;
+  }
+
+  static void Insert(
+    const std::string& path, time_t mtime, const std::vector<vtkPVFileInformationEntry>& entries)
+  {
+    // the modification time only has a resolution of a second, the directory
+    // may still change without updating it if it was just modified.
+    if (mtime == 0 || time(nullptr) - mtime < 2)
+    {
+      return;
+    }
+
+    std::lock_guard<std::mutex> lock(Mutex);
+    if (Items.size() >= MaxNumberOfItems && Items.find(path) == Items.end())
+    {
+      auto oldest = Items.begin();
+      for (auto iter = Items.begin(); iter != Items.end(); ++iter)
+      {
+        if (iter->second.LastUse < oldest->second.LastUse)
+        {
+          oldest = iter;
+        }
+      }
+      Items.erase(oldest);
     }
+    Item& item = Items[path];
+    item.ModificationTime = mtime;
+    item.LastUse = ++Clock;
+    item.Entries = entries;
+  }
+
+  static void Clear()
+  {
+    std::lock_guard<std::mutex> lock(Mutex);
+    Items.clear();
+  }
+
+private:
+  struct Item
+  {
+    time_t ModificationTime;
+    unsigned long LastUse;
+    std::vector<vtkPVFileInformationEntry> Entries;
+  };
+
+  static const size_t MaxNumberOfItems = 8;
+  static std::map<std::string, Item> Items;
+  static unsigned long Clock;
+  static std::mutex Mutex;
+};
+
+std::map<std::string, vtkPVFileInformationListingCache::Item>
+  vtkPVFileInformationListingCache::Items;
+unsigned long vtkPVFileInformationListingCache::Clock = 0;
+std::mutex vtkPVFileInformationListingCache::Mutex;
+}
 #endif
 
+//-----------------------------------------------------------------------------
+void vtkPVFileInformation::GetDirectoryListing()
+{
+#if defined(_WIN32)
+
+  vtkErrorMacro("GetDirectoryListing() cannot be called on Windows systems.");
+  return;
+
+#else
+
+  vtkPVFileInformationSet info_set;
+  std::string prefix = this->FullPath;
+  vtkPVFileInformationAddTerminatingSlash(prefix);
+
+  // Directory listings without details only depend on the directory, whose
+  // modification time tells whether the cached listing is still valid.
+  const bool useCache = !this->ReadDetailedFileInformation;
+  time_t directoryTime = 0;
+  std::vector<vtkPVFileInformationEntry> entries;
+  if (useCache)
+  {
+    vtksys::SystemTools::Stat_t status;
+    if (vtksys::SystemTools::Stat(this->FullPath, &status) != -1)
+    {
+      directoryTime = status.st_mtime;
+    }
+  }
+  if (!useCache || !vtkPVFileInformationListingCache::Find(this->FullPath, directoryTime, entries))
+  {
+    if (!vtkPVFileInformationListDirectory(
+          this->FullPath, prefix, this->ReadDetailedFileInformation, entries))
+    {
+      return;
+    }
+    if (useCache)
+    {
+      vtkPVFileInformationListingCache::Insert(this->FullPath, directoryTime, entries);
+    }
+  }
+
+  for (const auto& entry : entries)
+  {
+    vtkPVFileInformation* info = vtkPVFileInformation::New();
+    info->SetName(entry.Name.c_str());
+    info->SetFullPath((prefix + entry.Name).c_str());
+    info->Type = entry.Type;
+    info->SetHiddenFlag();
+    if (entry.HasDetails)
+    {
+      if (!entry.Extension.empty())
+      {
+        info->SetExtension(entry.Extension.c_str());
+      }
+      info->Size = entry.Size;
+      info->ModificationTime = entry.ModificationTime;
+    }
     info->FastFileTypeDetection = this->FastFileTypeDetection;
     info_set.insert(info);
     info->Delete();
   }
-  closedir(dir);
 
   this->OrganizeCollection(info_set);
 
@@ -1019,51 +1167,63 @@ void vtkPVFileInformation::OrganizeCollection(vtkPVFileInformationSet& info_set)
   std::string prefix = this->FullPath;
   vtkPVFileInformationAddTerminatingSlash(prefix);
 
-  for (vtkPVFileInformationSet::iterator iter = info_set.begin(); iter != info_set.end();)
-  {
-    vtkSmartPointer<vtkPVFileInformation> obj = *iter;
-    // we're going to skip non-groupable file types. Note, we may get INVALID
-    // here since when this->FastFileTypeDetection is true, the grouping
-    // happens before the file types are detected.
-    if (obj->Type != FILE_GROUP && obj->Type != DRIVE && obj->Type != NETWORK_ROOT &&
-      obj->Type != NETWORK_DOMAIN && obj->Type != NETWORK_SERVER && obj->Type != NETWORK_SHARE &&
-      obj->Type != DIRECTORY_GROUP)
+  // Parse the names of all the items first, which is the expensive part for
+  // large directories, using several threads.
+  const std::vector<vtkPVFileInformation*> items(info_set.begin(), info_set.end());
+  std::vector<std::string> groupNames(items.size());
+  std::vector<int> groupIndices(items.size(), -1);
+  std::vector<char> grouped(items.size(), 0);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(items.size()), [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
     {
-      if (this->SequenceParser->ParseFileSequence(obj->GetName()))
+      const vtkPVFileInformation* obj = items[cc];
+      // we're going to skip non-groupable file types. Note, we may get INVALID
+      // here since when this->FastFileTypeDetection is true, the grouping
+      // happens before the file types are detected.
+      if (obj->Type != FILE_GROUP && obj->Type != DRIVE && obj->Type != NETWORK_ROOT &&
+        obj->Type != NETWORK_DOMAIN && obj->Type != NETWORK_SERVER &&
+        obj->Type != NETWORK_SHARE && obj->Type != DIRECTORY_GROUP && obj->Name)
       {
-        const std::string groupName = this->SequenceParser->GetSequenceName();
-        const int groupIndex = this->SequenceParser->GetSequenceIndex();
-
-        // since I want to keep file groups and directory groups separate, for
-        // the key, I'm creating a new key by prefixing it with the group
-        // type.
-        const std::string key_prefix(vtkPVFileInformation::IsDirectory(obj->Type) ? "d." : "f.");
-        const std::string key(key_prefix + groupName);
-
-        MapOfStringToInfo::iterator iter2 = fileGroups.find(key);
-        if (iter2 == fileGroups.end())
-        {
-          vtkNew<vtkPVFileInformation> group;
-          ;
-          group->SetName(groupName.c_str());
-          group->SetFullPath((prefix + groupName).c_str());
-          group->Type = vtkPVFileInformation::IsDirectory(obj->Type) ? DIRECTORY_GROUP : FILE_GROUP;
-          // the group inherits the hidden flag of the first item in the group
-          group->Hidden = obj->Hidden;
-          group->FastFileTypeDetection = this->FastFileTypeDetection;
-
-          vtkInfo info;
-          info.Group = group.GetPointer();
-          iter2 = fileGroups.insert(std::pair<std::string, vtkInfo>(key, info)).first;
-        }
-
-        iter2->second.Children[groupIndex] = obj;
-
-        iter = info_set.erase(iter);
-        continue; // needed to skip the ++iter, since we already incremented.
+        grouped[cc] =
+          vtkFileSequenceParser::ParseFileName(obj->Name, groupNames[cc], groupIndices[cc]);
       }
     }
-    ++iter;
+  });
+
+  for (size_t cc = 0; cc < items.size(); ++cc)
+  {
+    if (!grouped[cc])
+    {
+      continue;
+    }
+    vtkSmartPointer<vtkPVFileInformation> obj = items[cc];
+    const std::string& groupName = groupNames[cc];
+    const int groupIndex = groupIndices[cc];
+
+    // since I want to keep file groups and directory groups separate, for
+    // the key, I'm creating a new key by prefixing it with the group
+    // type.
+    const std::string key_prefix(vtkPVFileInformation::IsDirectory(obj->Type) ? "d." : "f.");
+    const std::string key(key_prefix + groupName);
+
+    MapOfStringToInfo::iterator iter2 = fileGroups.find(key);
+    if (iter2 == fileGroups.end())
+    {
+      vtkNew<vtkPVFileInformation> group;
+      group->SetName(groupName.c_str());
+      group->SetFullPath((prefix + groupName).c_str());
+      group->Type = vtkPVFileInformation::IsDirectory(obj->Type) ? DIRECTORY_GROUP : FILE_GROUP;
+      // the group inherits the hidden flag of the first item in the group
+      group->Hidden = obj->Hidden;
+      group->FastFileTypeDetection = this->FastFileTypeDetection;
+
+      vtkInfo info;
+      info.Group = group.GetPointer();
+      iter2 = fileGroups.insert(std::pair<std::string, vtkInfo>(key, info)).first;
+    }
+
+    iter2->second.Children[groupIndex] = obj;
+    info_set.erase(obj);
   }
 
   // Now scan through all created groups and dissolve trivial groups
@@ -1236,6 +1396,14 @@ std::string vtkPVFileInformation::GetParaViewDocDirectory()
   return vtkPVFileInformation::GetParaViewSharedResourcesDirectory() + "/doc";
 }
 
+//-----------------------------------------------------------------------------
+void vtkPVFileInformation::ClearDirectoryListingCache()
+{
+#if !defined(_WIN32)
+  vtkPVFileInformationListingCache::Clear();
+#endif
+}
+
 //-----------------------------------------------------------------------------
 void vtkPVFileInformation::PrintSelf(ostream& os, vtkIndent indent)
 {
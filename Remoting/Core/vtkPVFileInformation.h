@@ -34,7 +34,6 @@
 
 class vtkCollection;
 class vtkPVFileInformationSet;
-class vtkFileSequenceParser;
 
 class VTKREMOTINGCORE_EXPORT vtkPVFileInformation : public vtkPVInformation
 {
@@ -145,12 +144,18 @@ public:
   */
   static std::string GetParaViewDocDirectory();
 
+  /**
+   * Directory listings are cached on the process doing the listing and reused
+   * as long as the modification time of the directory is unchanged, unless
+   * detailed file information is requested. This clears that cache.
+   */
+  static void ClearDirectoryListingCache();
+
 protected:
   vtkPVFileInformation();
   ~vtkPVFileInformation() override;
 
   vtkCollection* Contents;
-  vtkFileSequenceParser* SequenceParser;
 
   char* Name;              // Name of this file/directory.
   char* FullPath;          // Full path for this file/directory.
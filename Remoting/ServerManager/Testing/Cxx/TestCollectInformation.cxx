@@ -0,0 +1,152 @@
+/*=========================================================================
+
+Program:   ParaView
+Module:    TestCollectInformation.cxx
+
+Copyright (c) Kitware, Inc.
+All rights reserved.
+See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks that vtkPVSessionCore::CollectInformation() merges the information
+// of all ranks on the root, in rank order, including the information of the
+// ranks below a rank that failed to gather its own.
+
+#include "vtkClientServerStream.h"
+#include "vtkMPIController.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVInformation.h"
+#include "vtkPVSessionCore.h"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+// Information holding the list of the ranks it was gathered on.
+class vtkRankListInformation : public vtkPVInformation
+{
+public:
+  static vtkRankListInformation* New();
+  vtkTypeMacro(vtkRankListInformation, vtkPVInformation);
+
+  void AddInformation(vtkPVInformation* info) override
+  {
+    if (auto other = vtkRankListInformation::SafeDownCast(info))
+    {
+      this->Ranks.insert(this->Ranks.end(), other->Ranks.begin(), other->Ranks.end());
+    }
+  }
+
+  void CopyToStream(vtkClientServerStream* css) override
+  {
+    css->Reset();
+    *css << vtkClientServerStream::Reply;
+    for (int rank : this->Ranks)
+    {
+      *css << rank;
+    }
+    *css << vtkClientServerStream::End;
+  }
+
+  void CopyFromStream(const vtkClientServerStream* css) override
+  {
+    this->Ranks.resize(css->GetNumberOfArguments(0));
+    for (int cc = 0; cc < static_cast<int>(this->Ranks.size()); ++cc)
+    {
+      css->GetArgument(0, cc, &this->Ranks[cc]);
+    }
+  }
+
+  std::vector<int> Ranks;
+
+protected:
+  vtkRankListInformation() = default;
+
+private:
+  vtkRankListInformation(const vtkRankListInformation&) = delete;
+  void operator=(const vtkRankListInformation&) = delete;
+};
+vtkStandardNewMacro(vtkRankListInformation);
+
+// Gives access to CollectInformation().
+class vtkCollectingSessionCore : public vtkPVSessionCore
+{
+public:
+  static vtkCollectingSessionCore* New();
+  vtkTypeMacro(vtkCollectingSessionCore, vtkPVSessionCore);
+
+  using vtkPVSessionCore::CollectInformation;
+
+protected:
+  vtkCollectingSessionCore() = default;
+
+private:
+  vtkCollectingSessionCore(const vtkCollectingSessionCore&) = delete;
+  void operator=(const vtkCollectingSessionCore&) = delete;
+};
+vtkStandardNewMacro(vtkCollectingSessionCore);
+
+// Collects the information of all ranks but the failed ones and checks the
+// result on the root.
+bool Collect(vtkMultiProcessController* controller, const std::set<int>& failedRanks)
+{
+  const int rank = controller->GetLocalProcessId();
+  const int numRanks = controller->GetNumberOfProcesses();
+
+  vtkNew<vtkCollectingSessionCore> core;
+  vtkNew<vtkRankListInformation> info;
+  info->Ranks.push_back(rank);
+  const bool failed = failedRanks.count(rank) > 0;
+  core->CollectInformation(failed ? nullptr : info.Get());
+  if (rank != 0)
+  {
+    return true;
+  }
+
+  std::vector<int> expected;
+  for (int cc = 0; cc < numRanks; ++cc)
+  {
+    if (failedRanks.count(cc) == 0)
+    {
+      expected.push_back(cc);
+    }
+  }
+  if (info->Ranks != expected)
+  {
+    cerr << "ERROR: wrong information collected with " << failedRanks.size()
+         << " failed ranks:";
+    for (int cc : info->Ranks)
+    {
+      cerr << " " << cc;
+    }
+    cerr << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestCollectInformation(int argc, char* argv[])
+{
+  vtkMPIController* controller = vtkMPIController::New();
+  controller->Initialize(&argc, &argv);
+  vtkMultiProcessController::SetGlobalController(controller);
+
+  // Ranks 2 and 4 merge the information of the ranks that follow them before
+  // sending it to the root, when there are enough ranks.
+  int success = Collect(controller, {}) && Collect(controller, { 2, 4 }) ? 1 : 0;
+
+  int all_success;
+  controller->AllReduce(&success, &all_success, 1, vtkCommunicator::LOGICAL_AND_OP);
+
+  vtkMultiProcessController::SetGlobalController(nullptr);
+  controller->Finalize();
+  controller->Delete();
+  return all_success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
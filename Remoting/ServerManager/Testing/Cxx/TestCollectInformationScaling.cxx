@@ -0,0 +1,139 @@
+/*=========================================================================
+
+Program:   ParaView
+Module:    TestCollectInformationScaling.cxx
+
+Copyright (c) Kitware, Inc.
+All rights reserved.
+See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Scaling benchmark for the reduction done by
+// vtkPVSessionCore::CollectInformation, simulating the ranks in a single
+// process. Each simulated rank holds the data information of a sphere. The
+// flat reduction, where the root merges the information of all ranks, is
+// compared to the binomial tree reduction, whose critical path is the sum over
+// the levels of the tree of the slowest merge of the level.
+
+#include "vtkClientServerStream.h"
+#include "vtkNew.h"
+#include "vtkPVDataInformation.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkTimerLog.h"
+
+#include <algorithm>
+#include <vector>
+
+namespace
+{
+typedef std::vector<vtkSmartPointer<vtkPVDataInformation> > InformationVector;
+
+// Copies an information object through its serialized form, as sent between
+// ranks.
+vtkSmartPointer<vtkPVDataInformation> Transfer(vtkPVDataInformation* source)
+{
+  vtkClientServerStream stream;
+  source->CopyToStream(&stream);
+  const unsigned char* data;
+  size_t length;
+  stream.GetData(&data, &length);
+
+  vtkClientServerStream rcvStream;
+  rcvStream.SetData(data, length);
+  auto info = vtkSmartPointer<vtkPVDataInformation>::New();
+  info->CopyFromStream(&rcvStream);
+  return info;
+}
+
+// Merges `source` into `target`, as done for every message received by
+// CollectInformation.
+void Merge(vtkPVDataInformation* target, vtkPVDataInformation* source)
+{
+  target->AddInformation(Transfer(source));
+}
+
+InformationVector Copy(const InformationVector& infos)
+{
+  InformationVector copy;
+  for (const auto& info : infos)
+  {
+    copy.push_back(Transfer(info));
+  }
+  return copy;
+}
+
+double FlatReduction(InformationVector infos)
+{
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  for (size_t rank = 1; rank < infos.size(); ++rank)
+  {
+    Merge(infos[0], infos[rank]);
+  }
+  timer->StopTimer();
+  return timer->GetElapsedTime();
+}
+
+double TreeReduction(InformationVector infos)
+{
+  const int nranks = static_cast<int>(infos.size());
+  vtkNew<vtkTimerLog> timer;
+  double criticalPath = 0;
+  for (int step = 1; step < nranks; step *= 2)
+  {
+    double slowest = 0;
+    for (int rank = 0; rank + step < nranks; rank += 2 * step)
+    {
+      timer->StartTimer();
+      Merge(infos[rank], infos[rank + step]);
+      timer->StopTimer();
+      slowest = std::max(slowest, timer->GetElapsedTime());
+    }
+    criticalPath += slowest;
+  }
+  return criticalPath;
+}
+}
+
+int TestCollectInformationScaling(int, char* [])
+{
+  const int maxRanks = 4096;
+  vtkNew<vtkSphereSource> sphere;
+  InformationVector infos;
+  for (int rank = 0; rank < maxRanks; ++rank)
+  {
+    sphere->SetCenter(rank, 0, 0);
+    sphere->Update();
+    auto info = vtkSmartPointer<vtkPVDataInformation>::New();
+    info->CopyFromObject(sphere->GetOutput());
+    infos.push_back(info);
+  }
+
+  for (int nranks = 16; nranks <= maxRanks; nranks *= 4)
+  {
+    InformationVector flat = Copy(InformationVector(infos.begin(), infos.begin() + nranks));
+    InformationVector tree = Copy(flat);
+    const double flatTime = FlatReduction(flat);
+    const double treeTime = TreeReduction(tree);
+
+    double flatBounds[6], treeBounds[6];
+    flat[0]->GetBounds(flatBounds);
+    tree[0]->GetBounds(treeBounds);
+    if (flat[0]->GetNumberOfPoints() != tree[0]->GetNumberOfPoints() ||
+      flat[0]->GetNumberOfCells() != tree[0]->GetNumberOfCells() ||
+      !std::equal(flatBounds, flatBounds + 6, treeBounds) ||
+      flatBounds[1] != infos[nranks - 1]->GetBounds()[1])
+    {
+      cerr << "ERROR: the reductions differ for " << nranks << " ranks." << endl;
+      return EXIT_FAILURE;
+    }
+    cout << nranks << " ranks: flat reduction " << flatTime << "s, tree reduction critical path "
+         << treeTime << "s" << endl;
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,187 @@
+/*=========================================================================
+
+Program:   ParaView
+Module:    TestProxyDefinitionCache.cxx
+
+Copyright (c) Kitware, Inc.
+All rights reserved.
+See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the binary form of vtkPVXMLElement gives back the core proxy
+// definitions, and that vtkSIProxyDefinitionManager gives the same collapsed
+// definitions with and without the proxy definitions cache. The time spent
+// parsing the XML and reading the binary form, and the time taken to create a
+// definition manager without cache, with an empty cache and with a filled
+// cache are reported.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkPVOptions.h"
+#include "vtkPVPlugin.h"
+#include "vtkPVPluginTracker.h"
+#include "vtkPVServerManagerPluginInterface.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkSIProxyDefinitionManager.h"
+#include "vtkSmartPointer.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+
+#include <vtksys/Directory.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+bool GetCoreXMLs(std::vector<std::string>& xmls)
+{
+  vtkPVPluginTracker* tracker = vtkPVPluginTracker::GetInstance();
+  for (unsigned int cc = 0; cc < tracker->GetNumberOfPlugins(); ++cc)
+  {
+    vtkPVPlugin* plugin = tracker->GetPlugin(cc);
+    vtkPVServerManagerPluginInterface* smplugin =
+      dynamic_cast<vtkPVServerManagerPluginInterface*>(plugin);
+    if (smplugin && strcmp(plugin->GetPluginName(), "vtkPVInitializerPlugin") == 0)
+    {
+      smplugin->GetXMLs(xmls);
+      return !xmls.empty();
+    }
+  }
+  return false;
+}
+
+vtkSIProxyDefinitionManager* CreateManager(double& time)
+{
+  const double start = vtkTimerLog::GetUniversalTime();
+  vtkSIProxyDefinitionManager* manager = vtkSIProxyDefinitionManager::New();
+  time = vtkTimerLog::GetUniversalTime() - start;
+  return manager;
+}
+
+bool SameDefinitions(vtkSIProxyDefinitionManager* manager, vtkSIProxyDefinitionManager* expected)
+{
+  const char* proxies[][2] = { { "sources", "SphereSource" }, { "filters", "Cut" },
+    { "representations", "GeometryRepresentation" }, { "views", "RenderView" },
+    { "lookup_tables", "PVLookupTable" } };
+  for (auto& proxy : proxies)
+  {
+    vtkPVXMLElement* reference =
+      expected->GetCollapsedProxyDefinition(proxy[0], proxy[1], nullptr, false);
+    vtkPVXMLElement* definition =
+      manager->GetCollapsedProxyDefinition(proxy[0], proxy[1], nullptr, false);
+    if (reference ? !reference->Equals(definition) : definition != nullptr)
+    {
+      cerr << "ERROR: the definitions of " << proxy[0] << "/" << proxy[1] << " differ." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestProxyDefinitionCache(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return EXIT_FAILURE;
+  }
+  const std::string cacheDir = std::string(tempDir) + "/ProxyDefinitionCache";
+  delete[] tempDir;
+
+  vtkPVOptions* options = vtkPVOptions::New();
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT, options);
+
+  int status = EXIT_SUCCESS;
+  std::vector<std::string> xmls;
+  if (!GetCoreXMLs(xmls))
+  {
+    cerr << "ERROR: could not find the core proxy definitions." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  size_t xmlSize = 0, binarySize = 0;
+  double parseTime = 0, readTime = 0;
+  for (size_t cc = 0; cc < xmls.size() && status == EXIT_SUCCESS; ++cc)
+  {
+    double start = vtkTimerLog::GetUniversalTime();
+    vtkNew<vtkPVXMLParser> parser;
+    if (!parser->Parse(xmls[cc].c_str()))
+    {
+      cerr << "ERROR: could not parse the core proxy definitions." << endl;
+      status = EXIT_FAILURE;
+      break;
+    }
+    parseTime += vtkTimerLog::GetUniversalTime() - start;
+
+    std::string buffer;
+    parser->GetRootElement()->PrintBinary(buffer);
+    start = vtkTimerLog::GetUniversalTime();
+    vtkSmartPointer<vtkPVXMLElement> root;
+    root.TakeReference(vtkPVXMLElement::ReadBinary(buffer.c_str(), buffer.size()));
+    readTime += vtkTimerLog::GetUniversalTime() - start;
+    xmlSize += xmls[cc].size();
+    binarySize += buffer.size();
+
+    vtkSmartPointer<vtkPVXMLElement> truncated;
+    truncated.TakeReference(vtkPVXMLElement::ReadBinary(buffer.c_str(), buffer.size() - 1));
+    if (!root || !root->Equals(parser->GetRootElement()) || truncated)
+    {
+      cerr << "ERROR: the binary form of the core proxy definitions is not valid." << endl;
+      status = EXIT_FAILURE;
+    }
+  }
+
+  if (status == EXIT_SUCCESS)
+  {
+    cout << xmls.size() << " core definition files (" << xmlSize << " bytes of XML, " << binarySize
+         << " bytes of binary): parse " << parseTime << "s, binary read " << readTime << "s"
+         << endl;
+
+    vtksys::SystemTools::RemoveADirectory(cacheDir);
+    vtksys::SystemTools::MakeDirectory(cacheDir);
+
+    double noCacheTime, emptyCacheTime, filledCacheTime;
+    vtksys::SystemTools::PutEnv("PV_PROXY_DEFINITIONS_CACHE=");
+    vtkSmartPointer<vtkSIProxyDefinitionManager> expected;
+    expected.TakeReference(CreateManager(noCacheTime));
+    vtksys::SystemTools::PutEnv("PV_PROXY_DEFINITIONS_CACHE=" + cacheDir);
+    vtkSmartPointer<vtkSIProxyDefinitionManager> emptyCache;
+    emptyCache.TakeReference(CreateManager(emptyCacheTime));
+    vtkSmartPointer<vtkSIProxyDefinitionManager> filledCache;
+    filledCache.TakeReference(CreateManager(filledCacheTime));
+    vtksys::SystemTools::PutEnv("PV_PROXY_DEFINITIONS_CACHE=");
+
+    // The cache holds files besides "." and "..".
+    vtksys::Directory cache;
+    if (!cache.Load(cacheDir) || cache.GetNumberOfFiles() <= 2)
+    {
+      cerr << "ERROR: the proxy definitions cache was not written." << endl;
+      status = EXIT_FAILURE;
+    }
+
+    cout << "Definition manager: no cache " << noCacheTime << "s, empty cache " << emptyCacheTime
+         << "s, filled cache " << filledCacheTime << "s" << endl;
+
+    if (!SameDefinitions(emptyCache, expected) || !SameDefinitions(filledCache, expected))
+    {
+      status = EXIT_FAILURE;
+    }
+    vtksys::SystemTools::RemoveADirectory(cacheDir);
+  }
+
+  vtkInitializationHelper::Finalize();
+  options->Delete();
+  return status;
+}
@@ -0,0 +1,193 @@
+/*=========================================================================
+
+Program:   ParaView
+Module:    TestStateLoaderScaling.cxx
+
+Copyright (c) Kitware, Inc.
+All rights reserved.
+See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+This software is distributed WITHOUT ANY WARRANTY; without even
+the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Scaling benchmark for vtkSMStateLoader. Synthetic states made of pairs of a
+// sphere source and a shrink filter using it as input are saved, then parsed
+// and loaded back. The time spent in each phase of the load is reported:
+// parsing the XML, creating the proxies and loading their state,
+// UpdateVTKObjects() and registering the proxies. Only small states are
+// loaded by default to keep the test fast; the largest number of proxies, up
+// to 20000, can be given with the --max-proxies argument for the full sweep.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVOptions.h"
+#include "vtkPVXMLElement.h"
+#include "vtkPVXMLParser.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMProxyManager.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMStateLoader.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+
+#include <cstdlib>
+#include <cstring>
+#include <sstream>
+#include <string>
+
+namespace
+{
+// State loader accumulating the time spent in UpdateVTKObjects() and in
+// registering the proxies.
+class vtkTimedStateLoader : public vtkSMStateLoader
+{
+public:
+  static vtkTimedStateLoader* New();
+  vtkTypeMacro(vtkTimedStateLoader, vtkSMStateLoader);
+
+  double UpdateTime = 0;
+  double RegisterTime = 0;
+
+protected:
+  vtkTimedStateLoader() = default;
+
+  void CreatedNewProxy(vtkTypeUInt32 id, vtkSMProxy* proxy) override
+  {
+    const double registerTime = this->RegisterTime;
+    const double start = vtkTimerLog::GetUniversalTime();
+    this->Superclass::CreatedNewProxy(id, proxy);
+    // Proxies that are not deferred get registered in CreatedNewProxy().
+    this->UpdateTime +=
+      vtkTimerLog::GetUniversalTime() - start - (this->RegisterTime - registerTime);
+  }
+
+  void RegisterProxyInternal(const char* group, const char* name, vtkSMProxy* proxy) override
+  {
+    const double start = vtkTimerLog::GetUniversalTime();
+    this->Superclass::RegisterProxyInternal(group, name, proxy);
+    this->RegisterTime += vtkTimerLog::GetUniversalTime() - start;
+  }
+
+private:
+  vtkTimedStateLoader(const vtkTimedStateLoader&) = delete;
+  void operator=(const vtkTimedStateLoader&) = delete;
+};
+vtkStandardNewMacro(vtkTimedStateLoader);
+
+std::string SaveState(vtkSMSessionProxyManager* pxm, int numberOfPairs)
+{
+  for (int cc = 0; cc < numberOfPairs; ++cc)
+  {
+    vtkSmartPointer<vtkSMProxy> sphere;
+    sphere.TakeReference(pxm->NewProxy("sources", "SphereSource"));
+    vtkSMPropertyHelper(sphere, "Center").Set(0, static_cast<double>(cc));
+    sphere->UpdateVTKObjects();
+
+    vtkSmartPointer<vtkSMProxy> shrink;
+    shrink.TakeReference(pxm->NewProxy("filters", "ShrinkFilter"));
+    vtkSMPropertyHelper(shrink, "Input").Set(sphere);
+    shrink->UpdateVTKObjects();
+
+    const std::string name = std::to_string(cc);
+    pxm->RegisterProxy("sources", ("Sphere" + name).c_str(), sphere);
+    pxm->RegisterProxy("sources", ("Shrink" + name).c_str(), shrink);
+  }
+
+  vtkSmartPointer<vtkPVXMLElement> root;
+  root.TakeReference(pxm->SaveXMLState());
+  std::ostringstream xml;
+  root->PrintXML(xml, vtkIndent());
+  pxm->UnRegisterProxies();
+  return xml.str();
+}
+
+bool CheckState(vtkSMSessionProxyManager* pxm, int numberOfPairs)
+{
+  if (static_cast<int>(pxm->GetNumberOfProxies("sources")) != 2 * numberOfPairs)
+  {
+    return false;
+  }
+  for (int cc = 0; cc < numberOfPairs; ++cc)
+  {
+    const std::string name = std::to_string(cc);
+    vtkSMProxy* sphere = pxm->GetProxy("sources", ("Sphere" + name).c_str());
+    vtkSMProxy* shrink = pxm->GetProxy("sources", ("Shrink" + name).c_str());
+    if (!sphere || !shrink || vtkSMPropertyHelper(shrink, "Input").GetAsProxy() != sphere ||
+      vtkSMPropertyHelper(sphere, "Center").GetAsDouble(0) != cc)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestStateLoaderScaling(int argc, char* argv[])
+{
+  int maxProxies = 200;
+  for (int cc = 1; cc < argc - 1; ++cc)
+  {
+    if (strcmp(argv[cc], "--max-proxies") == 0)
+    {
+      maxProxies = atoi(argv[cc + 1]);
+    }
+  }
+
+  vtkPVOptions* options = vtkPVOptions::New();
+  vtkInitializationHelper::Initialize(argc, argv, vtkProcessModule::PROCESS_CLIENT, options);
+  vtkSMSession* session = vtkSMSession::New();
+  vtkSMSessionProxyManager* pxm =
+    vtkSMProxyManager::GetProxyManager()->GetSessionProxyManager(session);
+
+  int status = EXIT_SUCCESS;
+  const int sizes[] = { 100, 1000, 5000, 20000 };
+  for (int numberOfProxies : sizes)
+  {
+    numberOfProxies = numberOfProxies < maxProxies ? numberOfProxies : maxProxies;
+    const int numberOfPairs = numberOfProxies / 2;
+    const std::string xml = SaveState(pxm, numberOfPairs);
+
+    double start = vtkTimerLog::GetUniversalTime();
+    vtkNew<vtkPVXMLParser> parser;
+    if (!parser->Parse(xml.c_str()))
+    {
+      cerr << "ERROR: could not parse the state of " << numberOfProxies << " proxies." << endl;
+      status = EXIT_FAILURE;
+      break;
+    }
+    const double parseTime = vtkTimerLog::GetUniversalTime() - start;
+
+    vtkNew<vtkTimedStateLoader> loader;
+    loader->SetSessionProxyManager(pxm);
+    start = vtkTimerLog::GetUniversalTime();
+    pxm->LoadXMLState(parser->GetRootElement(), loader);
+    const double loadTime = vtkTimerLog::GetUniversalTime() - start;
+
+    if (!CheckState(pxm, numberOfPairs))
+    {
+      cerr << "ERROR: the state of " << numberOfProxies << " proxies was not loaded correctly."
+           << endl;
+      status = EXIT_FAILURE;
+      break;
+    }
+    pxm->UnRegisterProxies();
+
+    cout << numberOfProxies << " proxies: parse " << parseTime << "s, create "
+         << loadTime - loader->UpdateTime - loader->RegisterTime << "s, UpdateVTKObjects "
+         << loader->UpdateTime << "s, register " << loader->RegisterTime << "s" << endl;
+    if (numberOfProxies == maxProxies)
+    {
+      break;
+    }
+  }
+
+  session->Delete();
+  vtkInitializationHelper::Finalize();
+  options->Delete();
+  return status;
+}
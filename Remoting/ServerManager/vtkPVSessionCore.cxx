@@ -42,6 +42,8 @@
 #include <set>
 #include <sstream>
 #include <string>
+#include <utility>
+#include <vector>
 
 #define LOG(x)                                                                                     \
   if (this->LogStream)                                                                             \
@@ -886,21 +888,8 @@ void vtkPVSessionCore::GatherInformationStatelliteCallback()
 }
 
 //----------------------------------------------------------------------------
-#define SafeDeleteArray(array_ptr)                                                                 \
-  {                                                                                                \
-    if (array_ptr != NULL)                                                                         \
-    {                                                                                              \
-      delete[] array_ptr;                                                                          \
-      array_ptr = NULL;                                                                            \
-    }                                                                                              \
-  }
-
 bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
 {
-  // Sanity checks
-  assert("pre: NULL PV information!" && (info != NULL));
-
-  // STEP 0: temporary variables
   int rank = this->ParallelController->GetLocalProcessId();
   int nranks = this->ParallelController->GetNumberOfProcesses();
 
@@ -910,82 +899,87 @@ bool vtkPVSessionCore::CollectInformation(vtkPVInformation* info)
     return true;
   }
 
-  vtkIdType* rcvcounts = NULL;     /* significant only at rank 0 */
-  vtkIdType* offSet = NULL;        /* significant only at rank 0 */
-  int rbufsize = 0;                /* significant only at rank 0 */
-  unsigned char* rcvbuffer = NULL; /* significant only at rank 0 */
-
-  // STEP 1: Initialize data-structures at rank 0
-  if (rank == 0)
+  // Information is reduced along a binomial tree: at each step, the ranks
+  // that are multiples of 2*step merge the information collected by
+  // rank + step, which covers the ranks that follow, and the others send
+  // theirs and are done. This keeps the merge order of a sequential gather
+  // while rank 0 only merges log2(nranks) partial results.
+  // info is NULL on satellites that failed to gather their information; they
+  // still take part so that the other ranks do not hang, and forward the
+  // information received from their subtree unchanged so that it is not lost.
+  // Each rank sends the number of serialized information objects, then the
+  // length and data of each.
+  std::vector<std::vector<unsigned char> > forwarded;
+  for (int step = 1; step < nranks; step *= 2)
   {
-    rcvcounts = new vtkIdType[nranks];
-    offSet = new vtkIdType[nranks];
-  } // END if rank == 0
-
-  // STEP 2: Serialize the vtkPVInformation object
-  vtkClientServerStream stream;
-  info->CopyToStream(&stream);
-
-  const unsigned char* data;
-  size_t length;
-
-  // Get pointer to the raw stream data. Note, this is a shallow copy, no
-  // need to delete the data.
-  stream.GetData(&data, &length);
-  vtkIdType local_length = static_cast<vtkIdType>(length);
-
-  // STEP 3: Get number of bytes that each process will send
-  this->ParallelController->Gather(&local_length, rcvcounts, 1, 0);
-
-  // STEP 4: Allocate temporary arrays at rank 0
-  if (rank == 0)
-  {
-    // STEP 4.1: Calculate rcvbuffer size & allocate rcvbuffer
-    rbufsize = rcvcounts[0];
-    for (int i = 1; i < nranks; ++i)
+    if (rank % (2 * step) != 0)
     {
-      rbufsize += rcvcounts[i];
-    }
-    rcvbuffer = new unsigned char[rbufsize];
+      vtkClientServerStream stream;
+      std::vector<std::pair<const unsigned char*, vtkIdType> > buffers;
+      if (info)
+      {
+        const unsigned char* data = NULL;
+        size_t length = 0;
+        info->CopyToStream(&stream);
+        stream.GetData(&data, &length);
+        buffers.push_back(std::make_pair(data, static_cast<vtkIdType>(length)));
+      }
+      else
+      {
+        for (const auto& buffer : forwarded)
+        {
+          buffers.push_back(
+            std::make_pair(buffer.data(), static_cast<vtkIdType>(buffer.size())));
+        }
+      }
 
-    // STEP 4.2: populate offset array
-    offSet[0] = 0;
-    for (int i = 1; i < nranks; ++i)
-    {
-      offSet[i] = offSet[i - 1] + rcvcounts[i - 1];
+      vtkIdType count = static_cast<vtkIdType>(buffers.size());
+      this->ParallelController->Send(&count, 1, rank - step, ROOT_SATELLITE_INFO_TAG);
+      for (const auto& buffer : buffers)
+      {
+        vtkIdType local_length = buffer.second;
+        this->ParallelController->Send(&local_length, 1, rank - step, ROOT_SATELLITE_INFO_TAG);
+        if (local_length > 0)
+        {
+          this->ParallelController->Send(
+            buffer.first, local_length, rank - step, ROOT_SATELLITE_INFO_TAG);
+        }
+      }
+      break;
     }
-  } // END if rank==0
-
-  // STEP 5: GatherV all data from satellites
-  this->ParallelController->GatherV(data, rcvbuffer, local_length, rcvcounts, offSet, 0);
 
-  // STEP 6: Deserialize data from other ranks at rank 0 and add them to
-  // the information object associated with rank 0.
-  if (rank == 0)
-  {
-    vtkClientServerStream rcvStream;
-    for (int i = 1; i < nranks; ++i)
+    if (rank + step < nranks)
     {
-      rcvStream.SetData(&rcvbuffer[offSet[i]], rcvcounts[i]);
-      vtkPVInformation* tempInfo = info->NewInstance();
-      tempInfo->CopyFromStream(&rcvStream);
-      info->AddInformation(tempInfo);
-      tempInfo->Delete();
-    } // END for all remote ranks
-  }   // END if rank == 0
-
-  // STEP 7: De-allocate temporary arrays at rank 0
-  SafeDeleteArray(rcvcounts);
-  SafeDeleteArray(offSet);
-  SafeDeleteArray(rcvbuffer);
-
-  // Sanity checks -- ensure we return all dynamically allocated memory
-  assert("post: rcvcounts should be NULL" && (rcvcounts == NULL));
-  assert("post: offSet should be NULL" && (offSet == NULL));
-  assert("post: rcvbuffer should be NULL" && (rcvbuffer == NULL));
-
-  // STEP 8: Barrier synchronization
-  this->ParallelController->Barrier();
+      vtkIdType count = 0;
+      this->ParallelController->Receive(&count, 1, rank + step, ROOT_SATELLITE_INFO_TAG);
+      for (vtkIdType cc = 0; cc < count; ++cc)
+      {
+        vtkIdType remote_length = 0;
+        this->ParallelController->Receive(
+          &remote_length, 1, rank + step, ROOT_SATELLITE_INFO_TAG);
+        if (remote_length <= 0)
+        {
+          continue;
+        }
+        std::vector<unsigned char> rcvbuffer(remote_length);
+        this->ParallelController->Receive(
+          rcvbuffer.data(), remote_length, rank + step, ROOT_SATELLITE_INFO_TAG);
+        if (info)
+        {
+          vtkClientServerStream rcvStream;
+          rcvStream.SetData(rcvbuffer.data(), remote_length);
+          vtkPVInformation* tempInfo = info->NewInstance();
+          tempInfo->CopyFromStream(&rcvStream);
+          info->AddInformation(tempInfo);
+          tempInfo->Delete();
+        }
+        else
+        {
+          forwarded.push_back(std::move(rcvbuffer));
+        }
+      }
+    }
+  }
   return true;
 }
 
@@ -211,7 +211,8 @@ protected:
   bool GatherInformationInternal(vtkPVInformation* information, vtkTypeUInt32 globalid);
 
   /**
-   * Gather information across MPI satellites.
+   * Gather information across MPI satellites. Partial information is merged
+   * along a binomial tree so that the root only merges log2(N) of them.
    */
   bool CollectInformation(vtkPVInformation*);
 
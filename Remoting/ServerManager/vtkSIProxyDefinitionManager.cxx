@@ -35,13 +35,26 @@
 #include "vtkTimerLog.h"
 
 #include <cassert>
+#include <cstring>
 #include <map>
 #include <set>
 #include <sstream>
 #include <string>
 #include <vector>
 
+#include <vtksys/FStream.hxx>
 #include <vtksys/RegularExpression.hxx>
+#include <vtksys/SystemTools.hxx>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include <vtksys/Encoding.hxx>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 //****************************************************************************/
 //                    Internal Classes and typedefs
@@ -191,6 +204,149 @@ public:
     }
   }
 };
+//****************************************************************************/
+namespace
+{
+// Read-only file mapped in memory.
+class vtkSIMappedFile
+{
+public:
+  vtkSIMappedFile() = default;
+  ~vtkSIMappedFile() { this->Close(); }
+
+  bool Open(const char* filename)
+  {
+    this->Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+      CloseHandle(file);
+      return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+      return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+    {
+      return false;
+    }
+    this->Size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    struct stat fs;
+    if (fstat(fd, &fs) != 0 || fs.st_size <= 0)
+    {
+      close(fd);
+      return false;
+    }
+    void* data = mmap(NULL, static_cast<size_t>(fs.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return false;
+    }
+    this->Size = static_cast<size_t>(fs.st_size);
+#endif
+    this->Data = static_cast<char*>(data);
+    return true;
+  }
+
+  void Close()
+  {
+    if (this->Data)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(this->Data);
+#else
+      munmap(this->Data, this->Size);
+#endif
+    }
+    this->Data = nullptr;
+    this->Size = 0;
+  }
+
+  const char* GetData() const { return this->Data; }
+  size_t GetSize() const { return this->Size; }
+
+private:
+  vtkSIMappedFile(const vtkSIMappedFile&) = delete;
+  void operator=(const vtkSIMappedFile&) = delete;
+
+  char* Data = nullptr;
+  size_t Size = 0;
+};
+
+//---------------------------------------------------------------------------
+// Returns the file of the proxy definitions cache holding the binary form of
+// the given XML, or an empty string if the cache is not enabled. The files are
+// named after the length and a FNV-1a hash of the XML, so a file never needs to
+// be invalidated: changed definitions simply use another file.
+std::string vtkGetProxyDefinitionsCacheFile(const char* xmlContent)
+{
+  const char* dir = vtksys::SystemTools::GetEnv("PV_PROXY_DEFINITIONS_CACHE");
+  if (!dir || !*dir || !xmlContent)
+  {
+    return std::string();
+  }
+
+  vtkTypeUInt64 hash = 14695981039346656037ull;
+  size_t length = 0;
+  for (const char* c = xmlContent; *c; ++c, ++length)
+  {
+    hash = (hash ^ static_cast<unsigned char>(*c)) * 1099511628211ull;
+  }
+  std::ostringstream name;
+  name << dir << "/" << std::hex << hash << "-" << length << ".pvxmlbin";
+  return name.str();
+}
+
+//---------------------------------------------------------------------------
+// Writes the binary form of the definitions in the cache. Only the first
+// process writes, through a temporary file named after its pid and renamed
+// once complete, so that other processes never read a partial file and
+// concurrent writers do not write the same temporary file.
+void vtkWriteProxyDefinitionsCache(const std::string& filename, vtkPVXMLElement* root)
+{
+  vtkProcessModule* pm = vtkProcessModule::GetProcessModule();
+  if (pm && pm->GetPartitionId() != 0)
+  {
+    return;
+  }
+
+  std::string buffer;
+  root->PrintBinary(buffer);
+#ifdef _WIN32
+  const unsigned long pid = GetCurrentProcessId();
+#else
+  const long pid = static_cast<long>(getpid());
+#endif
+  const std::string tmpname = filename + "." + std::to_string(pid) + ".tmp";
+  vtksys::ofstream file(tmpname.c_str(), ios::out | ios::binary);
+  file.write(buffer.c_str(), static_cast<std::streamsize>(buffer.size()));
+  file.close();
+  if (file.fail() || !vtksys::SystemTools::RenameFile(tmpname, filename))
+  {
+    vtksys::SystemTools::RemoveFile(tmpname);
+  }
+}
+}
+
 //****************************************************************************/
 class vtkInternalDefinitionIterator : public vtkPVProxyDefinitionIterator
 {
@@ -765,9 +921,33 @@ bool vtkSIProxyDefinitionManager::LoadConfigurationXMLFromString(const char* xml
 bool vtkSIProxyDefinitionManager::LoadConfigurationXMLFromString(
   const char* xmlContent, bool attachHints)
 {
-  vtkNew<vtkPVXMLParser> parser;
-  return (parser->Parse(xmlContent) != 0) &&
-    this->LoadConfigurationXML(parser->GetRootElement(), attachHints);
+  // Use the binary form of the definitions from the cache, if any, since it
+  // is much faster to load than parsing the XML.
+  const std::string cacheFile = vtkGetProxyDefinitionsCacheFile(xmlContent);
+  vtkSmartPointer<vtkPVXMLElement> root;
+  if (!cacheFile.empty())
+  {
+    vtkSIMappedFile file;
+    if (file.Open(cacheFile.c_str()))
+    {
+      root.TakeReference(vtkPVXMLElement::ReadBinary(file.GetData(), file.GetSize()));
+    }
+  }
+
+  if (!root)
+  {
+    vtkNew<vtkPVXMLParser> parser;
+    if (parser->Parse(xmlContent) == 0)
+    {
+      return false;
+    }
+    root = parser->GetRootElement();
+    if (!cacheFile.empty())
+    {
+      vtkWriteProxyDefinitionsCache(cacheFile, root);
+    }
+  }
+  return this->LoadConfigurationXML(root, attachHints);
 }
 
 //---------------------------------------------------------------------------
@@ -21,6 +21,14 @@
  * It maintains a map of vtkPVXMLElement (populated by the XML parser) from
  * which it can extract Hint, Documentation, Properties, Domains definition.
  *
+ * Parsing the XML of the definitions is a significant part of the startup
+ * time, repeated on every process. When the environment variable
+ * PV_PROXY_DEFINITIONS_CACHE is set to a directory, the definitions loaded
+ * from strings are cached in it in the binary form of vtkPVXMLElement, and
+ * loaded from the cache instead of parsing the XML afterwards. Cache files are
+ * named after a hash of the XML, so they never become stale, and are only
+ * written by the first process.
+ *
  * This class fires the following events:
  * \li \c vtkSIProxyDefinitionManager::ProxyDefinitionsUpdated - Fired any time
  * any definitions are updated. If a group of definitions are being updated (i.e.
@@ -151,7 +159,8 @@ public:
 
   //@{
   /**
-   * Loads server-manager configuration xml.
+   * Loads server-manager configuration xml. LoadConfigurationXMLFromString()
+   * uses the proxy definitions cache when it is enabled.
    */
   bool LoadConfigurationXML(vtkPVXMLElement* root);
   bool LoadConfigurationXMLFromString(const char* xmlContent);
@@ -32,6 +32,8 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <cstring>
+#include <map>
 #include <vector>
 
 vtkObjectFactoryNewMacro(vtkSMStateLoader);
@@ -59,11 +61,74 @@ struct vtkSMStateLoaderInternals
   ProxyCreationOrderType ProxyCreationOrder;
   bool DeferProxyRegistration;
 
+  /// Index of the proxy elements of the state being loaded by id, built once
+  /// in LoadStateInternal() so that LocateProxyElement() does not have to scan
+  /// the whole state for every proxy referenced.
+  typedef std::map<vtkIdType, vtkPVXMLElement*> ProxyElementIndexType;
+  ProxyElementIndexType ProxyElementIndex;
+  vtkPVXMLElement* IndexedElement;
+
   vtkSMStateLoaderInternals()
     : KeepOriginalId(false)
     , DeferProxyRegistration(false)
+    , IndexedElement(nullptr)
   {
   }
+
+  /// Adds the proxy elements under root to the index, in the order
+  /// vtkSMStateLoader::LocateProxyElementInternal() searches them so that the
+  /// same element is found when several proxies share an id.
+  void IndexProxyElements(vtkPVXMLElement* root)
+  {
+    const unsigned int numElems = root->GetNumberOfNestedElements();
+    for (unsigned int i = 0; i < numElems; i++)
+    {
+      vtkPVXMLElement* currentElement = root->GetNestedElement(i);
+      vtkIdType currentId;
+      if (currentElement->GetName() && strcmp(currentElement->GetName(), "Proxy") == 0 &&
+        currentElement->GetScalarAttribute("id", &currentId))
+      {
+        this->ProxyElementIndex.insert(std::make_pair(currentId, currentElement));
+      }
+    }
+    for (unsigned int i = 0; i < numElems; i++)
+    {
+      this->IndexProxyElements(root->GetNestedElement(i));
+    }
+  }
+
+  void BuildProxyElementIndex(vtkPVXMLElement* root)
+  {
+    this->ClearProxyElementIndex();
+    this->IndexProxyElements(root);
+    this->IndexedElement = root;
+  }
+
+  void ClearProxyElementIndex()
+  {
+    this->ProxyElementIndex.clear();
+    this->IndexedElement = nullptr;
+  }
+
+  /// Builds the proxy element index and clears it when going out of scope,
+  /// so that it never outlives the state being loaded, whichever way
+  /// LoadStateInternal() returns.
+  class ProxyElementIndexGuard
+  {
+  public:
+    ProxyElementIndexGuard(vtkSMStateLoaderInternals* internals, vtkPVXMLElement* root)
+      : Internals(internals)
+    {
+      this->Internals->BuildProxyElementIndex(root);
+    }
+    ~ProxyElementIndexGuard() { this->Internals->ClearProxyElementIndex(); }
+
+  private:
+    ProxyElementIndexGuard(const ProxyElementIndexGuard&) = delete;
+    void operator=(const ProxyElementIndexGuard&) = delete;
+
+    vtkSMStateLoaderInternals* Internals;
+  };
 };
 
 //---------------------------------------------------------------------------
@@ -315,6 +380,12 @@ bool vtkSMStateLoader::UpdateRegistrationInfo(
 //---------------------------------------------------------------------------
 vtkPVXMLElement* vtkSMStateLoader::LocateProxyElement(vtkTypeUInt32 id)
 {
+  if (this->ServerManagerStateElement &&
+    this->ServerManagerStateElement == this->Internal->IndexedElement)
+  {
+    auto iter = this->Internal->ProxyElementIndex.find(static_cast<vtkIdType>(id));
+    return iter != this->Internal->ProxyElementIndex.end() ? iter->second : nullptr;
+  }
   return this->LocateProxyElementInternal(this->ServerManagerStateElement, id);
 }
 
@@ -586,6 +657,7 @@ int vtkSMStateLoader::LoadStateInternal(vtkPVXMLElement* parent)
   }
 
   this->ServerManagerStateElement = rootElement;
+  vtkSMStateLoaderInternals::ProxyElementIndexGuard indexGuard(this->Internal, rootElement);
 
   unsigned int numElems = rootElement->GetNumberOfNestedElements();
   unsigned int i;
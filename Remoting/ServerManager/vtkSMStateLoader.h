@@ -141,7 +141,8 @@ protected:
   /**
    * Return the xml element for the state of the proxy with the given id.
    * This is used by NewProxy() when the proxy with the given id
-   * is not located in the internal CreatedProxies map.
+   * is not located in the internal CreatedProxies map. While loading a state,
+   * the elements are looked up in an index built once by LoadStateInternal().
    */
   vtkPVXMLElement* LocateProxyElement(vtkTypeUInt32 id) override;
 
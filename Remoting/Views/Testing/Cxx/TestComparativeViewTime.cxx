@@ -0,0 +1,119 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestComparativeViewTime.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks that vtkPVComparativeView::Update() only updates the cells whose time
+// changed: changing the view time updates no cell when a cue animates the time,
+// and every cell otherwise.
+
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVComparativeView.h"
+#include "vtkProcessModule.h"
+#include "vtkSMComparativeAnimationCueProxy.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+
+namespace
+{
+// Counts the cells updated by Update().
+class vtkCountingComparativeView : public vtkPVComparativeView
+{
+public:
+  static vtkCountingComparativeView* New();
+  vtkTypeMacro(vtkCountingComparativeView, vtkPVComparativeView);
+
+  int NumberOfUpdatedCells = 0;
+
+protected:
+  vtkCountingComparativeView() = default;
+
+  void UpdateCell(int x, int y, double time, vtkSMComparativeAnimationCueProxy* timeCue) override
+  {
+    ++this->NumberOfUpdatedCells;
+    this->Superclass::UpdateCell(x, y, time, timeCue);
+  }
+
+private:
+  vtkCountingComparativeView(const vtkCountingComparativeView&) = delete;
+  void operator=(const vtkCountingComparativeView&) = delete;
+};
+vtkStandardNewMacro(vtkCountingComparativeView);
+
+bool CheckUpdate(vtkCountingComparativeView* view, int expected, const char* when)
+{
+  view->NumberOfUpdatedCells = 0;
+  view->Update();
+  if (view->NumberOfUpdatedCells != expected)
+  {
+    cerr << "ERROR: " << view->NumberOfUpdatedCells << " cells updated " << when << ", expected "
+         << expected << "." << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestComparativeViewTime(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session.Get());
+  controller->InitializeSession(session.Get());
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> rootView;
+  rootView.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(rootView);
+  rootView->UpdateVTKObjects();
+
+  // A cue without animated proxy animates the time of the cells.
+  vtkSmartPointer<vtkSMComparativeAnimationCueProxy> timeCue;
+  timeCue.TakeReference(vtkSMComparativeAnimationCueProxy::SafeDownCast(
+    pxm->NewProxy("animation", "ComparativeAnimationCue")));
+  timeCue->UpdateVTKObjects();
+  timeCue->UpdateWholeRange(1, 4);
+
+  const int numCells = 4;
+  bool success = true;
+  {
+    vtkNew<vtkCountingComparativeView> view;
+    view->Initialize(rootView);
+    view->Build(2, 2);
+
+    view->AddCue(timeCue);
+    view->SetViewTime(1.0);
+    success = success && CheckUpdate(view, numCells, "on the first update with a time cue");
+    success = success && CheckUpdate(view, 0, "when nothing changed");
+    view->SetViewTime(2.0);
+    success = success && CheckUpdate(view, 0, "on a view time change with a time cue");
+
+    view->RemoveCue(timeCue);
+    success = success && CheckUpdate(view, numCells, "once the time cue was removed");
+    view->SetViewTime(3.0);
+    success = success && CheckUpdate(view, numCells, "on a view time change without time cue");
+    success = success && CheckUpdate(view, 0, "when nothing changed");
+  }
+
+  timeCue = nullptr;
+  rootView = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session.Get());
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,178 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestImageStrips.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Compresses an RGBA image in strips, as done by the server in
+// vtkPVClientServerSynchronizedRenderers, decompresses the strips into an image
+// as done by the client, and checks the result matches the image compressed
+// and decompressed in one piece, for each compressor preset of the image
+// compression settings.
+
+#include "vtkImageCompressor.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPVClientServerSynchronizedRenderers.h"
+#include "vtkSmartPointer.h"
+#include "vtkUnsignedCharArray.h"
+
+#include <cstring>
+#include <string>
+
+namespace
+{
+// Gives access to the strip processing of the synchronized renderers.
+class vtkStripRenderers : public vtkPVClientServerSynchronizedRenderers
+{
+public:
+  static vtkStripRenderers* New();
+  vtkTypeMacro(vtkStripRenderers, vtkPVClientServerSynchronizedRenderers);
+
+  using vtkPVClientServerSynchronizedRenderers::CompressStrip;
+  using vtkPVClientServerSynchronizedRenderers::DecompressStrip;
+  using vtkPVClientServerSynchronizedRenderers::GetCompressor;
+  using vtkPVClientServerSynchronizedRenderers::GetStripRows;
+
+protected:
+  vtkStripRenderers() = default;
+
+private:
+  vtkStripRenderers(const vtkStripRenderers&) = delete;
+  void operator=(const vtkStripRenderers&) = delete;
+};
+vtkStandardNewMacro(vtkStripRenderers);
+
+const int Width = 257;
+const int Height = 203;
+const int NumberOfStrips = 4;
+
+vtkSmartPointer<vtkUnsignedCharArray> MakeImage()
+{
+  auto image = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  image->SetNumberOfComponents(4);
+  image->SetNumberOfTuples(Width * Height);
+  for (int j = 0; j < Height; ++j)
+  {
+    for (int i = 0; i < Width; ++i)
+    {
+      unsigned char* pixel = image->GetPointer(4 * (j * Width + i));
+      pixel[0] = static_cast<unsigned char>(i);
+      pixel[1] = static_cast<unsigned char>(j);
+      pixel[2] = static_cast<unsigned char>((i / 16 + j / 16) % 2 ? 200 : 30);
+      pixel[3] = 255;
+    }
+  }
+  return image;
+}
+
+// Compresses and decompresses the image in one piece.
+vtkSmartPointer<vtkUnsignedCharArray> RoundTrip(
+  vtkImageCompressor* compressor, vtkUnsignedCharArray* image, bool lossLess)
+{
+  vtkNew<vtkUnsignedCharArray> compressed;
+  auto result = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  result->SetNumberOfComponents(4);
+  result->SetNumberOfTuples(Width * Height);
+  compressor->SetLossLessMode(lossLess);
+  compressor->SetImageResolution(Width, Height);
+  compressor->SetInput(image);
+  compressor->SetOutput(compressed);
+  if (!compressor->Compress())
+  {
+    return nullptr;
+  }
+  compressor->SetInput(compressed);
+  compressor->SetOutput(result);
+  if (!compressor->Decompress())
+  {
+    return nullptr;
+  }
+  compressor->SetInput(nullptr);
+  compressor->SetOutput(nullptr);
+  return result;
+}
+
+// Compresses and decompresses the image in strips.
+vtkSmartPointer<vtkUnsignedCharArray> StripRoundTrip(
+  vtkImageCompressor* compressor, vtkUnsignedCharArray* image, bool lossLess)
+{
+  const std::string configuration = compressor->SaveConfiguration();
+  auto result = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  result->SetNumberOfComponents(4);
+  result->SetNumberOfTuples(Width * Height);
+  memset(result->GetPointer(0), 0, static_cast<size_t>(result->GetNumberOfValues()));
+  for (int cc = 0; cc < NumberOfStrips; ++cc)
+  {
+    int firstRow, lastRow;
+    vtkStripRenderers::GetStripRows(Height, NumberOfStrips, cc, firstRow, lastRow);
+    vtkSmartPointer<vtkUnsignedCharArray> strip = vtkStripRenderers::CompressStrip(
+      compressor, configuration.c_str(), lossLess, image, Width, firstRow, lastRow);
+    if (!strip ||
+      !vtkStripRenderers::DecompressStrip(compressor, configuration.c_str(), lossLess, strip,
+        result, Width, firstRow, lastRow))
+    {
+      return nullptr;
+    }
+  }
+  return result;
+}
+
+bool Equal(vtkUnsignedCharArray* a1, vtkUnsignedCharArray* a2)
+{
+  return a1->GetNumberOfValues() == a2->GetNumberOfValues() &&
+    memcmp(a1->GetPointer(0), a2->GetPointer(0), static_cast<size_t>(a1->GetNumberOfValues())) ==
+    0;
+}
+}
+
+int TestImageStrips(int, char* [])
+{
+  // The presets of pqImageCompressorWidget, and the default compressor.
+  const char* presets[] = { "vtkZlibImageCompressor 0 9 3 1", "vtkZlibImageCompressor 0 6 2 0",
+    "vtkLZ4Compressor 0 5", "vtkLZ4Compressor 0 3", "vtkSquirtCompressor 0 3" };
+
+  vtkSmartPointer<vtkUnsignedCharArray> image = MakeImage();
+  for (const char* preset : presets)
+  {
+    vtkNew<vtkStripRenderers> renderers;
+    renderers->ConfigureCompressor(preset);
+    vtkImageCompressor* compressor = renderers->GetCompressor();
+    if (!compressor)
+    {
+      cerr << "ERROR: could not create the compressor of '" << preset << "'." << endl;
+      return EXIT_FAILURE;
+    }
+
+    for (bool lossLess : { true, false })
+    {
+      vtkSmartPointer<vtkUnsignedCharArray> expected = RoundTrip(compressor, image, lossLess);
+      vtkSmartPointer<vtkUnsignedCharArray> result = StripRoundTrip(compressor, image, lossLess);
+      if (!expected || !result)
+      {
+        cerr << "ERROR: '" << preset << "' failed to process the image." << endl;
+        return EXIT_FAILURE;
+      }
+      if (!Equal(expected, result))
+      {
+        cerr << "ERROR: '" << preset << "' (loss-less: " << lossLess
+             << ") gives another image when processed in strips." << endl;
+        return EXIT_FAILURE;
+      }
+      if (lossLess && !Equal(image, result))
+      {
+        cerr << "ERROR: '" << preset << "' did not restore the image loss-lessly." << endl;
+        return EXIT_FAILURE;
+      }
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,139 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestProminentValuesInformation.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the prominent values found by vtkPVProminentValuesInformation for
+// numeric arrays against the ones of vtkAbstractArray, and reports the time
+// taken to find the prominent values of a large array of material ids.
+
+#include "vtkDoubleArray.h"
+#include "vtkIntArray.h"
+#include "vtkNew.h"
+#include "vtkPVProminentValuesInformation.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+#include "vtkVariant.h"
+#include "vtkVariantArray.h"
+
+#include <set>
+#include <vector>
+
+namespace
+{
+typedef std::set<std::vector<vtkVariant> > TupleSet;
+
+TupleSet GetTuples(vtkAbstractArray* values)
+{
+  TupleSet tuples;
+  if (values)
+  {
+    vtkVariantArray* variants = vtkVariantArray::SafeDownCast(values);
+    const int nc = variants->GetNumberOfComponents();
+    for (vtkIdType t = 0; t < variants->GetNumberOfTuples(); ++t)
+    {
+      std::vector<vtkVariant> tuple(nc);
+      for (int c = 0; c < nc; ++c)
+      {
+        tuple[c] = variants->GetValue(t * nc + c);
+      }
+      tuples.insert(tuple);
+    }
+  }
+  return tuples;
+}
+
+bool Check(vtkDataArray* array, bool force, bool expectValid, const char* name)
+{
+  const int nc = array->GetNumberOfComponents();
+  vtkNew<vtkPVProminentValuesInformation> info;
+  info->SetNumberOfComponents(nc);
+  info->SetForce(force);
+
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  info->CopyDistinctValuesFromObject(array);
+  timer->StopTimer();
+  const double infoTime = timer->GetElapsedTime();
+
+  if (info->GetValid() != expectValid)
+  {
+    cerr << "ERROR: " << name << " validity is " << info->GetValid() << endl;
+    return false;
+  }
+
+  const unsigned int maxDiscreteValues = array->GetMaxDiscreteValues();
+  if (force)
+  {
+    array->SetMaxDiscreteValues(VTK_UNSIGNED_INT_MAX);
+  }
+  double arrayTime = 0.;
+  for (int c = (nc > 1 ? -1 : 0); c < nc; ++c)
+  {
+    vtkNew<vtkVariantArray> expected;
+    timer->StartTimer();
+    array->GetProminentComponentValues(c, expected, 0., 0.);
+    timer->StopTimer();
+    arrayTime += timer->GetElapsedTime();
+    vtkSmartPointer<vtkAbstractArray> result;
+    result.TakeReference(info->GetProminentComponentValues(c));
+    if (GetTuples(expected) != GetTuples(result))
+    {
+      cerr << "ERROR: " << name << " prominent values of component " << c << " differ." << endl;
+      return false;
+    }
+  }
+  array->SetMaxDiscreteValues(maxDiscreteValues);
+  cout << name << " (" << array->GetNumberOfTuples() << " tuples): vtkAbstractArray " << arrayTime
+       << "s, vtkPVProminentValuesInformation " << infoTime << "s" << endl;
+  return true;
+}
+}
+
+int TestProminentValuesInformation(int, char* [])
+{
+  // Material ids, taking few values.
+  vtkNew<vtkIntArray> materials;
+  materials->SetNumberOfValues(2000000);
+  for (vtkIdType i = 0; i < materials->GetNumberOfValues(); ++i)
+  {
+    materials->SetValue(i, static_cast<int>((i * 7919) % 50) * 4);
+  }
+
+  // Vectors taking few values, with a negative zero.
+  vtkNew<vtkDoubleArray> vectors;
+  vectors->SetNumberOfComponents(3);
+  vectors->SetNumberOfTuples(100000);
+  for (vtkIdType i = 0; i < vectors->GetNumberOfTuples(); ++i)
+  {
+    const double tuple[3] = { static_cast<double>(i % 3), static_cast<double>(i % 4),
+      i % 5 == 0 ? -0.0 : 0.5 };
+    vectors->SetTuple(i, tuple);
+  }
+
+  // Continuous values.
+  vtkNew<vtkDoubleArray> continuous;
+  continuous->SetNumberOfValues(100000);
+  for (vtkIdType i = 0; i < continuous->GetNumberOfValues(); ++i)
+  {
+    continuous->SetValue(i, 0.001 * i);
+  }
+
+  if (!Check(materials, false, true, "Material ids") ||
+    !Check(vectors, false, true, "Vectors") ||
+    !Check(continuous, false, false, "Continuous values") ||
+    !Check(continuous, true, true, "Forced continuous values"))
+  {
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
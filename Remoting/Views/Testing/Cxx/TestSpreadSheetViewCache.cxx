@@ -0,0 +1,214 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestSpreadSheetViewCache.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the blocks cached by vtkSpreadSheetView on the client: the blocks
+// PrefetchBlock() fetches, and in which order, when scrolling down and up,
+// past prefetched blocks and with the visible rows set, and that the least
+// recently used blocks are evicted once over the cache size limit.
+
+#include "vtkCommand.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkSpreadSheetView.h"
+
+#include <vector>
+
+namespace
+{
+const vtkIdType BlockSize = 100;
+
+// Records the blocks fetched by the view.
+class vtkFetchRecorder : public vtkCommand
+{
+public:
+  static vtkFetchRecorder* New() { return new vtkFetchRecorder; }
+  void Execute(vtkObject*, unsigned long, void* callData) override
+  {
+    this->Blocks.push_back(*reinterpret_cast<vtkIdType*>(callData));
+  }
+  std::vector<vtkIdType> Blocks;
+};
+
+void Access(vtkSpreadSheetView* view, vtkIdType block)
+{
+  view->GetValue(block * BlockSize, 0);
+}
+
+void PrefetchAll(vtkSpreadSheetView* view)
+{
+  for (int cc = 0; cc < 100 && view->PrefetchBlock(); ++cc)
+  {
+  }
+}
+
+bool CheckFetched(vtkFetchRecorder* recorder, const std::vector<vtkIdType>& expected,
+  const char* when)
+{
+  if (recorder->Blocks != expected)
+  {
+    cerr << "ERROR: wrong blocks fetched " << when << ":";
+    for (vtkIdType block : recorder->Blocks)
+    {
+      cerr << " " << block;
+    }
+    cerr << ", expected:";
+    for (vtkIdType block : expected)
+    {
+      cerr << " " << block;
+    }
+    cerr << endl;
+    return false;
+  }
+  recorder->Blocks.clear();
+  return true;
+}
+
+bool CheckCached(vtkSpreadSheetView* view, vtkIdType block, bool expected)
+{
+  if (view->IsAvailable(block * BlockSize) != expected)
+  {
+    cerr << "ERROR: block " << block << (expected ? " is not cached." : " is still cached.")
+         << endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestPrefetch(vtkSpreadSheetView* view, vtkFetchRecorder* recorder)
+{
+  view->SetNumberOfBlocksToPrefetch(2);
+  view->ClearCache();
+  recorder->Blocks.clear();
+
+  Access(view, 10);
+  PrefetchAll(view);
+  if (!CheckFetched(recorder, { 10, 11, 12 }, "when scrolling down"))
+  {
+    return false;
+  }
+
+  // Scrolling to a prefetched block prefetches the following ones.
+  Access(view, 11);
+  PrefetchAll(view);
+  if (!CheckFetched(recorder, { 13 }, "past a prefetched block"))
+  {
+    return false;
+  }
+
+  Access(view, 5);
+  PrefetchAll(view);
+  if (!CheckFetched(recorder, { 5, 4, 3 }, "when scrolling up"))
+  {
+    return false;
+  }
+
+  // With the visible rows set, the order in which their blocks are accessed
+  // does not matter.
+  view->ClearCache();
+  view->SetVisibleRows(20 * BlockSize + 50, 21 * BlockSize + 50);
+  view->SetVisibleRows(21 * BlockSize + 50, 22 * BlockSize + 50);
+  Access(view, 21);
+  Access(view, 22);
+  Access(view, 21);
+  PrefetchAll(view);
+  if (!CheckFetched(recorder, { 21, 22, 23, 24 }, "when the visible rows move down"))
+  {
+    return false;
+  }
+
+  view->SetVisibleRows(20 * BlockSize + 50, 21 * BlockSize + 50);
+  Access(view, 20);
+  Access(view, 21);
+  PrefetchAll(view);
+  view->SetVisibleRows(-1, -1);
+  return CheckFetched(recorder, { 20, 19, 18 }, "when the visible rows move up");
+}
+
+bool TestEviction(vtkSpreadSheetView* view)
+{
+  // No block fits, so only the two most recently used ones are kept.
+  view->ClearCache();
+  view->SetCacheSizeLimit(0);
+  Access(view, 30);
+  Access(view, 31);
+  Access(view, 32);
+  if (!CheckCached(view, 30, false) || !CheckCached(view, 31, true) ||
+    !CheckCached(view, 32, true))
+  {
+    return false;
+  }
+
+  Access(view, 31);
+  Access(view, 33);
+  return CheckCached(view, 32, false) && CheckCached(view, 31, true) &&
+    CheckCached(view, 33, true);
+}
+}
+
+int TestSpreadSheetViewCache(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session.Get());
+  controller->InitializeSession(session.Get());
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> view;
+  view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "SpreadSheetView")));
+  controller->InitializeProxy(view);
+  vtkSMPropertyHelper(view, "BlockSize").Set(BlockSize);
+  view->UpdateVTKObjects();
+  controller->RegisterViewProxy(view);
+
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "RTAnalyticSource")));
+  controller->InitializeProxy(source);
+  source->UpdateVTKObjects();
+  controller->RegisterPipelineProxy(source);
+  controller->Show(source, 0, view);
+  view->StillRender();
+
+  bool success = true;
+  vtkSpreadSheetView* spreadSheet = vtkSpreadSheetView::SafeDownCast(view->GetClientSideObject());
+  if (!spreadSheet || spreadSheet->GetNumberOfRows() != 21 * 21 * 21)
+  {
+    cerr << "ERROR: the data was not shown in the spreadsheet view." << endl;
+    success = false;
+  }
+  else
+  {
+    vtkNew<vtkFetchRecorder> recorder;
+    spreadSheet->AddObserver(vtkCommand::UpdateEvent, recorder);
+    success = TestPrefetch(spreadSheet, recorder) && TestEviction(spreadSheet);
+  }
+
+  controller->UnRegisterProxy(source);
+  source = nullptr;
+  controller->UnRegisterProxy(view);
+  view = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session.Get());
+  vtkInitializationHelper::Finalize();
+  return success ? EXIT_SUCCESS : EXIT_FAILURE;
+}
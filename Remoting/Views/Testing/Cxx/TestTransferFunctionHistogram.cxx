@@ -0,0 +1,152 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestTransferFunctionHistogram.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks that vtkSMTransferFunctionProxy::ComputeDataHistogramTable() does not
+// compute the histogram again on the server when nothing changed, does when a
+// parameter changes, and that the pipeline it keeps does not hold on to the
+// source once the source is deleted.
+
+#include "vtkAlgorithm.h"
+#include "vtkCommand.h"
+#include "vtkDataObject.h"
+#include "vtkExecutive.h"
+#include "vtkInformation.h"
+#include "vtkInformationExecutivePortVectorKey.h"
+#include "vtkInitializationHelper.h"
+#include "vtkNew.h"
+#include "vtkProcessModule.h"
+#include "vtkSMPVRepresentationProxy.h"
+#include "vtkSMParaViewPipelineControllerWithRendering.h"
+#include "vtkSMPropertyHelper.h"
+#include "vtkSMSession.h"
+#include "vtkSMSessionProxyManager.h"
+#include "vtkSMSourceProxy.h"
+#include "vtkSMTransferFunctionProxy.h"
+#include "vtkSMViewProxy.h"
+#include "vtkSmartPointer.h"
+#include "vtkWeakPointer.h"
+
+namespace
+{
+// Returns the first algorithm of the given class downstream of producer.
+vtkAlgorithm* FindDownstream(vtkAlgorithm* producer, const char* className)
+{
+  for (int port = 0; port < producer->GetNumberOfOutputPorts(); ++port)
+  {
+    vtkInformation* outInfo = producer->GetExecutive()->GetOutputInformation(port);
+    vtkExecutive** consumers = vtkExecutive::CONSUMERS()->GetExecutives(outInfo);
+    for (int cc = 0, max = vtkExecutive::CONSUMERS()->Length(outInfo); cc < max; ++cc)
+    {
+      vtkAlgorithm* consumer = consumers[cc] ? consumers[cc]->GetAlgorithm() : nullptr;
+      if (!consumer)
+      {
+        continue;
+      }
+      if (consumer->IsA(className))
+      {
+        return consumer;
+      }
+      if (vtkAlgorithm* found = FindDownstream(consumer, className))
+      {
+        return found;
+      }
+    }
+  }
+  return nullptr;
+}
+
+// Counts the executions of an algorithm.
+class vtkExecutionCounter : public vtkCommand
+{
+public:
+  static vtkExecutionCounter* New() { return new vtkExecutionCounter; }
+  void Execute(vtkObject*, unsigned long, void*) override { ++this->Count; }
+  int Count = 0;
+};
+}
+
+int TestTransferFunctionHistogram(int, char* argv[])
+{
+  vtkInitializationHelper::Initialize(argv[0], vtkProcessModule::PROCESS_CLIENT);
+
+  vtkNew<vtkSMParaViewPipelineControllerWithRendering> controller;
+  vtkNew<vtkSMSession> session;
+  vtkProcessModule::GetProcessModule()->RegisterSession(session.Get());
+  controller->InitializeSession(session.Get());
+  vtkSMSessionProxyManager* pxm = session->GetSessionProxyManager();
+
+  vtkSmartPointer<vtkSMViewProxy> view;
+  view.TakeReference(vtkSMViewProxy::SafeDownCast(pxm->NewProxy("views", "RenderView")));
+  controller->InitializeProxy(view);
+  view->UpdateVTKObjects();
+  controller->RegisterViewProxy(view);
+
+  vtkSmartPointer<vtkSMSourceProxy> source;
+  source.TakeReference(
+    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("sources", "RTAnalyticSource")));
+  controller->InitializeProxy(source);
+  source->UpdateVTKObjects();
+  controller->RegisterPipelineProxy(source);
+  vtkWeakPointer<vtkAlgorithm> sourceAlgorithm =
+    vtkAlgorithm::SafeDownCast(source->GetClientSideObject());
+
+  vtkSMProxy* representation = controller->Show(source, 0, view);
+  vtkSMPVRepresentationProxy::SetScalarColoring(representation, "RTData", vtkDataObject::POINT);
+  vtkSMPVRepresentationProxy::RescaleTransferFunctionToDataRange(representation);
+  vtkSMTransferFunctionProxy* lut = vtkSMTransferFunctionProxy::SafeDownCast(
+    vtkSMPropertyHelper(representation, "LookupTable").GetAsProxy());
+
+  int status = EXIT_SUCCESS;
+  vtkWeakPointer<vtkAlgorithm> histogram;
+  if (lut && lut->ComputeDataHistogramTable(10) && sourceAlgorithm)
+  {
+    histogram = FindDownstream(sourceAlgorithm, "vtkPExtractHistogram");
+  }
+  if (!histogram)
+  {
+    cerr << "ERROR: the histogram pipeline was not found." << endl;
+    status = EXIT_FAILURE;
+  }
+  else
+  {
+    vtkNew<vtkExecutionCounter> counter;
+    histogram->AddObserver(vtkCommand::EndEvent, counter);
+    if (!lut->ComputeDataHistogramTable(10) || counter->Count != 0)
+    {
+      cerr << "ERROR: the histogram was computed again while nothing changed." << endl;
+      status = EXIT_FAILURE;
+    }
+    else if (!lut->ComputeDataHistogramTable(20) || counter->Count != 1)
+    {
+      cerr << "ERROR: the histogram was not computed again with another bin count." << endl;
+      status = EXIT_FAILURE;
+    }
+  }
+
+  // Deleting the source deletes its representation, which is then no longer a
+  // consumer of the transfer function, which must not keep the source alive.
+  controller->UnRegisterProxy(source);
+  source = nullptr;
+  if (status == EXIT_SUCCESS && (sourceAlgorithm || histogram))
+  {
+    cerr << "ERROR: the histogram pipeline outlived the source." << endl;
+    status = EXIT_FAILURE;
+  }
+
+  controller->UnRegisterProxy(view);
+  view = nullptr;
+  vtkProcessModule::GetProcessModule()->UnRegisterSession(session.Get());
+  vtkInitializationHelper::Finalize();
+  return status;
+}
@@ -60,6 +60,7 @@
 #include <vtk_jsoncpp.h>
 #include <vtksys/SystemTools.hxx>
 
+#include <cstdlib>
 #include <memory>
 #include <numeric>
 #include <tuple>
@@ -266,6 +267,7 @@ void vtkGeometryRepresentation::SetupDefaults()
     geomFilter->SetNonlinearSubdivisionLevel(1);
     geomFilter->SetPassThroughCellIds(1);
     geomFilter->SetPassThroughPointIds(1);
+    geomFilter->SetExecuteBlocksInParallel(true);
   }
 
   this->MultiBlockMaker->SetInputConnection(this->GeometryFilter->GetOutputPort());
@@ -387,14 +389,49 @@ int vtkGeometryRepresentation::ProcessViewRequest(
           // implementation.
           const double factor = inInfo->Get(vtkPVRenderView::LOD_RESOLUTION());
           this->Decimator->SetLODFactor(factor);
+          this->LODCacheKey = static_cast<int>(factor * 1000 + 0.5);
         }
 
-        this->Decimator->SetInputDataObject(data);
-        this->Decimator->Update();
+        if (this->LODCacheMTime != data->GetMTime())
+        {
+          this->LODCache.clear();
+          this->LODCacheMTime = data->GetMTime();
+        }
+
+        auto iter = this->LODCache.find(this->LODCacheKey);
+        if (iter == this->LODCache.end())
+        {
+          // Only keep a few levels, dropping the one furthest from the
+          // requested resolution.
+          if (this->LODCache.size() >= 4)
+          {
+            auto furthest = this->LODCache.begin();
+            for (auto it = this->LODCache.begin(); it != this->LODCache.end(); ++it)
+            {
+              if (std::abs(it->first - this->LODCacheKey) >
+                std::abs(furthest->first - this->LODCacheKey))
+              {
+                furthest = it;
+              }
+            }
+            this->LODCache.erase(furthest);
+          }
+
+          this->Decimator->SetInputDataObject(data);
+          this->Decimator->Update();
+
+          // The decimator output is reused on the next execution, hence the
+          // copy.
+          vtkDataObject* output = this->Decimator->GetOutputDataObject(0);
+          vtkSmartPointer<vtkDataObject> lod;
+          lod.TakeReference(output->NewInstance());
+          lod->ShallowCopy(output);
+          iter = this->LODCache.insert(std::make_pair(this->LODCacheKey, lod)).first;
+        }
 
         // Pass along the LOD geometry to the view so that it can deliver it to
         // the rendering node as and when needed.
-        vtkPVView::SetPieceLOD(inInfo, this, this->Decimator->GetOutputDataObject(0));
+        vtkPVView::SetPieceLOD(inInfo, this, iter->second);
       }
     }
   }
@@ -33,6 +33,7 @@
 #include "vtkPVDataRepresentation.h"
 #include "vtkProperty.h"            // needed for VTK_POINTS etc.
 #include "vtkRemotingViewsModule.h" // needed for exports
+#include "vtkSmartPointer.h"        // needed for vtkSmartPointer
 
 class vtkCallbackCommand;
 class vtkCompositeDataDisplayAttributes;
@@ -46,7 +47,7 @@ class vtkTexture;
 
 namespace vtkGeometryRepresentation_detail
 {
-// This is defined to either vtkQuadricClustering or vtkmLevelOfDetail in the
+// This is defined to either vtkPVBinningDecimator or vtkmLevelOfDetail in the
 // implementation file:
 class DecimationFilterType;
 }
@@ -462,6 +463,13 @@ protected:
   std::unordered_map<unsigned int, double> BlockOpacities;
   std::unordered_map<unsigned int, std::array<double, 3> > BlockColors;
 
+  // Decimated geometry for the LOD resolutions used so far, so that changing
+  // the resolution back or interacting again does not decimate again. It is
+  // cleared when the data changes.
+  std::unordered_map<int, vtkSmartPointer<vtkDataObject> > LODCache;
+  vtkMTimeType LODCacheMTime = 0;
+  int LODCacheKey = 500;
+
 private:
   vtkGeometryRepresentation(const vtkGeometryRepresentation&) = delete;
   void operator=(const vtkGeometryRepresentation&) = delete;
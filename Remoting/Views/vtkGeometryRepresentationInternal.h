@@ -18,7 +18,7 @@
 #include "vtkPolyData.h"
 
 // We'll use the VTKm decimation filter if TBB is enabled, otherwise we'll
-// fallback to vtkQuadricClustering, since vtkmLevelOfDetail is slow on the
+// fallback to vtkPVBinningDecimator, since vtkmLevelOfDetail is slow on the
 // serial backend.
 #ifndef __VTK_WRAP__
 #if VTK_MODULE_ENABLE_VTK_vtkm
@@ -27,7 +27,7 @@
 
 #if defined(VTKM_ENABLE_TBB) && VTK_MODULE_ENABLE_VTK_AcceleratorsVTKm
 #include "vtkCellArray.h"
-#include "vtkQuadricClustering.h"
+#include "vtkPVBinningDecimator.h"
 #include "vtkmLevelOfDetail.h"
 namespace vtkGeometryRepresentation_detail
 {
@@ -37,7 +37,7 @@ public:
   static DecimationFilterType* New();
   vtkTypeMacro(DecimationFilterType, vtkmLevelOfDetail)
 
-    // See note on the vtkQuadricClustering implementation below.
+    // See note on the vtkPVBinningDecimator implementation below.
     void SetLODFactor(double factor)
   {
     factor = vtkMath::ClampValue(factor, 0., 1.);
@@ -51,18 +51,13 @@ public:
   }
 
 protected:
-  DecimationFilterType()
-  {
-    this->Fallback->SetUseInputPoints(1);
-    this->Fallback->SetCopyCellData(1);
-    this->Fallback->SetUseInternalTriangles(0);
-  }
+  DecimationFilterType() { this->Fallback->SetCopyCellData(true); }
 
   int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
     vtkInformationVector* outputVector) override
   {
     // The accelerated implementation only supports triangle meshes. Fallback to
-    // vtkQuadricClustering if needed:
+    // vtkPVBinningDecimator if needed:
     vtkInformation* inInfo = inputVector[0]->GetInformationObject(0);
     vtkPolyData* input = vtkPolyData::SafeDownCast(inInfo->Get(vtkDataObject::DATA_OBJECT()));
     if (!input)
@@ -88,10 +83,13 @@ protected:
       }
     }
 
-    // Otherwise fallback to quadric clustering:
+    // Otherwise fallback to vertex clustering:
     vtkInformation* outInfo = outputVector->GetInformationObject(0);
     vtkPolyData* output = vtkPolyData::SafeDownCast(outInfo->Get(vtkDataObject::DATA_OBJECT()));
 
+    int divs[3];
+    this->GetNumberOfDivisions(divs);
+    this->Fallback->SetNumberOfDivisions(divs);
     this->Fallback->SetInputData(input);
     this->Fallback->Update();
     output->ShallowCopy(this->Fallback->GetOutput(0));
@@ -99,24 +97,23 @@ protected:
     return 1;
   }
 
-  vtkNew<vtkQuadricClustering> Fallback;
+  vtkNew<vtkPVBinningDecimator> Fallback;
 };
 vtkStandardNewMacro(DecimationFilterType)
 }
 #else // VTKM_ENABLE_TBB
-#include "vtkQuadricClustering.h"
+#include "vtkPVBinningDecimator.h"
 namespace vtkGeometryRepresentation_detail
 {
-class DecimationFilterType : public vtkQuadricClustering
+class DecimationFilterType : public vtkPVBinningDecimator
 {
 public:
   static DecimationFilterType* New();
-  vtkTypeMacro(DecimationFilterType, vtkQuadricClustering)
+  vtkTypeMacro(DecimationFilterType, vtkPVBinningDecimator)
 
-    // This version gets slower as the grid increases, while the VTKM version
-    // scales with number of points. This means we can get away with a much finer
-    // grid with the VTKM filter, so we'll just reduce the mesh quality a bit
-    // here.
+    // The cost of this filter does not depend on the size of the grid, but
+    // we keep the coarser grid used with vtkQuadricClustering before so that
+    // the LOD geometry remains as light to render and deliver.
     void SetLODFactor(double factor)
   {
     factor = vtkMath::ClampValue(factor, 0., 1.);
@@ -130,12 +127,7 @@ public:
   }
 
 protected:
-  DecimationFilterType()
-  {
-    this->SetUseInputPoints(1);
-    this->SetCopyCellData(1);
-    this->SetUseInternalTriangles(0);
-  }
+  DecimationFilterType() { this->SetCopyCellData(true); }
 };
 vtkStandardNewMacro(DecimationFilterType)
 }
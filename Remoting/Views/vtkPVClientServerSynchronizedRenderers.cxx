@@ -15,11 +15,15 @@
 =========================================================================*/
 #include "vtkPVClientServerSynchronizedRenderers.h"
 
+#include "vtkDeltaLZ4Compressor.h"
 #include "vtkLZ4Compressor.h"
 #include "vtkMultiProcessController.h"
+#include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOpenGLRenderer.h"
 #include "vtkPVConfig.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
 #include "vtkSquirtCompressor.h"
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
@@ -27,8 +31,46 @@
 #include "vtkNvPipeCompressor.h"
 #endif
 
+#include <algorithm>
 #include <assert.h>
+#include <cstring>
 #include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+// Strips smaller than this many rows are not worth the overhead.
+const int MIN_ROWS_PER_STRIP = 32;
+
+// Upper bound on the automatically selected number of strips.
+const int MAX_AUTO_STRIPS = 16;
+
+// Returns a non-owning array referring to the rows of the strip in `image`.
+// It must only be read: compressors may replace the array of their output.
+vtkSmartPointer<vtkUnsignedCharArray> vtkGetStripView(
+  vtkUnsignedCharArray* image, int width, int firstRow, int lastRow)
+{
+  const int numComps = image->GetNumberOfComponents();
+  const vtkIdType offset = static_cast<vtkIdType>(firstRow) * width * numComps;
+  const vtkIdType size = static_cast<vtkIdType>(lastRow - firstRow) * width * numComps;
+  vtkNew<vtkUnsignedCharArray> view;
+  view->SetNumberOfComponents(numComps);
+  view->SetArray(image->GetPointer(0) + offset, size, /*save=*/1);
+  return view.Get();
+}
+
+// Creates a compressor with the same type and configuration as `prototype`.
+vtkSmartPointer<vtkImageCompressor> vtkCloneCompressor(
+  vtkImageCompressor* prototype, const char* configuration, bool lossLess)
+{
+  auto clone = vtkSmartPointer<vtkImageCompressor>::Take(prototype->NewInstance());
+  clone->RestoreConfiguration(configuration);
+  clone->SetLossLessMode(lossLess);
+  return clone;
+}
+}
 
 vtkStandardNewMacro(vtkPVClientServerSynchronizedRenderers);
 vtkCxxSetObjectMacro(vtkPVClientServerSynchronizedRenderers, Compressor, vtkImageCompressor);
@@ -37,6 +79,7 @@ vtkPVClientServerSynchronizedRenderers::vtkPVClientServerSynchronizedRenderers()
   : Compressor(NULL)
   , LossLessCompression(true)
   , NVPipeSupport(false)
+  , NumberOfImageStrips(0)
 {
   this->ConfigureCompressor("vtkLZ4Compressor 0 3");
 }
@@ -56,12 +99,16 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
 
   vtkRawImage& rawImage = this->Image;
 
-  int header[4];
-  this->ParallelController->Receive(header, 4, 1, 0x023430);
+  int header[6];
+  this->ParallelController->Receive(header, 6, 1, 0x023430);
   if (header[0] > 0)
   {
     rawImage.Resize(header[1], header[2], header[3]);
-    if (this->Compressor)
+    if (this->Compressor && header[4] > 1)
+    {
+      this->ReceiveImageInStrips(rawImage.GetRawPtr(), header[1], header[2], header[4]);
+    }
+    else if (this->Compressor)
     {
       vtkUnsignedCharArray* data = vtkUnsignedCharArray::New();
       this->ParallelController->Receive(data, 1, 0x023430);
@@ -74,6 +121,15 @@ void vtkPVClientServerSynchronizedRenderers::MasterEndRender()
       this->ParallelController->Receive(rawImage.GetRawPtr(), 1, 0x023430);
     }
     rawImage.MarkValid();
+
+    if (header[5])
+    {
+      // Ask for a key frame if this frame could not be decompressed, e.g.
+      // because a previous one was lost.
+      vtkDeltaLZ4Compressor* delta = vtkDeltaLZ4Compressor::SafeDownCast(this->Compressor);
+      int keyFrameNeeded = (delta == nullptr || delta->GetKeyFrameNeeded()) ? 1 : 0;
+      this->ParallelController->Send(&keyFrameNeeded, 1, 1, 0x023430);
+    }
   }
 }
 
@@ -85,18 +141,27 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
 
   vtkRawImage& rawImage = this->CaptureRenderedImage();
 
-  int header[4];
+  // header[5] tells the client to reply whether it needs a key frame, for
+  // compressors that encode frames relative to the previous one.
+  vtkDeltaLZ4Compressor* delta = vtkDeltaLZ4Compressor::SafeDownCast(this->Compressor);
+  int header[6];
   header[0] = rawImage.IsValid() ? 1 : 0;
   header[1] = rawImage.GetWidth();
   header[2] = rawImage.GetHeight();
   header[3] = rawImage.IsValid() ? rawImage.GetRawPtr()->GetNumberOfComponents() : 0;
+  header[4] = rawImage.IsValid() ? this->GetNumberOfStripsToSend(header[2]) : 1;
+  header[5] = (rawImage.IsValid() && delta) ? 1 : 0;
 
   // send the image to the client.
-  this->ParallelController->Send(header, 4, 1, 0x023430);
+  this->ParallelController->Send(header, 6, 1, 0x023430);
 
   if (rawImage.IsValid())
   {
-    if (this->Compressor)
+    if (this->Compressor && header[4] > 1)
+    {
+      this->SendImageInStrips(rawImage.GetRawPtr(), header[1], header[2], header[4]);
+    }
+    else if (this->Compressor)
     {
       this->Compressor->SetImageResolution(header[1], header[2]);
       this->ParallelController->Send(this->Compress(rawImage.GetRawPtr()), 1, 0x023430);
@@ -105,9 +170,188 @@ void vtkPVClientServerSynchronizedRenderers::SlaveEndRender()
     {
       this->ParallelController->Send(rawImage.GetRawPtr(), 1, 0x023430);
     }
+
+    if (header[5])
+    {
+      int keyFrameNeeded = 0;
+      this->ParallelController->Receive(&keyFrameNeeded, 1, 1, 0x023430);
+      if (keyFrameNeeded)
+      {
+        delta->ForceKeyFrame();
+      }
+    }
   }
 }
 
+//----------------------------------------------------------------------------
+int vtkPVClientServerSynchronizedRenderers::GetNumberOfStripsToSend(int height)
+{
+  // Compressors that keep state across frames (e.g. NvPipe) need to see
+  // complete frames with a single instance.
+  if (this->Compressor == nullptr || !this->Compressor->IsStateless())
+  {
+    return 1;
+  }
+
+  int numStrips = this->NumberOfImageStrips;
+  if (numStrips <= 0)
+  {
+    numStrips = std::min(static_cast<int>(std::thread::hardware_concurrency()), MAX_AUTO_STRIPS);
+  }
+  numStrips = std::min(numStrips, height / MIN_ROWS_PER_STRIP);
+  return std::max(numStrips, 1);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::SendImageInStrips(
+  vtkUnsignedCharArray* image, int width, int height, int numStrips)
+{
+  const std::string configuration = this->Compressor->SaveConfiguration();
+  const bool lossLess = this->LossLessCompression;
+  vtkImageCompressor* prototype = this->Compressor;
+
+  // Compress all strips concurrently, each with its own compressor.
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray> > strips(numStrips);
+  auto compressStrips = [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      int firstRow, lastRow;
+      vtkPVClientServerSynchronizedRenderers::GetStripRows(
+        height, numStrips, static_cast<int>(cc), firstRow, lastRow);
+      strips[cc] = vtkPVClientServerSynchronizedRenderers::CompressStrip(
+        prototype, configuration.c_str(), lossLess, image, width, firstRow, lastRow);
+    }
+  };
+  vtkSMPTools::For(0, numStrips, 1, compressStrips);
+
+  for (int cc = 0; cc < numStrips; ++cc)
+  {
+    vtkSmartPointer<vtkUnsignedCharArray> data = strips[cc];
+    int compressed = data ? 1 : 0;
+    if (!data)
+    {
+      vtkErrorMacro("Image compression failed!");
+      int firstRow, lastRow;
+      vtkPVClientServerSynchronizedRenderers::GetStripRows(
+        height, numStrips, cc, firstRow, lastRow);
+      data = vtkGetStripView(image, width, firstRow, lastRow);
+    }
+    this->ParallelController->Send(&compressed, 1, 1, 0x023430);
+    this->ParallelController->Send(data, 1, 0x023430);
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::ReceiveImageInStrips(
+  vtkUnsignedCharArray* image, int width, int height, int numStrips)
+{
+  const std::string configuration = this->Compressor->SaveConfiguration();
+  const bool lossLess = this->LossLessCompression;
+  vtkImageCompressor* prototype = this->Compressor;
+
+  // Receive all strips, then decompress them concurrently, each into its rows
+  // of the image. Strips the server failed to compress are copied as-is.
+  std::vector<vtkSmartPointer<vtkUnsignedCharArray> > strips(numStrips);
+  for (int cc = 0; cc < numStrips; ++cc)
+  {
+    int compressed = 0;
+    this->ParallelController->Receive(&compressed, 1, 1, 0x023430);
+    vtkNew<vtkUnsignedCharArray> input;
+    this->ParallelController->Receive(input, 1, 0x023430);
+    if (compressed)
+    {
+      strips[cc] = input.Get();
+      continue;
+    }
+
+    int firstRow, lastRow;
+    vtkPVClientServerSynchronizedRenderers::GetStripRows(height, numStrips, cc, firstRow, lastRow);
+    auto output = vtkGetStripView(image, width, firstRow, lastRow);
+    memcpy(output->GetPointer(0), input->GetPointer(0),
+      std::min(input->GetNumberOfValues(), output->GetNumberOfValues()));
+  }
+
+  std::vector<char> status(numStrips, 1);
+  auto decompressStrips = [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      if (strips[cc])
+      {
+        int firstRow, lastRow;
+        vtkPVClientServerSynchronizedRenderers::GetStripRows(
+          height, numStrips, static_cast<int>(cc), firstRow, lastRow);
+        status[cc] = vtkPVClientServerSynchronizedRenderers::DecompressStrip(prototype,
+          configuration.c_str(), lossLess, strips[cc], image, width, firstRow, lastRow);
+      }
+    }
+  };
+  vtkSMPTools::For(0, numStrips, 1, decompressStrips);
+
+  if (std::find(status.begin(), status.end(), 0) != status.end())
+  {
+    vtkErrorMacro("Image de-compression failed!");
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkPVClientServerSynchronizedRenderers::GetStripRows(
+  int height, int numStrips, int strip, int& first, int& last)
+{
+  // Must give identical results on the server and the client.
+  const int rowsPerStrip = (height + numStrips - 1) / numStrips;
+  first = std::min(height, strip * rowsPerStrip);
+  last = std::min(height, first + rowsPerStrip);
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkUnsignedCharArray> vtkPVClientServerSynchronizedRenderers::CompressStrip(
+  vtkImageCompressor* prototype, const char* configuration, bool lossLess,
+  vtkUnsignedCharArray* image, int width, int firstRow, int lastRow)
+{
+  auto compressor = vtkCloneCompressor(prototype, configuration, lossLess);
+  vtkSmartPointer<vtkUnsignedCharArray> output = vtkSmartPointer<vtkUnsignedCharArray>::New();
+  compressor->SetImageResolution(width, lastRow - firstRow);
+  compressor->SetInput(vtkGetStripView(image, width, firstRow, lastRow));
+  compressor->SetOutput(output);
+  if (compressor->Compress() == 0)
+  {
+    output = nullptr;
+  }
+  // drop the compressor's references before the array leaves the thread.
+  compressor->SetInput(nullptr);
+  compressor->SetOutput(nullptr);
+  return output;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVClientServerSynchronizedRenderers::DecompressStrip(vtkImageCompressor* prototype,
+  const char* configuration, bool lossLess, vtkUnsignedCharArray* input,
+  vtkUnsignedCharArray* image, int width, int firstRow, int lastRow)
+{
+  // Decompress into an array owned by the strip and copy it into the image
+  // afterwards: compressors may replace the array of their output, e.g.
+  // vtkZlibImageCompressor does when it restores the alpha channel.
+  const int numComps = image->GetNumberOfComponents();
+  const vtkIdType offset = static_cast<vtkIdType>(firstRow) * width * numComps;
+  const vtkIdType size = static_cast<vtkIdType>(lastRow - firstRow) * width * numComps;
+  vtkNew<vtkUnsignedCharArray> output;
+  output->SetNumberOfComponents(numComps);
+  output->SetNumberOfTuples(static_cast<vtkIdType>(lastRow - firstRow) * width);
+
+  auto compressor = vtkCloneCompressor(prototype, configuration, lossLess);
+  compressor->SetImageResolution(width, lastRow - firstRow);
+  compressor->SetInput(input);
+  compressor->SetOutput(output);
+  const bool status = compressor->Decompress() != 0 && output->GetNumberOfValues() == size;
+  compressor->SetInput(nullptr);
+  compressor->SetOutput(nullptr);
+  if (status)
+  {
+    memcpy(image->GetPointer(offset), output->GetPointer(0), static_cast<size_t>(size));
+  }
+  return status;
+}
+
 //----------------------------------------------------------------------------
 vtkUnsignedCharArray* vtkPVClientServerSynchronizedRenderers::Compress(vtkUnsignedCharArray* data)
 {
@@ -172,6 +416,10 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
     {
       comp = vtkLZ4Compressor::New();
     }
+    else if (className == "vtkDeltaLZ4Compressor")
+    {
+      comp = vtkDeltaLZ4Compressor::New();
+    }
     else if (className == "vtkNvPipeCompressor" && this->NVPipeSupport)
     {
 #if VTK_MODULE_ENABLE_ParaView_nvpipe
@@ -217,4 +465,5 @@ void vtkPVClientServerSynchronizedRenderers::ConfigureCompressor(const char* str
 void vtkPVClientServerSynchronizedRenderers::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfImageStrips: " << this->NumberOfImageStrips << endl;
 }
@@ -25,6 +25,7 @@
 #define vtkPVClientServerSynchronizedRenderers_h
 
 #include "vtkRemotingViewsModule.h" //needed for exports
+#include "vtkSmartPointer.h"           // for vtkSmartPointer
 #include "vtkSynchronizedRenderers.h"
 
 class vtkImageCompressor;
@@ -52,6 +53,22 @@ public:
   vtkSetMacro(NVPipeSupport, bool);
   vtkGetMacro(NVPipeSupport, bool);
 
+  //@{
+  /**
+   * Number of horizontal strips the image is split into when transferring it
+   * from the server to the client. Strips are compressed concurrently on the
+   * server and sent as soon as each one is ready, while the client decompresses
+   * the strips it has already received, so that compression, transfer and
+   * decompression overlap. When set to 0 (default), the number of strips is
+   * chosen based on the number of available cores. 1 sends the image in one
+   * piece. Compressors that keep state across frames (see
+   * vtkImageCompressor::IsStateless) always use a single strip. This only
+   * affects the server side; the client uses whatever the server sends.
+   */
+  vtkSetClampMacro(NumberOfImageStrips, int, 0, VTK_INT_MAX);
+  vtkGetMacro(NumberOfImageStrips, int);
+  //@}
+
   /**
    * Set and configure a compressor from it's own configuration stream. This
    * is used by ParaView to configure the compressor from application wide
@@ -74,12 +91,47 @@ protected:
   vtkUnsignedCharArray* Compress(vtkUnsignedCharArray*);
   void Decompress(vtkUnsignedCharArray* input, vtkUnsignedCharArray* outputBuffer);
 
+  /**
+   * Returns the number of strips to use to send an image with the given
+   * height.
+   */
+  int GetNumberOfStripsToSend(int height);
+
+  /**
+   * Compresses and sends (or receives and decompresses) the image in
+   * `numStrips` strips, (de)compressed concurrently with vtkSMPTools.
+   */
+  void SendImageInStrips(vtkUnsignedCharArray* image, int width, int height, int numStrips);
+  void ReceiveImageInStrips(vtkUnsignedCharArray* image, int width, int height, int numStrips);
+
+  /**
+   * Rows [first, last) covered by the given strip of an image with the given
+   * height split in `numStrips` strips.
+   */
+  static void GetStripRows(int height, int numStrips, int strip, int& first, int& last);
+
+  //@{
+  /**
+   * Compresses the rows [firstRow, lastRow) of `image`, or decompresses
+   * `input` into these rows, with a new compressor configured like
+   * `prototype`. Each call uses its own compressor, so that strips can be
+   * processed concurrently. CompressStrip() returns nullptr on failure.
+   */
+  static vtkSmartPointer<vtkUnsignedCharArray> CompressStrip(vtkImageCompressor* prototype,
+    const char* configuration, bool lossLess, vtkUnsignedCharArray* image, int width,
+    int firstRow, int lastRow);
+  static bool DecompressStrip(vtkImageCompressor* prototype, const char* configuration,
+    bool lossLess, vtkUnsignedCharArray* input, vtkUnsignedCharArray* image, int width,
+    int firstRow, int lastRow);
+  //@}
+
   void MasterEndRender() override;
   void SlaveEndRender() override;
 
   vtkImageCompressor* Compressor;
   bool LossLessCompression;
   bool NVPipeSupport;
+  int NumberOfImageStrips;
 
 private:
   vtkPVClientServerSynchronizedRenderers(const vtkPVClientServerSynchronizedRenderers&) = delete;
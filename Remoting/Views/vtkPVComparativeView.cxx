@@ -40,6 +40,7 @@
 
 #include <algorithm>
 #include <cassert>
+#include <limits>
 #include <map>
 #include <set>
 #include <sstream>
@@ -653,6 +654,10 @@ public:
   VectorOfCues Cues;
 
   vtkNew<vtkPVComparativeViewNS::vtkCloningVectorOfViews> Views;
+
+  // Time each cell was last updated for. Cells whose time does not change are
+  // not updated again unless the view is outdated.
+  std::vector<double> CellTimes;
 };
 
 //----------------------------------------------------------------------------
@@ -863,12 +868,6 @@ void vtkPVComparativeView::StillRender()
 //----------------------------------------------------------------------------
 void vtkPVComparativeView::Update()
 {
-  if (!this->Outdated)
-  {
-    // cout << "Not Outdated" << endl;
-    return;
-  }
-
   vtkSMComparativeAnimationCueProxy* timeCue = NULL;
   // locate time cue.
   for (vtkInternal::VectorOfCues::iterator iter = this->Internal->Cues.begin();
@@ -883,41 +882,56 @@ void vtkPVComparativeView::Update()
     }
   }
 
+  // Unless the view is outdated, only the cells whose time changed need to be
+  // updated again.
+  std::vector<double>& cellTimes = this->Internal->CellTimes;
+  const size_t numCells = static_cast<size_t>(this->Dimensions[0] * this->Dimensions[1]);
+  if (this->Outdated || cellTimes.size() != numCells)
+  {
+    cellTimes.assign(numCells, std::numeric_limits<double>::quiet_NaN());
+  }
+
   int index = 0;
   for (int y = 0; y < this->Dimensions[1]; y++)
   {
-    for (int x = 0; x < this->Dimensions[0]; x++)
+    for (int x = 0; x < this->Dimensions[0]; x++, index++)
     {
-      int view_index = this->OverlayAllComparisons ? 0 : index;
-      vtkSMViewProxy* view = this->Internal->Views->GetView(view_index);
-      if (timeCue)
-      {
-        double value = timeCue->GetValue(x, y, this->Dimensions[0], this->Dimensions[1]);
-        vtkSMPropertyHelper(view, "ViewTime").Set(value);
-      }
-      else
+      const double time = timeCue
+        ? timeCue->GetValue(x, y, this->Dimensions[0], this->Dimensions[1])
+        : this->ViewTime;
+      if (cellTimes[index] != time)
       {
-        vtkSMPropertyHelper(view, "ViewTime").Set(this->ViewTime);
+        this->UpdateCell(x, y, time, timeCue);
+        cellTimes[index] = time;
       }
-      view->UpdateVTKObjects();
+    }
+  }
 
-      for (vtkInternal::VectorOfCues::iterator iter = this->Internal->Cues.begin();
-           iter != this->Internal->Cues.end(); ++iter)
-      {
-        if (iter->GetPointer() == timeCue)
-        {
-          continue;
-        }
-        iter->GetPointer()->UpdateAnimatedValue(x, y, this->Dimensions[0], this->Dimensions[1]);
-      }
+  this->Outdated = false;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVComparativeView::UpdateCell(
+  int x, int y, double time, vtkSMComparativeAnimationCueProxy* timeCue)
+{
+  const int index = y * this->Dimensions[0] + x;
+  int view_index = this->OverlayAllComparisons ? 0 : index;
+  vtkSMViewProxy* view = this->Internal->Views->GetView(view_index);
+  vtkSMPropertyHelper(view, "ViewTime").Set(time);
+  view->UpdateVTKObjects();
 
-      // Make the view cache the current setup.
-      this->Internal->Views->Update(index);
-      index++;
+  for (vtkInternal::VectorOfCues::iterator iter = this->Internal->Cues.begin();
+       iter != this->Internal->Cues.end(); ++iter)
+  {
+    if (iter->GetPointer() == timeCue)
+    {
+      continue;
     }
+    iter->GetPointer()->UpdateAnimatedValue(x, y, this->Dimensions[0], this->Dimensions[1]);
   }
 
-  this->Outdated = false;
+  // Make the view cache the current setup.
+  this->Internal->Views->Update(index);
 }
 
 //----------------------------------------------------------------------------
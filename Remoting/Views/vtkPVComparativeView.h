@@ -98,7 +98,8 @@ public:
   void RemoveRepresentation(vtkSMProxy*);
 
   /**
-   * Updates the data pipelines for all visible representations.
+   * Updates the data pipelines for all visible representations. Unless the
+   * view is outdated, only the cells whose time changed are updated.
    */
   void Update();
 
@@ -177,18 +178,11 @@ public:
 
   //@{
   /**
-   * Get/Set the view time.
+   * Get/Set the view time. Changing the time does not mark the view outdated,
+   * Update() updates the cells that use it, if any.
    */
+  vtkSetMacro(ViewTime, double);
   vtkGetMacro(ViewTime, double);
-  void SetViewTime(double time)
-  {
-    if (this->ViewTime != time)
-    {
-      this->ViewTime = time;
-      this->Modified();
-      this->MarkOutdated();
-    }
-  }
   //@}
 
   /**
@@ -215,6 +209,13 @@ protected:
    */
   void UpdateViewLayout();
 
+  /**
+   * Updates the cell at (x, y) for the given time: sets the time of its view,
+   * replays the cues other than the time cue and updates the view. Called by
+   * Update() for each cell whose time changed.
+   */
+  virtual void UpdateCell(int x, int y, double time, vtkSMComparativeAnimationCueProxy* timeCue);
+
   int Dimensions[2];
   int ViewSize[2];
   int ViewPosition[2];
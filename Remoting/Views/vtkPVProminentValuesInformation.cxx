@@ -16,11 +16,13 @@
 
 #include "vtkAbstractArray.h"
 #include "vtkAlgorithmOutput.h"
+#include "vtkArrayDispatch.h"
 #include "vtkCellData.h"
 #include "vtkClientServerStream.h"
 #include "vtkCompositeDataIterator.h"
 #include "vtkCompositeDataSet.h"
 #include "vtkDataArray.h"
+#include "vtkDataArrayRange.h"
 #include "vtkDataSet.h"
 #include "vtkDataSetAttributes.h"
 #include "vtkExecutive.h"
@@ -28,17 +30,21 @@
 #include "vtkInformation.h"
 #include "vtkInformationIterator.h"
 #include "vtkInformationKey.h"
+#include "vtkMath.h"
 #include "vtkMultiProcessStream.h"
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkPVDataRepresentation.h"
 #include "vtkPVPostFilter.h"
 #include "vtkPointData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPTools.h"
 #include "vtkStringArray.h"
 #include "vtkTable.h"
 #include "vtkVariant.h"
 #include "vtkVariantArray.h"
 
+#include <functional>
 #include <map>
 #include <set>
 #include <sstream>
@@ -49,6 +55,252 @@
 namespace
 {
 typedef std::map<int, std::set<std::vector<vtkVariant> > > vtkInternalDistinctValuesBase;
+
+// Hash of a value such that all the values comparing equal, including -0 and
+// +0, and all the NaNs, which vtkVariant considers equal, hash the same.
+template <typename T>
+inline size_t HashValue(T value)
+{
+  if (vtkMath::IsNan(static_cast<double>(value)))
+  {
+    return 0x7ff8;
+  }
+  return value == T(0) ? 0 : std::hash<T>()(value);
+}
+
+template <typename T>
+inline bool EqualValues(T a, T b)
+{
+  return a == b ||
+    (vtkMath::IsNan(static_cast<double>(a)) && vtkMath::IsNan(static_cast<double>(b)));
+}
+
+// Set of distinct tuples of numeric values, stored contiguously in insertion
+// order and indexed by an open addressing hash table with linear probing.
+// Once it holds more than MaximumSize tuples, the set is discarded and only
+// remembers that it overflowed.
+template <typename T>
+class vtkDistinctTuples
+{
+public:
+  vtkDistinctTuples(int tupleSize, size_t maximumSize)
+    : TupleSize(tupleSize)
+    , MaximumSize(maximumSize)
+    , Overflow(false)
+    , Slots(64, 0)
+  {
+  }
+
+  // Returns false once the set overflowed.
+  bool Insert(const T* tuple)
+  {
+    if (this->Overflow)
+    {
+      return false;
+    }
+    const size_t mask = this->Slots.size() - 1;
+    size_t slot = this->Hash(tuple) & mask;
+    while (const size_t index = this->Slots[slot])
+    {
+      if (this->Equal(this->GetTuple(index - 1), tuple))
+      {
+        return true;
+      }
+      slot = (slot + 1) & mask;
+    }
+    if (this->GetNumberOfTuples() == this->MaximumSize)
+    {
+      this->Overflow = true;
+      std::vector<T>().swap(this->Values);
+      std::vector<size_t>().swap(this->Slots);
+      return false;
+    }
+    this->Values.insert(this->Values.end(), tuple, tuple + this->TupleSize);
+    this->Slots[slot] = this->GetNumberOfTuples();
+    if (2 * this->GetNumberOfTuples() > this->Slots.size())
+    {
+      this->Grow();
+    }
+    return true;
+  }
+
+  void Merge(const vtkDistinctTuples& other)
+  {
+    if (other.Overflow)
+    {
+      this->Overflow = true;
+      std::vector<T>().swap(this->Values);
+      std::vector<size_t>().swap(this->Slots);
+    }
+    for (size_t t = 0; t < other.GetNumberOfTuples() && this->Insert(other.GetTuple(t)); ++t)
+    {
+    }
+  }
+
+  bool GetOverflow() const { return this->Overflow; }
+  size_t GetNumberOfTuples() const { return this->Values.size() / this->TupleSize; }
+  const T* GetTuple(size_t index) const { return &this->Values[index * this->TupleSize]; }
+
+private:
+  size_t Hash(const T* tuple) const
+  {
+    size_t hash = 0;
+    for (int cc = 0; cc < this->TupleSize; ++cc)
+    {
+      hash ^= HashValue(tuple[cc]) + 0x9e3779b9 + (hash << 6) + (hash >> 2);
+    }
+    // Mix the high bits in the low ones, which index the slots.
+    hash *= static_cast<size_t>(0x9e3779b97f4a7c15ULL);
+    return hash ^ (hash >> 29);
+  }
+
+  bool Equal(const T* tuple1, const T* tuple2) const
+  {
+    for (int cc = 0; cc < this->TupleSize; ++cc)
+    {
+      if (!EqualValues(tuple1[cc], tuple2[cc]))
+      {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  void Grow()
+  {
+    std::vector<size_t> slots(2 * this->Slots.size(), 0);
+    const size_t mask = slots.size() - 1;
+    for (size_t t = 0; t < this->GetNumberOfTuples(); ++t)
+    {
+      size_t slot = this->Hash(this->GetTuple(t)) & mask;
+      while (slots[slot])
+      {
+        slot = (slot + 1) & mask;
+      }
+      slots[slot] = t + 1;
+    }
+    this->Slots.swap(slots);
+  }
+
+  int TupleSize;
+  size_t MaximumSize;
+  bool Overflow;
+  std::vector<T> Values;
+  // One plus the index of the tuple in each slot, 0 for empty slots.
+  std::vector<size_t> Slots;
+};
+
+// Collects the distinct values of each component of an array, and its
+// distinct tuples when it has several components, in a single pass over
+// ranges of tuples processed concurrently. Each thread stops as soon as all
+// its sets overflowed.
+template <typename ArrayT>
+class vtkDistinctValuesFunctor
+{
+public:
+  typedef vtk::GetAPIType<ArrayT> ValueType;
+  typedef std::vector<vtkDistinctTuples<ValueType> > SetsType;
+
+  vtkDistinctValuesFunctor(ArrayT* array, size_t maximumSize)
+    : Array(array)
+    , NumberOfComponents(array->GetNumberOfComponents())
+    , MaximumSize(maximumSize)
+  {
+  }
+
+  void Initialize() { this->Sets.Local() = this->NewSets(); }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    SetsType& sets = this->Sets.Local();
+    const int nc = this->NumberOfComponents;
+    std::vector<ValueType> values(nc);
+    const auto tuples = vtk::DataArrayTupleRange(this->Array, begin, end);
+    for (const auto tuple : tuples)
+    {
+      bool active = false;
+      for (int cc = 0; cc < nc; ++cc)
+      {
+        values[cc] = tuple[cc];
+        active = sets[cc + 1].Insert(&values[cc]) || active;
+      }
+      if (nc > 1)
+      {
+        active = sets[0].Insert(values.data()) || active;
+      }
+      if (!active)
+      {
+        break;
+      }
+    }
+  }
+
+  void Reduce()
+  {
+    this->Result = this->NewSets();
+    for (auto iter = this->Sets.begin(); iter != this->Sets.end(); ++iter)
+    {
+      for (size_t cc = 0; cc < this->Result.size(); ++cc)
+      {
+        this->Result[cc].Merge((*iter)[cc]);
+      }
+    }
+  }
+
+  // Sets of the distinct tuples, followed by the ones of each component.
+  SetsType Result;
+
+private:
+  SetsType NewSets() const
+  {
+    SetsType sets;
+    sets.emplace_back(this->NumberOfComponents, this->MaximumSize);
+    for (int cc = 0; cc < this->NumberOfComponents; ++cc)
+    {
+      sets.emplace_back(1, this->MaximumSize);
+    }
+    return sets;
+  }
+
+  ArrayT* Array;
+  int NumberOfComponents;
+  size_t MaximumSize;
+  vtkSMPThreadLocal<SetsType> Sets;
+};
+
+struct vtkDistinctValuesWorker
+{
+  size_t MaximumSize;
+  vtkInternalDistinctValuesBase* DistinctValues;
+  bool Valid;
+
+  template <typename ArrayT>
+  void operator()(ArrayT* array)
+  {
+    vtkDistinctValuesFunctor<ArrayT> functor(array, this->MaximumSize);
+    vtkSMPTools::For(0, array->GetNumberOfTuples(), functor);
+
+    // Components are reported like vtkAbstractArray::GetProminentComponentValues
+    // does: an overflowed component has no values, and the validity is the one
+    // of the last component.
+    const int nc = array->GetNumberOfComponents();
+    for (int c = (nc > 1 ? -1 : 0); c < nc; ++c)
+    {
+      const auto& set = functor.Result[c + 1];
+      std::set<std::vector<vtkVariant> >& compDistincts((*this->DistinctValues)[c]);
+      std::vector<vtkVariant> tuple(c < 0 ? nc : 1);
+      for (size_t t = 0; t < set.GetNumberOfTuples(); ++t)
+      {
+        for (size_t i = 0; i < tuple.size(); ++i)
+        {
+          tuple[i] = vtkVariant(set.GetTuple(t)[i]);
+        }
+        compDistincts.insert(tuple);
+      }
+      this->Valid = !set.GetOverflow() && set.GetNumberOfTuples() > 0;
+    }
+  }
+};
 }
 
 class vtkPVProminentValuesInformation::vtkInternalDistinctValues
@@ -331,6 +583,23 @@ void vtkPVProminentValuesInformation::CopyDistinctValuesFromObject(vtkAbstractAr
     this->DistinctValues = new vtkInternalDistinctValues;
   }
   int nc = this->GetNumberOfComponents();
+
+  // Numeric arrays are processed with typed hash sets, without going through
+  // vtkVariant for every value.
+  vtkDataArray* dataArray = vtkDataArray::SafeDownCast(array);
+  if (dataArray && dataArray->GetNumberOfComponents() == nc)
+  {
+    vtkDistinctValuesWorker worker;
+    worker.MaximumSize = this->Force ? VTK_UNSIGNED_INT_MAX : array->GetMaxDiscreteValues();
+    worker.DistinctValues = this->DistinctValues;
+    worker.Valid = this->Valid;
+    if (vtkArrayDispatch::Dispatch::Execute(dataArray, worker))
+    {
+      this->Valid = worker.Valid;
+      return;
+    }
+  }
+
   vtkNew<vtkVariantArray> cvalues;
   std::vector<vtkVariant> tuple;
   // bool tooManyValues;
@@ -26,6 +26,7 @@
 #include "vtkSMCoreUtilities.h"
 #include "vtkSMNamedPropertyIterator.h"
 #include "vtkSMPVRepresentationProxy.h"
+#include "vtkSMParaViewPipelineController.h"
 #include "vtkSMPropertyHelper.h"
 #include "vtkSMProxyManager.h"
 #include "vtkSMScalarBarWidgetRepresentationProxy.h"
@@ -481,6 +482,43 @@ bool vtkSMTransferFunctionProxy::ComputeAvailableAnnotations(bool extend)
   return true;
 }
 
+//----------------------------------------------------------------------------
+void vtkSMTransferFunctionProxy::AddConsumer(vtkSMProperty* property, vtkSMProxy* proxy)
+{
+  const unsigned int numberOfConsumers = this->GetNumberOfConsumers();
+  this->Superclass::AddConsumer(property, proxy);
+  if (this->GetNumberOfConsumers() != numberOfConsumers)
+  {
+    this->ResetHistogramPipeline();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTransferFunctionProxy::RemoveConsumer(vtkSMProperty* property, vtkSMProxy* proxy)
+{
+  const unsigned int numberOfConsumers = this->GetNumberOfConsumers();
+  this->Superclass::RemoveConsumer(property, proxy);
+  if (this->GetNumberOfConsumers() != numberOfConsumers)
+  {
+    this->ResetHistogramPipeline();
+  }
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTransferFunctionProxy::RemoveAllConsumers()
+{
+  this->Superclass::RemoveAllConsumers();
+  this->ResetHistogramPipeline();
+}
+
+//----------------------------------------------------------------------------
+void vtkSMTransferFunctionProxy::ResetHistogramPipeline()
+{
+  this->HistogramReducer = nullptr;
+  this->HistogramFilter = nullptr;
+  this->HistogramGroup = nullptr;
+}
+
 //----------------------------------------------------------------------------
 vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins)
 {
@@ -497,17 +535,11 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
     component = vtkSMPropertyHelper(this, "VectorComponent").GetAsInt();
   }
 
-  // Create a GroupDataSet filter
-  vtkSMSessionProxyManager* pxm =
-    vtkSMProxyManager::GetProxyManager()->GetActiveSessionProxyManager();
-  vtkSmartPointer<vtkSMSourceProxy> group;
-  group.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "GroupDataSets")));
-
   // Group all visible consumers using the transfer function proxy
   vtkPVArrayInformation* arrayInfo = nullptr;
   std::string arrayName;
   int arrayAsso = -1;
-  bool hasData = false;
+  std::vector<vtkSMProxy*> inputs;
   std::set<vtkSMProxy*> usedProxy;
   for (unsigned int cc = 0, max = this->GetNumberOfConsumers(); cc < max; ++cc)
   {
@@ -581,51 +613,86 @@ vtkTable* vtkSMTransferFunctionProxy::ComputeDataHistogramTable(int numberOfBins
         }
       }
 
-      // Add consumer to group filter
-      vtkSMSourceProxy* input =
-        vtkSMSourceProxy::SafeDownCast(vtkSMPropertyHelper(consumer, "Input").GetAsProxy());
-      vtkSMPropertyHelper(group, "Input").Add(input);
-      group->UpdateVTKObjects();
-      hasData = true;
+      // Add consumer input to the inputs to group
+      inputs.push_back(vtkSMPropertyHelper(consumer, "Input").GetAsProxy());
       usedProxy.insert(consumer);
     }
   }
 
   // No valid consumer
-  if (!hasData)
+  if (inputs.empty())
   {
+    this->ResetHistogramPipeline();
     this->HistogramTableCache = nullptr;
     return this->HistogramTableCache;
   }
 
+  // Do not keep grouping inputs that are not used anymore.
+  if (this->HistogramGroup)
+  {
+    vtkSMPropertyHelper groupInputs(this->HistogramGroup, "Input");
+    bool sameInputs = groupInputs.GetNumberOfElements() == inputs.size();
+    for (unsigned int cc = 0; sameInputs && cc < inputs.size(); ++cc)
+    {
+      sameInputs = groupInputs.GetAsProxy(cc) == inputs[cc];
+    }
+    if (!sameInputs)
+    {
+      this->ResetHistogramPipeline();
+    }
+  }
+
+  // The proxies grouping the inputs, computing and reducing the histogram are
+  // kept between calls. Setting unchanged values on their properties does not
+  // modify them, so the histogram is only computed again on the server when the
+  // inputs, their data or the histogram parameters change.
+  vtkSMSessionProxyManager* pxm = this->GetSessionProxyManager();
+  if (!this->HistogramReducer)
+  {
+    this->HistogramGroup.TakeReference(pxm->NewProxy("filters", "GroupDataSets"));
+    this->HistogramFilter.TakeReference(pxm->NewProxy("filters", "ExtractHistogram"));
+    vtkSMPropertyHelper(this->HistogramFilter, "Input").Set(this->HistogramGroup);
+    vtkSMPropertyHelper(this->HistogramFilter, "UseCustomBinRanges").Set(true);
+    this->HistogramReducer.TakeReference(pxm->NewProxy("filters", "ReductionFilter"));
+    vtkSMPropertyHelper(this->HistogramReducer, "Input").Set(this->HistogramFilter);
+    vtkSMPropertyHelper(this->HistogramReducer, "PostGatherHelperName").Set("vtkPVMergeTables");
+    this->HistogramReducer->UpdateVTKObjects();
+  }
+
+  // Group all the inputs
+  vtkSMPropertyHelper(this->HistogramGroup, "Input")
+    .Set(&inputs[0], static_cast<unsigned int>(inputs.size()));
+  this->HistogramGroup->UpdateVTKObjects();
+
   // Compute the histogram
-  vtkSmartPointer<vtkSMSourceProxy> histo;
-  histo.TakeReference(vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "ExtractHistogram")));
-  vtkSMPropertyHelper(histo, "Input").Set(group);
-  vtkSMPropertyHelper(histo, "SelectInputArray")
+  vtkSMPropertyHelper(this->HistogramFilter, "SelectInputArray")
     .SetInputArrayToProcess(arrayAsso, arrayName.c_str());
-  vtkSMPropertyHelper(histo, "Component").Set(component);
-  vtkSMPropertyHelper(histo, "BinCount").Set(numberOfBins);
-  vtkSMPropertyHelper(histo, "UseCustomBinRanges").Set(true);
-  vtkSMPropertyHelper(histo, "CustomBinRanges").Set(this->LastRange, 2);
-  histo->UpdateVTKObjects();
-
-  // Reduce it
-  vtkSmartPointer<vtkSMSourceProxy> reducer;
-  reducer.TakeReference(
-    vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "ReductionFilter")));
-  vtkSMPropertyHelper(reducer, "Input").Set(histo);
-  vtkSMPropertyHelper(reducer, "PostGatherHelperName").Set("vtkPVMergeTables");
-  reducer->UpdateVTKObjects();
-
-  // Move it from server to client and save it to the case
+  vtkSMPropertyHelper(this->HistogramFilter, "Component").Set(component);
+  vtkSMPropertyHelper(this->HistogramFilter, "BinCount").Set(numberOfBins);
+  vtkSMPropertyHelper(this->HistogramFilter, "CustomBinRanges").Set(this->LastRange, 2);
+  this->HistogramFilter->UpdateVTKObjects();
+
+  // Move it from server to client and save it to the case. The mover is
+  // created for each call so that it always delivers the histogram, computed or
+  // not.
   vtkSmartPointer<vtkSMSourceProxy> mover;
   mover.TakeReference(
     vtkSMSourceProxy::SafeDownCast(pxm->NewProxy("filters", "ClientServerMoveData")));
-  vtkSMPropertyHelper(mover, "Input").Set(reducer);
+  vtkSMPropertyHelper(mover, "Input").Set(this->HistogramReducer);
   vtkSMPropertyHelper(mover, "OutputDataType").Set(VTK_TABLE);
   mover->UpdateVTKObjects();
-  mover->UpdatePipeline();
+
+  // Update at the time of the animation so that the histogram is computed
+  // again when the time changes.
+  vtkNew<vtkSMParaViewPipelineController> controller;
+  if (vtkSMProxy* timeKeeper = controller->FindTimeKeeper(this->GetSession()))
+  {
+    mover->UpdatePipeline(vtkSMPropertyHelper(timeKeeper, "Time").GetAsDouble());
+  }
+  else
+  {
+    mover->UpdatePipeline();
+  }
   vtkTable* histoTable = vtkTable::SafeDownCast(
     vtkAlgorithm::SafeDownCast(mover->GetClientSideObject())->GetOutputDataObject(0));
   this->HistogramTableCache->ShallowCopy(histoTable);
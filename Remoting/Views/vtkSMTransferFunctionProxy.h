@@ -389,6 +389,22 @@ protected:
    */
   void RestoreFromSiteSettingsOrXML(const char* arrayName);
 
+  //@{
+  /**
+   * Overridden to release the histogram pipeline when the consumers change, as
+   * the inputs it groups may no longer be consumers.
+   */
+  void AddConsumer(vtkSMProperty* property, vtkSMProxy* proxy) override;
+  void RemoveConsumer(vtkSMProperty* property, vtkSMProxy* proxy) override;
+  void RemoveAllConsumers() override;
+  //@}
+
+  /**
+   * Releases the proxies of the histogram pipeline, hence the references they
+   * hold to the inputs of the consumers.
+   */
+  void ResetHistogramPipeline();
+
   /*
    * Stores the last range used to rescale to transfer function
    * Used by ComputeDataHistogram
@@ -400,6 +416,16 @@ protected:
    */
   vtkSmartPointer<vtkTable> HistogramTableCache;
 
+  /*
+   * Proxies grouping the data, computing and reducing the histogram, kept
+   * between calls to ComputeDataHistogramTable so that the server only
+   * computes the histogram again when the data or its parameters change. They
+   * are released when the consumers or the grouped inputs change.
+   */
+  vtkSmartPointer<vtkSMProxy> HistogramGroup;
+  vtkSmartPointer<vtkSMProxy> HistogramFilter;
+  vtkSmartPointer<vtkSMProxy> HistogramReducer;
+
 private:
   vtkSMTransferFunctionProxy(const vtkSMTransferFunctionProxy&) = delete;
   void operator=(const vtkSMTransferFunctionProxy&) = delete;
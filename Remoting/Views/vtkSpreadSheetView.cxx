@@ -48,9 +48,11 @@
 #include <algorithm>
 #include <cstring>
 #include <iterator>
+#include <list>
 #include <map>
 #include <set>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace
@@ -328,19 +330,45 @@ class vtkSpreadSheetView::vtkInternals
   class CacheInfo
   {
   public:
+    vtkIdType BlockId;
     vtkSmartPointer<vtkTable> Dataobject;
-    vtkTimeStamp RecentUseTime;
+    vtkIdType Size; // in kibibytes.
   };
 
-  typedef std::map<vtkIdType, CacheInfo> CacheType;
+  // Cached blocks, most recently used first. CachedBlocksMap indexes the
+  // list so that both lookups and evictions are O(1).
+  typedef std::list<CacheInfo> CacheType;
   CacheType CachedBlocks;
+  std::unordered_map<vtkIdType, CacheType::iterator> CachedBlocksMap;
+  vtkIdType CachedSize = 0;
+
+  void EvictFromCache(vtkIdType limit)
+  {
+    // always keep a couple of blocks, even if they are larger than the
+    // limit, otherwise the visible rows could never be shown.
+    while (this->CachedSize > limit && this->CachedBlocks.size() > 2)
+    {
+      const CacheInfo& lru = this->CachedBlocks.back();
+      this->CachedSize -= lru.Size;
+      this->CachedBlocksMap.erase(lru.BlockId);
+      this->CachedBlocks.pop_back();
+    }
+  }
 
 public:
   void ClearCache()
   {
     this->CachedBlocks.clear();
+    this->CachedBlocksMap.clear();
+    this->CachedSize = 0;
     this->ColumnMetaData.clear();
     this->ColumnIndexMap.clear();
+    this->LastAccessedBlock = -1;
+  }
+
+  bool IsCached(vtkIdType blockId) const
+  {
+    return this->CachedBlocksMap.find(blockId) != this->CachedBlocksMap.end();
   }
 
   vtkIdType GetNumberOfColumns(vtkSpreadSheetView* self)
@@ -385,37 +413,81 @@ public:
 
   vtkTable* GetDataObject(vtkIdType blockId)
   {
-    CacheType::iterator iter = this->CachedBlocks.find(blockId);
-    if (iter != this->CachedBlocks.end())
+    auto iter = this->CachedBlocksMap.find(blockId);
+    if (iter != this->CachedBlocksMap.end())
     {
-      iter->second.RecentUseTime.Modified();
+      // move to the front of the LRU list.
+      this->CachedBlocks.splice(this->CachedBlocks.begin(), this->CachedBlocks, iter->second);
       this->MostRecentlyAccessedBlock = blockId;
-      return iter->second.Dataobject.GetPointer();
+      return iter->second->Dataobject.GetPointer();
     }
     return NULL;
   }
 
-  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, vtkIdType max)
+  /**
+   * Records that the user accessed a block, whether it was cached or not.
+   */
+  void AccessBlock(vtkIdType blockId)
   {
-    CacheType::iterator iter = this->CachedBlocks.find(blockId);
-    if (iter != this->CachedBlocks.end())
+    this->MostRecentlyAccessedBlock = blockId;
+
+    // Showing the visible rows accesses their blocks in any order, so the
+    // direction is then given by the moves of the visible rows instead.
+    if (this->VisibleBlocks[0] < 0 && this->LastAccessedBlock >= 0 &&
+      this->LastAccessedBlock != blockId)
     {
-      this->CachedBlocks.erase(iter);
+      this->ScrollDirection = blockId > this->LastAccessedBlock ? 1 : -1;
     }
+    this->LastAccessedBlock = blockId;
+  }
 
-    if (static_cast<vtkIdType>(this->CachedBlocks.size()) == max)
+  void SetVisibleBlocks(vtkIdType first, vtkIdType last)
+  {
+    if (first < 0 || last < first)
+    {
+      this->VisibleBlocks[0] = this->VisibleBlocks[1] = -1;
+      return;
+    }
+    if (this->VisibleBlocks[0] >= 0)
     {
-      // remove least-recent-used block.
-      iter = this->CachedBlocks.begin();
-      CacheType::iterator iterToRemove = this->CachedBlocks.begin();
-      for (; iter != this->CachedBlocks.end(); ++iter)
+      if (first < this->VisibleBlocks[0] || last < this->VisibleBlocks[1])
       {
-        if (iterToRemove->second.RecentUseTime > iter->second.RecentUseTime)
-        {
-          iterToRemove = iter;
-        }
+        this->ScrollDirection = -1;
+      }
+      else if (first > this->VisibleBlocks[0] || last > this->VisibleBlocks[1])
+      {
+        this->ScrollDirection = 1;
       }
-      this->CachedBlocks.erase(iterToRemove);
+    }
+    this->VisibleBlocks[0] = first;
+    this->VisibleBlocks[1] = last;
+  }
+
+  /**
+   * The block from which to look ahead for blocks to prefetch, in the
+   * scrolling direction, or -1 if there is none.
+   */
+  vtkIdType GetPrefetchOrigin() const
+  {
+    if (this->VisibleBlocks[0] >= 0)
+    {
+      return this->VisibleBlocks[this->ScrollDirection > 0 ? 1 : 0];
+    }
+    return this->LastAccessedBlock;
+  }
+
+  /**
+   * Adds a block to the cache, evicting the least recently used blocks to
+   * keep the cache under `limit` kibibytes.
+   */
+  vtkTable* AddToCache(vtkIdType blockId, vtkTable* data, vtkIdType limit)
+  {
+    auto iter = this->CachedBlocksMap.find(blockId);
+    if (iter != this->CachedBlocksMap.end())
+    {
+      this->CachedSize -= iter->second->Size;
+      this->CachedBlocks.erase(iter->second);
+      this->CachedBlocksMap.erase(iter);
     }
 
     CacheInfo info;
@@ -444,11 +516,15 @@ public:
     {
       clone->AddColumn(column);
     }
+    info.BlockId = blockId;
     info.Dataobject = clone;
+    info.Size = static_cast<vtkIdType>(clone->GetActualMemorySize());
     clone->FastDelete();
-    info.RecentUseTime.Modified();
-    this->CachedBlocks[blockId] = info;
-    this->MostRecentlyAccessedBlock = blockId;
+    this->CachedBlocks.push_front(info);
+    this->CachedBlocksMap[blockId] = this->CachedBlocks.begin();
+    this->CachedSize += info.Size;
+    this->EvictFromCache(limit);
+
     if (this->CachedBlocks.size() == 1)
     {
       this->UpdateColumnMetaData(clone);
@@ -471,15 +547,23 @@ public:
 
     for (const auto& cinfo : this->CachedBlocks)
     {
-      if (cinfo.second.Dataobject != nullptr)
+      if (cinfo.Dataobject != nullptr)
       {
-        return cinfo.second.Dataobject;
+        return cinfo.Dataobject;
       }
     }
     return self->FetchBlock(mrbId);
   }
 
   vtkIdType MostRecentlyAccessedBlock;
+
+  // Last block accessed by the user, blocks of the visible rows if known, and
+  // the direction the user scrolls in, guessed from them. Used to prefetch
+  // blocks.
+  vtkIdType LastAccessedBlock = -1;
+  vtkIdType VisibleBlocks[2] = { -1, -1 };
+  int ScrollDirection = 1;
+
   vtkWeakPointer<vtkSpreadSheetRepresentation> ActiveRepresentation;
   vtkCommand* Observer;
 
@@ -579,6 +663,8 @@ vtkSpreadSheetView::vtkSpreadSheetView()
 
   this->ReductionFilter->SetInputConnection(this->TableStreamer->GetOutputPort());
 
+  this->CacheSizeLimit = 64 * 1024;
+  this->NumberOfBlocksToPrefetch = 2;
   this->Internals = new vtkInternals();
   this->Internals->MostRecentlyAccessedBlock = -1;
 
@@ -721,6 +807,8 @@ bool vtkSpreadSheetView::IsColumnInternal(const char* columnName)
 void vtkSpreadSheetView::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "CacheSizeLimit: " << this->CacheSizeLimit << endl;
+  os << indent << "NumberOfBlocksToPrefetch: " << this->NumberOfBlocksToPrefetch << endl;
 }
 
 //----------------------------------------------------------------------------
@@ -827,12 +915,55 @@ vtkTable* vtkSpreadSheetView::FetchBlock(vtkIdType blockindex)
     block = this->FetchBlockCallback(blockindex);
     // use the block returned from the AddToCache since that is cleaned up
     // to have columns in correct order.
-    block = this->Internals->AddToCache(blockindex, block, 10);
+    block = this->Internals->AddToCache(blockindex, block, this->CacheSizeLimit);
     this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
   }
+  this->Internals->AccessBlock(blockindex);
   return block;
 }
 
+//----------------------------------------------------------------------------
+void vtkSpreadSheetView::SetVisibleRows(vtkIdType first, vtkIdType last)
+{
+  const vtkIdType blockSize = this->TableStreamer->GetBlockSize();
+  if (first < 0 || last < first || blockSize <= 0)
+  {
+    this->Internals->SetVisibleBlocks(-1, -1);
+    return;
+  }
+  this->Internals->SetVisibleBlocks(first / blockSize, last / blockSize);
+}
+
+//----------------------------------------------------------------------------
+bool vtkSpreadSheetView::PrefetchBlock()
+{
+  auto& internals = *this->Internals;
+  const vtkIdType blockSize = this->TableStreamer->GetBlockSize();
+  const vtkIdType origin = internals.GetPrefetchOrigin();
+  if (!internals.ActiveRepresentation || origin < 0 || blockSize <= 0 || this->NumberOfRows <= 0)
+  {
+    return false;
+  }
+
+  const vtkIdType maxBlockId = (this->NumberOfRows - 1) / blockSize;
+  for (int cc = 1; cc <= this->NumberOfBlocksToPrefetch; ++cc)
+  {
+    const vtkIdType blockindex = origin + cc * internals.ScrollDirection;
+    if (blockindex < 0 || blockindex > maxBlockId)
+    {
+      break;
+    }
+    if (!internals.IsCached(blockindex))
+    {
+      vtkTable* block = this->FetchBlockCallback(blockindex);
+      internals.AddToCache(blockindex, block, this->CacheSizeLimit);
+      this->InvokeEvent(vtkCommand::UpdateEvent, &blockindex);
+      return true;
+    }
+  }
+  return false;
+}
+
 //----------------------------------------------------------------------------
 vtkTable* vtkSpreadSheetView::FetchBlockCallback(vtkIdType blockindex)
 {
@@ -223,6 +223,46 @@ public:
   void ClearCache();
   using Superclass::ClearCache;
 
+  //@{
+  /**
+   * Maximum memory, in kibibytes, used to cache blocks fetched on the
+   * client. The least recently used blocks are released first. Default is
+   * 64 MiB.
+   */
+  vtkSetClampMacro(CacheSizeLimit, vtkIdType, 0, VTK_ID_MAX);
+  vtkGetMacro(CacheSizeLimit, vtkIdType);
+  //@}
+
+  //@{
+  /**
+   * Number of blocks following the last block fetched, in the direction the
+   * user is scrolling, that PrefetchBlock() fetches ahead of time. Default
+   * is 2.
+   */
+  vtkSetClampMacro(NumberOfBlocksToPrefetch, int, 0, 16);
+  vtkGetMacro(NumberOfBlocksToPrefetch, int);
+  //@}
+
+  /**
+   * Fetches one of the blocks that are likely to be needed next, i.e. one
+   * of the NumberOfBlocksToPrefetch blocks past the visible rows (see
+   * SetVisibleRows()), or else past the last block accessed, in the
+   * scrolling direction, that is not cached yet. Returns false when there is
+   * nothing left to prefetch. This is meant to be called repeatedly by the
+   * application when idle, so that scrolling does not have to wait for the
+   * data. This method can only be called on the CLIENT process.
+   */
+  bool PrefetchBlock();
+
+  /**
+   * Sets the rows shown by the application, or none if `first` is negative.
+   * The scrolling direction used by PrefetchBlock() is then given by the
+   * moves of these rows rather than by the order in which blocks are
+   * accessed, which is arbitrary when the visible rows span several blocks.
+   * This method can only be called on the CLIENT process.
+   */
+  void SetVisibleRows(vtkIdType first, vtkIdType last);
+
   // INTERNAL METHOD. Don't call directly.
   vtkTable* FetchBlockCallback(vtkIdType blockindex);
 
@@ -249,6 +289,8 @@ protected:
   vtkReductionFilter* ReductionFilter;
   vtkClientServerMoveData* DeliveryFilter;
   vtkIdType NumberOfRows;
+  vtkIdType CacheSizeLimit;
+  int NumberOfBlocksToPrefetch;
 
   unsigned long CRMICallbackTag;
   unsigned long PRMICallbackTag;
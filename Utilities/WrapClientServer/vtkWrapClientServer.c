@@ -542,6 +542,96 @@ void outputFunction(FILE* fp, ClassInfo* data)
 #endif
 }
 
+//--------------------------------------------------------------------------nix
+/*
+ * methodNameHash computes the 32-bit FNV-1a hash of a method name. It must
+ * match vtkClientServerInterpreter::HashMethodName() which is used by the
+ * generated code at run-time.
+ *
+ * @param name the method name
+ *
+ * @return the hash value
+ */
+unsigned long methodNameHash(const char* name)
+{
+  unsigned long hash = 2166136261UL;
+  for (; *name; ++name)
+  {
+    hash ^= (unsigned char)*name;
+    hash = (hash * 16777619UL) & 0xffffffffUL;
+  }
+  return hash;
+}
+
+//--------------------------------------------------------------------------nix
+/*
+ * outputMethodDispatch writes the code for all the wrapped methods of the
+ * class. Instead of testing the method name against every method in turn,
+ * the generated code switches on the hash of the requested method name and
+ * only compares against the methods sharing that hash (overloads, or, very
+ * rarely, different names colliding).
+ *
+ * @param fp the output file
+ * @param data the class being wrapped
+ */
+void outputMethodDispatch(FILE* fp, ClassInfo* data)
+{
+  int i, j;
+  int numberOfMethods = 0;
+  unsigned long* hashes;
+  int* done;
+
+  if (data->NumberOfFunctions == 0)
+  {
+    return;
+  }
+
+  hashes = (unsigned long*)malloc(sizeof(unsigned long) * data->NumberOfFunctions);
+  done = (int*)calloc(data->NumberOfFunctions, sizeof(int));
+  for (i = 0; i < data->NumberOfFunctions; i++)
+  {
+    FunctionInfo* func = data->Functions[i];
+    if (notWrappable(func) || !managableArguments(func) || !strcmp(data->Name, func->Name) ||
+      !strcmp(data->Name, func->Name + 1))
+    {
+      done[i] = 1;
+      continue;
+    }
+    hashes[i] = methodNameHash(func->Name);
+    ++numberOfMethods;
+  }
+
+  if (numberOfMethods > 0)
+  {
+    fprintf(fp, "  switch (vtkClientServerInterpreter::HashMethodName(method))\n"
+                "  {\n");
+    for (i = 0; i < data->NumberOfFunctions; i++)
+    {
+      if (done[i])
+      {
+        continue;
+      }
+      fprintf(fp, "  case 0x%08lxu:\n", hashes[i]);
+      for (j = i; j < data->NumberOfFunctions; j++)
+      {
+        if (!done[j] && hashes[j] == hashes[i])
+        {
+          currentFunction = data->Functions[j];
+          outputFunction(fp, data);
+          done[j] = 1;
+        }
+      }
+      fprintf(fp, "    break;\n");
+    }
+    fprintf(fp, "  default:\n"
+                "    break;\n"
+                "  }\n");
+  }
+
+  free(done);
+  free(hashes);
+}
+
 //--------------------------------------------------------------------------nix
 /*
  * This structure is used internally to sort+collect individual functions.
@@ -1415,11 +1505,7 @@ int main(int argc, char* argv[])
   /*fprintf(fp,"  vtkClientServerStream resultStream;\n");*/
 
   /* insert function handling code here */
-  for (i = 0; i < data->NumberOfFunctions; i++)
-  {
-    currentFunction = data->Functions[i];
-    outputFunction(fp, data);
-  }
+  outputMethodDispatch(fp, data);
 
   /* try superclasses */
   for (i = 0; i < data->NumberOfSuperClasses; i++)
@@ -14,6 +14,8 @@
 #include <vtkFileSequenceParser.h>
 #include <vtkNew.h>
 
+#include <string>
+
 bool check_group(vtkFileSequenceParser* parser, const char* fname, const char* seqname)
 {
   if (!parser->ParseFileSequence(fname))
@@ -57,9 +59,22 @@ int TestFileSequenceParser(int, char* argv[])
   check_group(seqParser.Get(), "prefix-021-suffix.ext", "prefix-..-suffix.ext");
   check_group(seqParser.Get(), "prefix021suffix.ext", "prefix..suffix.ext");
   check_group(seqParser.Get(), "plt0001000", "plt..");
+  check_group(seqParser.Get(), "0010_data.vtk", ".._data.vtk");
+  check_group(seqParser.Get(), "0010data.vtk", "..data.vtk");
+  check_group(seqParser.Get(), "foo_12.vtk", "foo_..vtk");
 
   check_no_group(seqParser.Get(), "foo.3dm");
   check_no_group(seqParser.Get(), "foo.2dm");
 
+  // the thread-safe variant must give the same results.
+  std::string name;
+  int index;
+  if (!vtkFileSequenceParser::ParseFileName("prefix-021-suffix.ext", name, index) ||
+    name != "prefix-..-suffix.ext" || index != 21)
+  {
+    cout << "ERROR: ParseFileName failed for 'prefix-021-suffix.ext'" << endl;
+    return EXIT_FAILURE;
+  }
+
   return EXIT_SUCCESS;
 }
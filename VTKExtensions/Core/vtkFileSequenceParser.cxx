@@ -16,37 +16,112 @@
 
 #include "vtkObjectFactory.h"
 
-#include <set>
+#include <cstdlib>
 #include <string>
-#include <vtksys/RegularExpression.hxx>
 #include <vtksys/SystemTools.hxx>
 
+namespace
+{
+// The file name patterns below used to be matched with regular expressions,
+// which was too slow for directories with many thousands of files. They are
+// now matched by hand, picking the same groups as the (greedy) expressions
+// they replace, which are given in the comments.
+
+inline bool IsNumeric(char c)
+{
+  return (c >= '0' && c <= '9') || c == '.';
+}
+
+inline bool IsDigit(char c)
+{
+  return c >= '0' && c <= '9';
+}
+
+inline bool IsSeparator(char c)
+{
+  return c == '.' || c == '_' || c == '-';
+}
+
+inline bool IsLetter(char c)
+{
+  return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+}
+
+// Returns the end of the run of numeric characters starting at `pos`.
+size_t NumericRunEnd(const std::string& name, size_t pos)
+{
+  while (pos < name.size() && IsNumeric(name[pos]))
+  {
+    ++pos;
+  }
+  return pos;
+}
+
+// Returns the position of the last '.' in [begin, end), if any.
+size_t FindLastDot(const std::string& name, size_t begin, size_t end)
+{
+  for (size_t pos = end; pos > begin; --pos)
+  {
+    if (name[pos - 1] == '.')
+    {
+      return pos - 1;
+    }
+  }
+  return std::string::npos;
+}
+
+// Matches "prefix<sep>number.ext" where <sep> is accepted by `isSeparator`,
+// i.e. "^(.*)(<sep>)([0-9.]+)\.(.*)$".
+bool ParseNumberBeforeExtension(const std::string& name, bool (*isSeparator)(char),
+  std::string& sequenceName, std::string& number)
+{
+  for (size_t pos = name.size(); pos > 0; --pos)
+  {
+    const size_t sep = pos - 1;
+    if (!isSeparator(name[sep]))
+    {
+      continue;
+    }
+    // the number is followed by a '.', which is numeric as well, hence the
+    // last '.' within the numeric run.
+    const size_t dot = FindLastDot(name, sep + 2, NumericRunEnd(name, sep + 1));
+    if (dot != std::string::npos)
+    {
+      sequenceName = name.substr(0, sep + 1) + ".." + name.substr(dot + 1);
+      number = name.substr(sep + 1, dot - sep - 1);
+      return true;
+    }
+  }
+  return false;
+}
+
+// Matches "number<sep>name.ext" where <sep> is accepted by `isSeparator`,
+// i.e. "^([0-9.]+)(<sep>)(.*)\.(.*)$".
+bool ParseNumberAtStart(const std::string& name, bool (*isSeparator)(char),
+  std::string& sequenceName, std::string& number)
+{
+  for (size_t end = NumericRunEnd(name, 0); end > 0; --end)
+  {
+    if (end >= name.size() || !isSeparator(name[end]))
+    {
+      continue;
+    }
+    const size_t dot = FindLastDot(name, end + 1, name.size());
+    if (dot != std::string::npos)
+    {
+      sequenceName = ".." + name.substr(end, dot - end) + "." + name.substr(dot + 1);
+      number = name.substr(0, end);
+      return true;
+    }
+  }
+  return false;
+}
+}
+
 vtkStandardNewMacro(vtkFileSequenceParser);
 //-----------------------------------------------------------------------------
 vtkFileSequenceParser::vtkFileSequenceParser()
-  : // sequence ending with numbers.
-  reg_ex(new vtksys::RegularExpression("^(.*)\\.([0-9.]+)$"))
-  ,
-  // sequence ending with extension.
-  reg_ex2(new vtksys::RegularExpression("^(.*)(\\.|_|-)([0-9.]+)\\.(.*)$"))
-  ,
-  // sequence ending with extension, but with no ". or _" before
-  // the series number.
-  reg_ex3(new vtksys::RegularExpression("^(.*)([a-zA-Z])([0-9.]+)\\.(.*)$"))
-  ,
-  // sequence ending with extension, and starting with series number
-  // followed by ". or _".
-  reg_ex4(new vtksys::RegularExpression("^([0-9.]+)(\\.|_|-)(.*)\\.(.*)$"))
-  ,
-  // sequence ending with extension, and starting with series number,
-  // but not followed by ". or _".
-  reg_ex5(new vtksys::RegularExpression("^([0-9.]+)([a-zA-Z])(.*)\\.(.*)$"))
-
-  ,
-  // fallback: any sequence with a number in the middle (taking the last number
-  // if multiple exist).
-  reg_ex_last(new vtksys::RegularExpression("^(.*[^0-9])([0-9]+)([^0-9]*)$"))
-  , SequenceIndex(-1)
+  : SequenceIndex(-1)
   , SequenceName(NULL)
 {
 }
@@ -54,70 +129,96 @@ vtkFileSequenceParser::vtkFileSequenceParser()
 //-----------------------------------------------------------------------------
 vtkFileSequenceParser::~vtkFileSequenceParser()
 {
-  delete this->reg_ex;
-  delete this->reg_ex2;
-  delete this->reg_ex3;
-  delete this->reg_ex4;
-  delete this->reg_ex5;
-  delete this->reg_ex_last;
-
   this->SetSequenceName(NULL);
 }
 
 //-----------------------------------------------------------------------------
 bool vtkFileSequenceParser::ParseFileSequence(const char* file)
 {
+  std::string sequenceName;
+  int sequenceIndex;
+  if (file && vtkFileSequenceParser::ParseFileName(file, sequenceName, sequenceIndex))
+  {
+    this->SetSequenceName(sequenceName.c_str());
+    this->SequenceIndex = sequenceIndex;
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkFileSequenceParser::ParseFileName(
+  const std::string& file, std::string& sequenceName, int& sequenceIndex)
+{
+  std::string number;
   bool match = false;
-  if (this->reg_ex->find(file))
+
+  // sequence ending with numbers, "^(.*)\.([0-9.]+)$".
+  size_t suffix = file.size();
+  while (suffix > 0 && IsNumeric(file[suffix - 1]))
   {
-    this->SetSequenceName(this->reg_ex->match(1).c_str());
-    this->SequenceIndex = atoi(reg_ex->match(2).c_str());
+    --suffix;
+  }
+  const size_t dot =
+    file.size() < 2 ? std::string::npos : FindLastDot(file, suffix, file.size() - 1);
+  if (dot != std::string::npos)
+  {
+    sequenceName = file.substr(0, dot);
+    number = file.substr(dot + 1);
     match = true;
   }
-  else if (this->reg_ex2->find(file))
+  // sequence ending with extension.
+  else if (ParseNumberBeforeExtension(file, IsSeparator, sequenceName, number))
   {
-    this->SetSequenceName(std::string(this->reg_ex2->match(1) + this->reg_ex2->match(2) + ".." +
-                            this->reg_ex2->match(4))
-                            .c_str());
-    this->SequenceIndex = atoi(reg_ex2->match(3).c_str());
     match = true;
   }
-  else if (this->reg_ex3->find(file))
+  // sequence ending with extension, but with no ". or _" before
+  // the series number.
+  else if (ParseNumberBeforeExtension(file, IsLetter, sequenceName, number))
   {
-    this->SetSequenceName(std::string(this->reg_ex3->match(1) + this->reg_ex3->match(2) + ".." +
-                            this->reg_ex3->match(4))
-                            .c_str());
-    this->SequenceIndex = atoi(reg_ex3->match(3).c_str());
     match = true;
   }
-  else if (this->reg_ex4->find(file))
+  // sequence ending with extension, and starting with series number
+  // followed by ". or _".
+  else if (ParseNumberAtStart(file, IsSeparator, sequenceName, number))
   {
-    this->SetSequenceName(std::string(".." + this->reg_ex4->match(2) + this->reg_ex4->match(3) +
-                            "." + this->reg_ex4->match(4))
-                            .c_str());
-    this->SequenceIndex = atoi(reg_ex4->match(1).c_str());
     match = true;
   }
-  else if (this->reg_ex5->find(file))
+  // sequence ending with extension, and starting with series number,
+  // but not followed by ". or _".
+  else if (ParseNumberAtStart(file, IsLetter, sequenceName, number))
   {
-    this->SetSequenceName(std::string(".." + this->reg_ex5->match(2) + this->reg_ex5->match(3) +
-                            "." + this->reg_ex5->match(4))
-                            .c_str());
-    this->SequenceIndex = atoi(reg_ex5->match(1).c_str());
     match = true;
   }
-  else
+
+  if (!match)
   {
-    std::string fname_wo_ext = vtksys::SystemTools::GetFilenameWithoutExtension(file);
-    std::string ext = vtksys::SystemTools::GetFilenameExtension(file);
-    if (this->reg_ex_last->find(fname_wo_ext))
+    // fallback: any sequence with a number in the middle (taking the last
+    // number if multiple exist), "^(.*[^0-9])([0-9]+)([^0-9]*)$".
+    const std::string fname_wo_ext = vtksys::SystemTools::GetFilenameWithoutExtension(file);
+    const std::string ext = vtksys::SystemTools::GetFilenameExtension(file);
+    size_t end = fname_wo_ext.size();
+    while (end > 0 && !IsDigit(fname_wo_ext[end - 1]))
     {
-      this->SetSequenceName(
-        (this->reg_ex_last->match(1) + ".." + this->reg_ex_last->match(3) + ext).c_str());
-      this->SequenceIndex = atoi(reg_ex_last->match(2).c_str());
+      --end;
+    }
+    size_t begin = end;
+    while (begin > 0 && IsDigit(fname_wo_ext[begin - 1]))
+    {
+      --begin;
+    }
+    if (begin > 0 && begin < end)
+    {
+      sequenceName = fname_wo_ext.substr(0, begin) + ".." + fname_wo_ext.substr(end) + ext;
+      number = fname_wo_ext.substr(begin, end - begin);
       match = true;
     }
   }
+
+  if (match)
+  {
+    sequenceIndex = atoi(number.c_str());
+  }
   return match;
 }
 
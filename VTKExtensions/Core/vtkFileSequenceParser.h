@@ -30,10 +30,7 @@
 #include "vtkObject.h"
 #include "vtkPVVTKExtensionsCoreModule.h" //needed for exports
 
-namespace vtksys
-{
-class RegularExpression;
-}
+#include <string> // for std::string
 
 class VTKPVVTKEXTENSIONSCORE_EXPORT vtkFileSequenceParser : public vtkObject
 {
@@ -49,6 +46,12 @@ public:
    */
   bool ParseFileSequence(const char* file);
 
+  /**
+   * Same as ParseFileSequence() but returns the sequence name and index
+   * instead of storing them, hence can be used by several threads at once.
+   */
+  static bool ParseFileName(const std::string& file, std::string& sequenceName, int& sequenceIndex);
+
   vtkGetStringMacro(SequenceName);
   vtkGetMacro(SequenceIndex, int);
 
@@ -56,13 +59,6 @@ protected:
   vtkFileSequenceParser();
   ~vtkFileSequenceParser() override;
 
-  vtksys::RegularExpression* reg_ex;
-  vtksys::RegularExpression* reg_ex2;
-  vtksys::RegularExpression* reg_ex3;
-  vtksys::RegularExpression* reg_ex4;
-  vtksys::RegularExpression* reg_ex5;
-  vtksys::RegularExpression* reg_ex_last;
-
   // Used internal so char * allocations are done automatically.
   vtkSetStringMacro(SequenceName);
 
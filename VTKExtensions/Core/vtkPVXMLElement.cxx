@@ -21,6 +21,7 @@
 vtkStandardNewMacro(vtkPVXMLElement);
 
 #include <ctype.h>
+#include <cstring>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -52,6 +53,66 @@ static bool vtkIsSpace(const std::string& str)
   return true;
 }
 
+// The binary form starts with a magic string and a version number, written in
+// the native byte order so that data written with another byte order is
+// rejected. Each element then holds its name, id, attributes, character data
+// and nested elements. Strings are prefixed with their length and followed by
+// a terminating null character so that they can be used in place; a null
+// string has the length vtkPVXMLBinaryNullLength.
+static const char vtkPVXMLBinaryMagic[8] = { 'P', 'V', 'X', 'M', 'L', 'B', 'I', 'N' };
+static const vtkTypeUInt32 vtkPVXMLBinaryVersion = 1;
+static const vtkTypeUInt32 vtkPVXMLBinaryNullLength = 0xffffffff;
+
+static void vtkPVXMLWriteBinary(std::string& buffer, vtkTypeUInt32 value)
+{
+  buffer.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static void vtkPVXMLWriteBinary(std::string& buffer, const char* str, size_t length)
+{
+  if (!str)
+  {
+    vtkPVXMLWriteBinary(buffer, vtkPVXMLBinaryNullLength);
+    return;
+  }
+  vtkPVXMLWriteBinary(buffer, static_cast<vtkTypeUInt32>(length));
+  buffer.append(str, length);
+  buffer.push_back('\0');
+}
+
+static bool vtkPVXMLReadBinary(const char*& data, const char* end, vtkTypeUInt32& value)
+{
+  if (static_cast<size_t>(end - data) < sizeof(value))
+  {
+    return false;
+  }
+  memcpy(&value, data, sizeof(value));
+  data += sizeof(value);
+  return true;
+}
+
+static bool vtkPVXMLReadBinary(
+  const char*& data, const char* end, const char*& str, vtkTypeUInt32& length)
+{
+  if (!vtkPVXMLReadBinary(data, end, length))
+  {
+    return false;
+  }
+  if (length == vtkPVXMLBinaryNullLength)
+  {
+    str = NULL;
+    length = 0;
+    return true;
+  }
+  if (static_cast<size_t>(end - data) <= length || data[length] != '\0')
+  {
+    return false;
+  }
+  str = data;
+  data += length + 1;
+  return true;
+}
+
 //----------------------------------------------------------------------------
 vtkPVXMLElement::vtkPVXMLElement()
 {
@@ -786,3 +847,114 @@ void vtkPVXMLElement::RemoveAttribute(const char* name)
 }
 
 //----------------------------------------------------------------------------
+void vtkPVXMLElement::PrintBinary(std::string& buffer)
+{
+  buffer.append(vtkPVXMLBinaryMagic, sizeof(vtkPVXMLBinaryMagic));
+  vtkPVXMLWriteBinary(buffer, vtkPVXMLBinaryVersion);
+  this->PrintBinaryContents(buffer);
+}
+
+//----------------------------------------------------------------------------
+void vtkPVXMLElement::PrintBinaryContents(std::string& buffer)
+{
+  vtkPVXMLWriteBinary(buffer, this->Name, this->Name ? strlen(this->Name) : 0);
+  vtkPVXMLWriteBinary(buffer, this->Id, this->Id ? strlen(this->Id) : 0);
+
+  size_t numAttributes = this->Internal->AttributeNames.size();
+  vtkPVXMLWriteBinary(buffer, static_cast<vtkTypeUInt32>(numAttributes));
+  for (size_t i = 0; i < numAttributes; ++i)
+  {
+    const std::string& name = this->Internal->AttributeNames[i];
+    const std::string& value = this->Internal->AttributeValues[i];
+    vtkPVXMLWriteBinary(buffer, name.c_str(), name.size());
+    vtkPVXMLWriteBinary(buffer, value.c_str(), value.size());
+  }
+
+  const std::string& cdata = this->Internal->CharacterData;
+  vtkPVXMLWriteBinary(buffer, cdata.c_str(), cdata.size());
+
+  vtkPVXMLWriteBinary(buffer, static_cast<vtkTypeUInt32>(this->Internal->NestedElements.size()));
+  for (auto& nested : this->Internal->NestedElements)
+  {
+    nested->PrintBinaryContents(buffer);
+  }
+}
+
+//----------------------------------------------------------------------------
+vtkPVXMLElement* vtkPVXMLElement::ReadBinary(const char* data, size_t length)
+{
+  if (!data || length < sizeof(vtkPVXMLBinaryMagic) ||
+    memcmp(data, vtkPVXMLBinaryMagic, sizeof(vtkPVXMLBinaryMagic)) != 0)
+  {
+    return NULL;
+  }
+  const char* end = data + length;
+  data += sizeof(vtkPVXMLBinaryMagic);
+  vtkTypeUInt32 version;
+  if (!vtkPVXMLReadBinary(data, end, version) || version != vtkPVXMLBinaryVersion)
+  {
+    return NULL;
+  }
+
+  vtkPVXMLElement* element = vtkPVXMLElement::New();
+  if (!element->ReadBinaryContents(data, end) || data != end)
+  {
+    element->Delete();
+    return NULL;
+  }
+  return element;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVXMLElement::ReadBinaryContents(const char*& data, const char* end)
+{
+  const char* str;
+  const char* value;
+  vtkTypeUInt32 length;
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->SetName(str);
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->SetId(str);
+
+  vtkTypeUInt32 count;
+  if (!vtkPVXMLReadBinary(data, end, count))
+  {
+    return false;
+  }
+  for (vtkTypeUInt32 i = 0; i < count; ++i)
+  {
+    if (!vtkPVXMLReadBinary(data, end, str, length) ||
+      !vtkPVXMLReadBinary(data, end, value, length))
+    {
+      return false;
+    }
+    this->AddAttribute(str, value);
+  }
+
+  if (!vtkPVXMLReadBinary(data, end, str, length))
+  {
+    return false;
+  }
+  this->Internal->CharacterData.assign(str ? str : "", length);
+
+  if (!vtkPVXMLReadBinary(data, end, count))
+  {
+    return false;
+  }
+  for (vtkTypeUInt32 i = 0; i < count; ++i)
+  {
+    vtkSmartPointer<vtkPVXMLElement> nested = vtkSmartPointer<vtkPVXMLElement>::New();
+    if (!nested->ReadBinaryContents(data, end))
+    {
+      return false;
+    }
+    this->AddNestedElement(nested);
+  }
+  return true;
+}
@@ -263,6 +263,20 @@ public:
    */
   void CopyAttributesTo(vtkPVXMLElement* other);
 
+  //@{
+  /**
+   * Serialize this element and its nested elements in a compact binary form,
+   * and build an element back from it. Building elements from the binary form
+   * is much faster than parsing XML, which makes it suitable for caches such
+   * as the proxy definitions cache of vtkSIProxyDefinitionManager. The binary
+   * form uses the native byte order, so it is not meant to be exchanged
+   * between machines. PrintBinary() appends to the given buffer. ReadBinary()
+   * returns a new element or nullptr if the data is not valid.
+   */
+  void PrintBinary(std::string& buffer);
+  static vtkPVXMLElement* ReadBinary(const char* data, size_t length);
+  //@}
+
 protected:
   vtkPVXMLElement();
   ~vtkPVXMLElement() override;
@@ -285,6 +299,10 @@ protected:
   vtkPVXMLElement* LookupElementUpScope(const char* id);
   void SetParent(vtkPVXMLElement* parent);
 
+  // Binary serialization of this element, without header.
+  void PrintBinaryContents(std::string& buffer);
+  bool ReadBinaryContents(const char*& data, const char* end);
+
   friend class vtkPVXMLParser;
 
 private:
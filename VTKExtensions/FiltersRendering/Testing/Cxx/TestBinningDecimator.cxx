@@ -0,0 +1,128 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestBinningDecimator.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPVBinningDecimator.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSphereSource.h"
+
+#include <algorithm>
+#include <array>
+#include <set>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+// Checks that the output only has triangles, none of them degenerate or
+// duplicated, and that the cell data of each triangle is the one of an input
+// cell.
+bool CheckTriangles(vtkPolyData* output, vtkIdType numInputCells)
+{
+  vtkCellArray* polys = output->GetPolys();
+  vtkIdTypeArray* cellIds =
+    vtkIdTypeArray::SafeDownCast(output->GetCellData()->GetArray("CellIds"));
+  if (!cellIds || cellIds->GetNumberOfTuples() != output->GetNumberOfCells())
+  {
+    cerr << "ERROR: cell data was not passed." << endl;
+    return false;
+  }
+
+  std::set<std::array<vtkIdType, 3> > triangles;
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType cc = 0; cc < polys->GetNumberOfCells(); ++cc)
+  {
+    polys->GetCellAtId(cc, ids);
+    if (ids->GetNumberOfIds() != 3)
+    {
+      cerr << "ERROR: cell " << cc << " is not a triangle." << endl;
+      return false;
+    }
+    std::array<vtkIdType, 3> key = { { ids->GetId(0), ids->GetId(1), ids->GetId(2) } };
+    std::sort(key.begin(), key.end());
+    if (key[0] == key[1] || key[1] == key[2] || key[2] >= output->GetNumberOfPoints())
+    {
+      cerr << "ERROR: triangle " << cc << " is degenerate or invalid." << endl;
+      return false;
+    }
+    if (!triangles.insert(key).second)
+    {
+      cerr << "ERROR: triangle " << cc << " is duplicated." << endl;
+      return false;
+    }
+    const vtkIdType inputCellId = cellIds->GetValue(cc);
+    if (inputCellId < 0 || inputCellId >= numInputCells)
+    {
+      cerr << "ERROR: unexpected cell data for triangle " << cc << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestBinningDecimator(int, char* [])
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(200);
+  sphere->SetPhiResolution(200);
+  sphere->Update();
+
+  vtkNew<vtkPolyData> input;
+  input->ShallowCopy(sphere->GetOutput());
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfTuples(input->GetNumberOfCells());
+  for (vtkIdType cc = 0; cc < input->GetNumberOfCells(); ++cc)
+  {
+    cellIds->SetValue(cc, cc);
+  }
+  input->GetCellData()->AddArray(cellIds);
+
+  vtkNew<vtkPVBinningDecimator> decimator;
+  decimator->SetInputData(input);
+  decimator->SetNumberOfDivisions(20, 20, 20);
+  decimator->Update();
+
+  vtkPolyData* output = decimator->GetOutput();
+  if (output->GetNumberOfPoints() == 0 ||
+    output->GetNumberOfPoints() >= input->GetNumberOfPoints() / 10)
+  {
+    cerr << "ERROR: unexpected number of points " << output->GetNumberOfPoints() << endl;
+    return TEST_FAILED;
+  }
+  if (output->GetNumberOfPolys() == 0 || output->GetNumberOfPolys() != output->GetNumberOfCells())
+  {
+    cerr << "ERROR: unexpected number of cells " << output->GetNumberOfCells() << endl;
+    return TEST_FAILED;
+  }
+  if (!output->GetPointData()->GetNormals())
+  {
+    cerr << "ERROR: point data was not passed." << endl;
+    return TEST_FAILED;
+  }
+  if (!CheckTriangles(output, input->GetNumberOfCells()))
+  {
+    return TEST_FAILED;
+  }
+
+  return TEST_SUCCESS;
+}
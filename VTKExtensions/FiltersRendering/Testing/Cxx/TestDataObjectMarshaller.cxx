@@ -0,0 +1,177 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestDataObjectMarshaller.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+
+#include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkFloatArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVDataObjectMarshaller.h"
+#include "vtkPointData.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkStringArray.h"
+
+#include <cstring>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+vtkSmartPointer<vtkDataObject> RoundTrip(vtkDataObject* input, bool compress)
+{
+  vtkIdType length = 0;
+  char* buffer = vtkPVDataObjectMarshaller::Marshal(input, length, compress);
+  if (buffer == nullptr || !vtkPVDataObjectMarshaller::IsMarshalledBuffer(buffer, length))
+  {
+    delete[] buffer;
+    return nullptr;
+  }
+  auto result =
+    vtkSmartPointer<vtkDataObject>::Take(vtkPVDataObjectMarshaller::Unmarshal(buffer, length));
+  delete[] buffer;
+  return result;
+}
+
+bool SameArrays(vtkDataArray* a, vtkDataArray* b)
+{
+  if (!a || !b || a->GetDataType() != b->GetDataType() ||
+    a->GetNumberOfComponents() != b->GetNumberOfComponents() ||
+    a->GetNumberOfTuples() != b->GetNumberOfTuples())
+  {
+    return false;
+  }
+  const size_t nbytes = static_cast<size_t>(a->GetNumberOfValues() * a->GetDataTypeSize());
+  return nbytes == 0 || memcmp(a->GetVoidPointer(0), b->GetVoidPointer(0), nbytes) == 0;
+}
+
+bool TestPolyData(bool compress)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetThetaResolution(64);
+  sphere->SetPhiResolution(64);
+  sphere->Update();
+  vtkPolyData* input = sphere->GetOutput();
+
+  vtkNew<vtkStringArray> labels;
+  labels->SetName("labels");
+  labels->InsertNextValue("first");
+  labels->InsertNextValue("");
+  input->GetFieldData()->AddArray(labels);
+
+  vtkSmartPointer<vtkDataObject> result = RoundTrip(input, compress);
+  vtkPolyData* output = vtkPolyData::SafeDownCast(result);
+  if (!output || output->GetNumberOfPoints() != input->GetNumberOfPoints() ||
+    output->GetNumberOfPolys() != input->GetNumberOfPolys() ||
+    !SameArrays(input->GetPoints()->GetData(), output->GetPoints()->GetData()) ||
+    !SameArrays(input->GetPolys()->GetConnectivityArray(),
+      output->GetPolys()->GetConnectivityArray()))
+  {
+    cerr << "ERROR: polydata geometry mismatch (compress=" << compress << ")" << endl;
+    return false;
+  }
+
+  if (!output->GetPointData()->GetNormals() ||
+    !SameArrays(input->GetPointData()->GetNormals(), output->GetPointData()->GetNormals()))
+  {
+    cerr << "ERROR: point normals were not preserved" << endl;
+    return false;
+  }
+
+  vtkStringArray* outLabels =
+    vtkStringArray::SafeDownCast(output->GetFieldData()->GetAbstractArray("labels"));
+  if (!outLabels || outLabels->GetNumberOfValues() != 2 || outLabels->GetValue(0) != "first")
+  {
+    cerr << "ERROR: field data string array was not preserved" << endl;
+    return false;
+  }
+  return true;
+}
+
+bool TestImageInMultiBlock()
+{
+  vtkNew<vtkImageData> image;
+  image->SetExtent(2, 5, 0, 3, 1, 2);
+  image->SetOrigin(1, 2, 3);
+  image->SetSpacing(0.5, 0.25, 2);
+  vtkNew<vtkFloatArray> scalars;
+  scalars->SetName("scalars");
+  scalars->SetNumberOfTuples(image->GetNumberOfCells());
+  for (vtkIdType cc = 0; cc < scalars->GetNumberOfTuples(); ++cc)
+  {
+    scalars->SetValue(cc, static_cast<float>(cc));
+  }
+  image->GetCellData()->SetScalars(scalars);
+
+  vtkNew<vtkMultiBlockDataSet> mb;
+  mb->SetNumberOfBlocks(2);
+  mb->SetBlock(1, image);
+  mb->GetMetaData(1u)->Set(vtkCompositeDataSet::NAME(), "image");
+
+  vtkSmartPointer<vtkDataObject> result = RoundTrip(mb, false);
+  vtkMultiBlockDataSet* output = vtkMultiBlockDataSet::SafeDownCast(result);
+  if (!output || output->GetNumberOfBlocks() != 2 || output->GetBlock(0) != nullptr)
+  {
+    cerr << "ERROR: multiblock structure was not preserved" << endl;
+    return false;
+  }
+  if (strcmp(output->GetMetaData(1u)->Get(vtkCompositeDataSet::NAME()), "image") != 0)
+  {
+    cerr << "ERROR: block name was not preserved" << endl;
+    return false;
+  }
+
+  vtkImageData* outImage = vtkImageData::SafeDownCast(output->GetBlock(1));
+  int extent[6];
+  outImage->GetExtent(extent);
+  if (extent[0] != 2 || extent[5] != 2 || outImage->GetOrigin()[2] != 3 ||
+    outImage->GetSpacing()[1] != 0.25)
+  {
+    cerr << "ERROR: image extent/origin/spacing were not preserved" << endl;
+    return false;
+  }
+  if (outImage->GetCellData()->GetScalars() == nullptr ||
+    !SameArrays(scalars, outImage->GetCellData()->GetScalars()))
+  {
+    cerr << "ERROR: active cell scalars were not preserved" << endl;
+    return false;
+  }
+  return true;
+}
+}
+
+int TestDataObjectMarshaller(int, char* [])
+{
+  if (!TestPolyData(false) || !TestPolyData(true) || !TestImageInMultiBlock())
+  {
+    return TEST_FAILED;
+  }
+
+  // Corrupt buffers must be rejected.
+  const char garbage[] = "pvdo-not-really";
+  vtkDataObject* bad = vtkPVDataObjectMarshaller::Unmarshal(garbage, sizeof(garbage));
+  if (bad != nullptr)
+  {
+    bad->Delete();
+    cerr << "ERROR: invalid buffer was accepted" << endl;
+    return TEST_FAILED;
+  }
+  return TEST_SUCCESS;
+}
@@ -13,6 +13,7 @@
 
 =========================================================================*/
 
+#include "vtkDeltaLZ4Compressor.h"
 #include "vtkImageCompressor.h"
 #include "vtkImageData.h"
 #include "vtkLZ4Compressor.h"
@@ -26,6 +27,7 @@
 #include "vtkUnsignedCharArray.h"
 #include "vtkZlibImageCompressor.h"
 
+#include <cstring>
 #include <map>
 #include <string>
 #include <vtksys/CommandLineArguments.hxx>
@@ -81,6 +83,139 @@ bool DoTest(Data& data, vtkImageCompressor* compressor, vtkUnsignedCharArray* in
   return true;
 }
 
+// Sends a few frames through a pair of vtkDeltaLZ4Compressor instances, as
+// done between the server and the client, and checks the reconstructed images.
+bool DoDeltaTest(vtkImageData* image, vtkUnsignedCharArray* input)
+{
+  const int width = image->GetDimensions()[0];
+  const int height = image->GetDimensions()[1];
+
+  vtkNew<vtkDeltaLZ4Compressor> sender;
+  vtkNew<vtkDeltaLZ4Compressor> receiver;
+  sender->SetQuality(0);
+
+  vtkNew<vtkUnsignedCharArray> frame;
+  frame->DeepCopy(input);
+  vtkNew<vtkUnsignedCharArray> outputCompressed;
+  vtkNew<vtkUnsignedCharArray> outputDeCompressed;
+  outputDeCompressed->SetNumberOfComponents(input->GetNumberOfComponents());
+  outputDeCompressed->SetNumberOfTuples(input->GetNumberOfTuples());
+  const size_t numBytes = static_cast<size_t>(input->GetNumberOfValues());
+
+  vtkIdType keyFrameSize = 0;
+  for (int cc = 0; cc < 3; ++cc)
+  {
+    if (cc > 0)
+    {
+      // touch a single pixel, only one tile must be sent.
+      frame->SetValue(cc, static_cast<unsigned char>(frame->GetValue(cc) + 1));
+    }
+
+    sender->SetImageResolution(width, height);
+    sender->SetInput(frame);
+    sender->SetOutput(outputCompressed);
+    receiver->SetImageResolution(width, height);
+    receiver->SetInput(outputCompressed);
+    receiver->SetOutput(outputDeCompressed);
+    if (!sender->Compress() || !receiver->Decompress())
+    {
+      return false;
+    }
+    if (memcmp(frame->GetPointer(0), outputDeCompressed->GetPointer(0), numBytes) != 0)
+    {
+      cerr << "ERROR: delta frame " << cc << " was not reconstructed correctly." << endl;
+      return false;
+    }
+
+    if (cc == 0)
+    {
+      keyFrameSize = outputCompressed->GetNumberOfTuples();
+    }
+    else if (outputCompressed->GetNumberOfTuples() >= keyFrameSize)
+    {
+      cerr << "ERROR: delta frame " << cc << " is not smaller than the key frame." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Checks that a vtkDeltaLZ4Compressor receiver that missed a frame, or got a
+// corrupt one, rejects delta frames until a key frame is forced on the sender,
+// as done by vtkPVClientServerSynchronizedRenderers.
+bool DoDeltaRecoveryTest(vtkImageData* image, vtkUnsignedCharArray* input)
+{
+  const int width = image->GetDimensions()[0];
+  const int height = image->GetDimensions()[1];
+
+  vtkNew<vtkDeltaLZ4Compressor> sender;
+  vtkNew<vtkDeltaLZ4Compressor> receiver;
+  sender->SetQuality(0);
+
+  vtkNew<vtkUnsignedCharArray> frame;
+  frame->DeepCopy(input);
+  vtkNew<vtkUnsignedCharArray> outputCompressed;
+  vtkNew<vtkUnsignedCharArray> outputDeCompressed;
+  outputDeCompressed->SetNumberOfComponents(input->GetNumberOfComponents());
+  outputDeCompressed->SetNumberOfTuples(input->GetNumberOfTuples());
+  const size_t numBytes = static_cast<size_t>(input->GetNumberOfValues());
+
+  // Touches a pixel of the frame and compresses it.
+  auto send = [&](vtkIdType pixel) {
+    frame->SetValue(pixel, static_cast<unsigned char>(frame->GetValue(pixel) + 1));
+    sender->SetImageResolution(width, height);
+    sender->SetInput(frame);
+    sender->SetOutput(outputCompressed);
+    return sender->Compress() != 0;
+  };
+  auto receive = [&]() {
+    receiver->SetImageResolution(width, height);
+    receiver->SetInput(outputCompressed);
+    receiver->SetOutput(outputDeCompressed);
+    return receiver->Decompress() != 0 &&
+      memcmp(frame->GetPointer(0), outputDeCompressed->GetPointer(0), numBytes) == 0;
+  };
+
+  if (!send(0) || !receive())
+  {
+    cerr << "ERROR: the key frame was not reconstructed correctly." << endl;
+    return false;
+  }
+
+  // Frame 1 is lost.
+  if (!send(1) || !send(2) || receive() || !receiver->GetKeyFrameNeeded() || !send(3) ||
+    receive())
+  {
+    cerr << "ERROR: a delta frame was accepted after a lost frame." << endl;
+    return false;
+  }
+  sender->ForceKeyFrame();
+  if (!send(4) || !receive() || receiver->GetKeyFrameNeeded())
+  {
+    cerr << "ERROR: the receiver did not recover from a lost frame." << endl;
+    return false;
+  }
+
+  // A truncated delta frame.
+  if (!send(5))
+  {
+    return false;
+  }
+  outputCompressed->SetNumberOfTuples(outputCompressed->GetNumberOfTuples() - 1);
+  if (receive() || !receiver->GetKeyFrameNeeded() || !send(6) || receive())
+  {
+    cerr << "ERROR: a delta frame was accepted after a corrupt frame." << endl;
+    return false;
+  }
+  sender->ForceKeyFrame();
+  if (!send(7) || !receive() || receiver->GetKeyFrameNeeded())
+  {
+    cerr << "ERROR: the receiver did not recover from a corrupt frame." << endl;
+    return false;
+  }
+  return true;
+}
+
 int TestImageCompressors(int argc, char* argv[])
 {
   int max_count = 10;
@@ -195,6 +330,20 @@ int TestImageCompressors(int argc, char* argv[])
     }
   }
 
+  if (!DoDeltaTest(image, input))
+  {
+    return TEST_FAILED;
+  }
+
+  // The rejected frames report errors.
+  vtkObject::GlobalWarningDisplayOff();
+  const bool recovered = DoDeltaRecoveryTest(image, input);
+  vtkObject::GlobalWarningDisplayOn();
+  if (!recovered)
+  {
+    return TEST_FAILED;
+  }
+
   cout << "Input: " << image->GetDimensions()[0] << "x" << image->GetDimensions()[1] << "x"
        << image->GetDimensions()[2] << " (uncompressed size: " << uncompressedSize << ") " << endl;
 
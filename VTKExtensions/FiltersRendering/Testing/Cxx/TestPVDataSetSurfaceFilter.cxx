@@ -0,0 +1,279 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVDataSetSurfaceFilter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks the threaded surface extraction of vtkPVDataSetSurfaceFilter against
+// vtkDataSetSurfaceFilter, comparing the points, the cells with their
+// orientation and the attributes, and reports the timings of both on a
+// hexahedral and a tetrahedral grid.
+
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkDoubleArray.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkPVDataSetSurfaceFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+// Builds a grid of dim^3 hexahedra, or of 6 tetrahedra per hexahedron, with a
+// triangle and a line appended to check that lower dimensional cells are
+// passed.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(int dim, bool tetrahedra)
+{
+  const int np = dim + 1;
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  for (int k = 0; k < np; ++k)
+  {
+    for (int j = 0; j < np; ++j)
+    {
+      for (int i = 0; i < np; ++i)
+      {
+        points->InsertNextPoint(i, j, k);
+        scalars->InsertNextValue(i + j + k);
+      }
+    }
+  }
+  grid->SetPoints(points);
+  grid->GetPointData()->AddArray(scalars);
+  grid->Allocate(tetrahedra ? 6 * dim * dim * dim : dim * dim * dim);
+
+  // Corners of the hexahedron, by (x, y, z) bits, in vtkHexahedron order.
+  const int hexCorners[8] = { 0, 1, 3, 2, 4, 5, 7, 6 };
+  // Tetrahedra along the paths from corner 0 to corner 7, which make a
+  // conforming decomposition when all hexahedra are split the same way.
+  const int tets[6][4] = { { 0, 1, 3, 7 }, { 0, 1, 5, 7 }, { 0, 2, 3, 7 }, { 0, 2, 6, 7 },
+    { 0, 4, 5, 7 }, { 0, 4, 6, 7 } };
+  for (int k = 0; k < dim; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        vtkIdType corners[8];
+        for (int bits = 0; bits < 8; ++bits)
+        {
+          const int x = i + (bits & 1);
+          const int y = j + ((bits >> 1) & 1);
+          const int z = k + (bits >> 2);
+          corners[bits] = x + np * (y + np * z);
+        }
+        if (tetrahedra)
+        {
+          for (int t = 0; t < 6; ++t)
+          {
+            const vtkIdType ids[4] = { corners[tets[t][0]], corners[tets[t][1]],
+              corners[tets[t][2]], corners[tets[t][3]] };
+            grid->InsertNextCell(VTK_TETRA, 4, ids);
+          }
+        }
+        else
+        {
+          vtkIdType ids[8];
+          for (int c = 0; c < 8; ++c)
+          {
+            ids[c] = corners[hexCorners[c]];
+          }
+          grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+        }
+      }
+    }
+  }
+
+  const vtkIdType triangle[3] = { 0, 1, np };
+  grid->InsertNextCell(VTK_TRIANGLE, 3, triangle);
+  const vtkIdType line[2] = { 0, np * np };
+  grid->InsertNextCell(VTK_LINE, 2, line);
+
+  vtkNew<vtkIdTypeArray> cellIds;
+  cellIds->SetName("CellIds");
+  cellIds->SetNumberOfValues(grid->GetNumberOfCells());
+  for (vtkIdType cc = 0; cc < grid->GetNumberOfCells(); ++cc)
+  {
+    cellIds->SetValue(cc, cc);
+  }
+  grid->GetCellData()->AddArray(cellIds);
+  return grid;
+}
+
+std::vector<vtkIdType> GetSortedIds(vtkDataArray* array)
+{
+  std::vector<vtkIdType> ids;
+  if (array)
+  {
+    for (vtkIdType cc = 0; cc < array->GetNumberOfTuples(); ++cc)
+    {
+      ids.push_back(static_cast<vtkIdType>(array->GetTuple1(cc)));
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+  return ids;
+}
+
+// Describes each cell by its type, its original cell id and the coordinates of
+// its points. The points are rotated to start from the smallest one, so that
+// their order, and thus the orientation of the cell, is compared but not the
+// starting point. The cells are sorted as both filters order them differently.
+std::vector<std::vector<double> > GetCells(vtkPolyData* pd)
+{
+  std::vector<std::vector<double> > cells;
+  vtkDataArray* originalCellIds = pd->GetCellData()->GetArray("vtkOriginalCellIds");
+  vtkNew<vtkIdList> ids;
+  for (vtkIdType cc = 0; cc < pd->GetNumberOfCells(); ++cc)
+  {
+    pd->GetCellPoints(cc, ids);
+    std::vector<std::array<double, 3> > points(ids->GetNumberOfIds());
+    for (vtkIdType i = 0; i < ids->GetNumberOfIds(); ++i)
+    {
+      pd->GetPoint(ids->GetId(i), points[i].data());
+    }
+    std::rotate(points.begin(), std::min_element(points.begin(), points.end()), points.end());
+
+    std::vector<double> cell;
+    cell.push_back(pd->GetCellType(cc));
+    cell.push_back(originalCellIds ? originalCellIds->GetTuple1(cc) : -1);
+    for (const auto& point : points)
+    {
+      cell.insert(cell.end(), point.begin(), point.end());
+    }
+    cells.push_back(cell);
+  }
+  std::sort(cells.begin(), cells.end());
+  return cells;
+}
+
+// Describes each point by its coordinates, its original point id and its
+// scalar, sorted.
+std::vector<std::array<double, 5> > GetPoints(vtkPolyData* pd)
+{
+  std::vector<std::array<double, 5> > points(pd->GetNumberOfPoints());
+  vtkDataArray* originalPointIds = pd->GetPointData()->GetArray("vtkOriginalPointIds");
+  vtkDataArray* scalars = pd->GetPointData()->GetArray("Scalars");
+  for (vtkIdType cc = 0; cc < pd->GetNumberOfPoints(); ++cc)
+  {
+    pd->GetPoint(cc, points[cc].data());
+    points[cc][3] = originalPointIds ? originalPointIds->GetTuple1(cc) : -1;
+    points[cc][4] = scalars ? scalars->GetTuple1(cc) : 0;
+  }
+  std::sort(points.begin(), points.end());
+  return points;
+}
+
+bool Compare(vtkUnstructuredGrid* grid, const char* name)
+{
+  if (!vtkPVDataSetSurfaceFilter::IsThreadedExecutionSupported(grid))
+  {
+    cerr << "ERROR: " << name << " grid is not supported." << endl;
+    return false;
+  }
+
+  vtkNew<vtkTimerLog> timer;
+  vtkNew<vtkDataSetSurfaceFilter> serial;
+  serial->PassThroughCellIdsOn();
+  serial->PassThroughPointIdsOn();
+  vtkNew<vtkPolyData> expected;
+  timer->StartTimer();
+  serial->UnstructuredGridExecute(grid, expected);
+  timer->StopTimer();
+  const double serialTime = timer->GetElapsedTime();
+
+  vtkNew<vtkPVDataSetSurfaceFilter> threaded;
+  threaded->PassThroughCellIdsOn();
+  threaded->PassThroughPointIdsOn();
+  vtkNew<vtkPolyData> result;
+  timer->StartTimer();
+  threaded->UnstructuredGridExecute(grid, result);
+  timer->StopTimer();
+  const double threadedTime = timer->GetElapsedTime();
+
+  cout << name << " grid (" << grid->GetNumberOfCells() << " cells): vtkDataSetSurfaceFilter "
+       << serialTime << "s, vtkPVDataSetSurfaceFilter " << threadedTime << "s" << endl;
+
+  if (result->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    result->GetNumberOfVerts() != expected->GetNumberOfVerts() ||
+    result->GetNumberOfLines() != expected->GetNumberOfLines() ||
+    result->GetNumberOfPolys() != expected->GetNumberOfPolys())
+  {
+    cerr << "ERROR: " << name << " surfaces differ: " << result->GetNumberOfPoints() << " points, "
+         << result->GetNumberOfCells() << " cells instead of " << expected->GetNumberOfPoints()
+         << " points, " << expected->GetNumberOfCells() << " cells." << endl;
+    return false;
+  }
+
+  vtkDataArray* originalCellIds = result->GetCellData()->GetArray("vtkOriginalCellIds");
+  if (GetSortedIds(originalCellIds) !=
+      GetSortedIds(expected->GetCellData()->GetArray("vtkOriginalCellIds")) ||
+    GetSortedIds(result->GetPointData()->GetArray("vtkOriginalPointIds")) !=
+      GetSortedIds(expected->GetPointData()->GetArray("vtkOriginalPointIds")))
+  {
+    cerr << "ERROR: " << name << " original ids differ." << endl;
+    return false;
+  }
+
+  if (GetPoints(result) != GetPoints(expected))
+  {
+    cerr << "ERROR: " << name << " points differ." << endl;
+    return false;
+  }
+  if (GetCells(result) != GetCells(expected))
+  {
+    cerr << "ERROR: " << name << " cells differ in type, orientation or points." << endl;
+    return false;
+  }
+
+  // Cell data must come from the original cells.
+  vtkDataArray* cellIds = result->GetCellData()->GetArray("CellIds");
+  if (!cellIds || !result->GetPointData()->GetArray("Scalars"))
+  {
+    cerr << "ERROR: " << name << " attributes were not passed." << endl;
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < result->GetNumberOfCells(); ++cc)
+  {
+    if (cellIds->GetTuple1(cc) != originalCellIds->GetTuple1(cc))
+    {
+      cerr << "ERROR: " << name << " cell data of cell " << cc << " is wrong." << endl;
+      return false;
+    }
+  }
+  return true;
+}
+}
+
+int TestPVDataSetSurfaceFilter(int, char* [])
+{
+  const int dim = 40;
+  if (!Compare(MakeGrid(dim, false), "Hexahedral") || !Compare(MakeGrid(dim, true), "Tetrahedral"))
+  {
+    return TEST_FAILED;
+  }
+  return TEST_SUCCESS;
+}
@@ -0,0 +1,257 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPVGeometryFilterParallelBlocks.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Checks that vtkPVGeometryFilter gives the same output when the leaves of a
+// composite dataset are processed concurrently and serially, including the
+// composite index and block color arrays.
+
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkCubeSource.h"
+#include "vtkDataObjectTreeIterator.h"
+#include "vtkDoubleArray.h"
+#include "vtkFieldData.h"
+#include "vtkIdList.h"
+#include "vtkImageData.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiPieceDataSet.h"
+#include "vtkNew.h"
+#include "vtkPVGeometryFilter.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSmartPointer.h"
+#include "vtkSphereSource.h"
+#include "vtkUnstructuredGrid.h"
+#include "vtkVariant.h"
+
+#define TEST_SUCCESS 0
+#define TEST_FAILED 1
+
+namespace
+{
+vtkSmartPointer<vtkPolyData> MakeSphere(double x)
+{
+  vtkNew<vtkSphereSource> sphere;
+  sphere->SetCenter(x, 0, 0);
+  sphere->Update();
+  return sphere->GetOutput();
+}
+
+vtkSmartPointer<vtkImageData> MakeImage()
+{
+  auto image = vtkSmartPointer<vtkImageData>::New();
+  image->SetDimensions(5, 6, 7);
+  vtkNew<vtkDoubleArray> scalars;
+  scalars->SetName("Scalars");
+  scalars->SetNumberOfTuples(image->GetNumberOfPoints());
+  for (vtkIdType cc = 0; cc < image->GetNumberOfPoints(); ++cc)
+  {
+    scalars->SetValue(cc, static_cast<double>(cc % 11));
+  }
+  image->GetPointData()->SetScalars(scalars);
+  return image;
+}
+
+// A row of hexahedra sharing faces.
+vtkSmartPointer<vtkUnstructuredGrid> MakeGrid(int numberOfHexahedra)
+{
+  auto grid = vtkSmartPointer<vtkUnstructuredGrid>::New();
+  vtkNew<vtkPoints> points;
+  for (int i = 0; i <= numberOfHexahedra; ++i)
+  {
+    points->InsertNextPoint(i, 0, 0);
+    points->InsertNextPoint(i, 1, 0);
+    points->InsertNextPoint(i, 1, 1);
+    points->InsertNextPoint(i, 0, 1);
+  }
+  grid->SetPoints(points);
+  grid->Allocate(numberOfHexahedra);
+  for (int i = 0; i < numberOfHexahedra; ++i)
+  {
+    const vtkIdType p = 4 * i;
+    vtkIdType ids[8] = { p, p + 4, p + 5, p + 1, p + 3, p + 7, p + 6, p + 2 };
+    grid->InsertNextCell(VTK_HEXAHEDRON, 8, ids);
+  }
+  return grid;
+}
+
+// Leaves of several types, including a null leaf, nested blocks and a
+// multipiece which gets merged.
+vtkSmartPointer<vtkMultiBlockDataSet> MakeInput()
+{
+  vtkNew<vtkCubeSource> cube;
+  cube->Update();
+
+  vtkNew<vtkMultiPieceDataSet> pieces;
+  pieces->SetNumberOfPieces(3);
+  pieces->SetPiece(0, MakeSphere(5));
+  pieces->SetPiece(2, MakeSphere(7));
+
+  vtkNew<vtkMultiBlockDataSet> nested;
+  nested->SetNumberOfBlocks(3);
+  nested->SetBlock(0, MakeGrid(4));
+  nested->SetBlock(1, pieces);
+  nested->SetBlock(2, cube->GetOutput());
+
+  auto input = vtkSmartPointer<vtkMultiBlockDataSet>::New();
+  input->SetNumberOfBlocks(5);
+  input->SetBlock(0, MakeSphere(0));
+  input->SetBlock(1, MakeImage());
+  input->SetBlock(2, nullptr);
+  input->SetBlock(3, nested);
+  input->SetBlock(4, MakeGrid(2));
+  return input;
+}
+
+vtkSmartPointer<vtkMultiBlockDataSet> Execute(vtkMultiBlockDataSet* input, bool parallel)
+{
+  vtkNew<vtkPVGeometryFilter> filter;
+  filter->SetInputData(input);
+  filter->SetUseOutline(0);
+  filter->SetGenerateCellNormals(1);
+  filter->SetTriangulate(0);
+  filter->SetNonlinearSubdivisionLevel(1);
+  filter->SetPassThroughCellIds(1);
+  filter->SetPassThroughPointIds(1);
+  filter->SetExecuteBlocksInParallel(parallel);
+  filter->Update();
+  return vtkMultiBlockDataSet::SafeDownCast(filter->GetOutputDataObject(0));
+}
+
+bool SameArrays(vtkFieldData* fd1, vtkFieldData* fd2)
+{
+  if (fd1->GetNumberOfArrays() != fd2->GetNumberOfArrays())
+  {
+    return false;
+  }
+  for (int cc = 0; cc < fd1->GetNumberOfArrays(); ++cc)
+  {
+    vtkAbstractArray* a1 = fd1->GetAbstractArray(cc);
+    vtkAbstractArray* a2 = fd2->GetAbstractArray(a1->GetName());
+    if (!a2 || a1->GetDataType() != a2->GetDataType() ||
+      a1->GetNumberOfComponents() != a2->GetNumberOfComponents() ||
+      a1->GetNumberOfValues() != a2->GetNumberOfValues())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < a1->GetNumberOfValues(); ++i)
+    {
+      if (a1->GetVariantValue(i) != a2->GetVariantValue(i))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+
+bool SamePolyData(vtkPolyData* pd1, vtkPolyData* pd2)
+{
+  if (pd1->GetNumberOfPoints() != pd2->GetNumberOfPoints() ||
+    pd1->GetNumberOfCells() != pd2->GetNumberOfCells())
+  {
+    return false;
+  }
+  for (vtkIdType cc = 0; cc < pd1->GetNumberOfPoints(); ++cc)
+  {
+    double p1[3], p2[3];
+    pd1->GetPoint(cc, p1);
+    pd2->GetPoint(cc, p2);
+    if (p1[0] != p2[0] || p1[1] != p2[1] || p1[2] != p2[2])
+    {
+      return false;
+    }
+  }
+  vtkNew<vtkIdList> ids1;
+  vtkNew<vtkIdList> ids2;
+  for (vtkIdType cc = 0; cc < pd1->GetNumberOfCells(); ++cc)
+  {
+    pd1->GetCellPoints(cc, ids1);
+    pd2->GetCellPoints(cc, ids2);
+    if (pd1->GetCellType(cc) != pd2->GetCellType(cc) ||
+      ids1->GetNumberOfIds() != ids2->GetNumberOfIds())
+    {
+      return false;
+    }
+    for (vtkIdType i = 0; i < ids1->GetNumberOfIds(); ++i)
+    {
+      if (ids1->GetId(i) != ids2->GetId(i))
+      {
+        return false;
+      }
+    }
+  }
+  return SameArrays(pd1->GetPointData(), pd2->GetPointData()) &&
+    SameArrays(pd1->GetCellData(), pd2->GetCellData()) &&
+    SameArrays(pd1->GetFieldData(), pd2->GetFieldData());
+}
+}
+
+int TestPVGeometryFilterParallelBlocks(int, char* [])
+{
+  vtkSmartPointer<vtkMultiBlockDataSet> input = MakeInput();
+  vtkSmartPointer<vtkMultiBlockDataSet> expected = Execute(input, false);
+  vtkSmartPointer<vtkMultiBlockDataSet> result = Execute(input, true);
+  if (!expected || !result)
+  {
+    cerr << "ERROR: missing output." << endl;
+    return TEST_FAILED;
+  }
+
+  vtkSmartPointer<vtkDataObjectTreeIterator> expectedIter;
+  expectedIter.TakeReference(expected->NewTreeIterator());
+  expectedIter->SkipEmptyNodesOff();
+  vtkSmartPointer<vtkDataObjectTreeIterator> resultIter;
+  resultIter.TakeReference(result->NewTreeIterator());
+  resultIter->SkipEmptyNodesOff();
+
+  int numberOfLeaves = 0;
+  for (expectedIter->InitTraversal(), resultIter->InitTraversal();
+       !expectedIter->IsDoneWithTraversal();
+       expectedIter->GoToNextItem(), resultIter->GoToNextItem())
+  {
+    if (resultIter->IsDoneWithTraversal() ||
+      expectedIter->GetCurrentFlatIndex() != resultIter->GetCurrentFlatIndex())
+    {
+      cerr << "ERROR: the output trees differ." << endl;
+      return TEST_FAILED;
+    }
+    vtkPolyData* pd1 = vtkPolyData::SafeDownCast(expectedIter->GetCurrentDataObject());
+    vtkPolyData* pd2 = vtkPolyData::SafeDownCast(resultIter->GetCurrentDataObject());
+    if (!pd1 != !pd2)
+    {
+      cerr << "ERROR: leaf " << expectedIter->GetCurrentFlatIndex() << " differs." << endl;
+      return TEST_FAILED;
+    }
+    if (!pd1)
+    {
+      continue;
+    }
+    if (!pd2->GetCellData()->GetArray("vtkCompositeIndex") ||
+      !pd2->GetFieldData()->GetArray("vtkBlockColors") || !SamePolyData(pd1, pd2))
+    {
+      cerr << "ERROR: leaf " << expectedIter->GetCurrentFlatIndex() << " differs." << endl;
+      return TEST_FAILED;
+    }
+    ++numberOfLeaves;
+  }
+  // the non-null input leaves and the merged multipiece.
+  if (!resultIter->IsDoneWithTraversal() || numberOfLeaves < 6)
+  {
+    cerr << "ERROR: expected at least 6 leaves, got " << numberOfLeaves << "." << endl;
+    return TEST_FAILED;
+  }
+  return TEST_SUCCESS;
+}
@@ -24,6 +24,7 @@
 #include "vtkMultiBlockDataSet.h"
 #include "vtkMultiProcessController.h"
 #include "vtkObjectFactory.h"
+#include "vtkPVDataObjectMarshaller.h"
 #include "vtkPVSession.h"
 #include "vtkPolyData.h"
 #include "vtkProcessModule.h"
@@ -211,7 +212,20 @@ int vtkClientServerMoveData::SendData(vtkDataObject* input, vtkMultiProcessContr
     }
   }
 
-  return controller->Send(input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  // Send the binary marshalled buffer when the data type is supported,
+  // otherwise let the communicator serialize the data object. The length
+  // sent first tells the receiver which of the two to expect.
+  vtkIdType length = 0;
+  char* buffer = input ? vtkPVDataObjectMarshaller::Marshal(input, length) : nullptr;
+  vtkIdType header = buffer ? length : -1;
+  controller->Send(&header, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  if (buffer == nullptr)
+  {
+    return controller->Send(input, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  }
+  int ret = controller->Send(buffer, length, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+  delete[] buffer;
+  return ret;
 }
 
 //-----------------------------------------------------------------------------
@@ -240,7 +254,19 @@ vtkDataObject* vtkClientServerMoveData::ReceiveData(vtkMultiProcessController* c
   }
   else
   {
-    data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    vtkIdType length = -1;
+    controller->Receive(&length, 1, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    if (length < 0)
+    {
+      data = controller->ReceiveDataObject(1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+    }
+    else
+    {
+      char* buffer = new char[length];
+      controller->Receive(buffer, length, 1, vtkClientServerMoveData::TRANSMIT_DATA_OBJECT);
+      data = vtkPVDataObjectMarshaller::Unmarshal(buffer, length);
+      delete[] buffer;
+    }
   }
   return data;
 }
@@ -0,0 +1,493 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkDeltaLZ4Compressor.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkDeltaLZ4Compressor.h"
+
+#include "vtkMultiProcessStream.h"
+#include "vtkObjectFactory.h"
+#include "vtkUnsignedCharArray.h"
+
+#include "vtk_lz4.h"
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <sstream>
+
+namespace
+{
+enum FrameTypes
+{
+  KEY_FRAME = 0,
+  DELTA_FRAME = 1
+};
+
+// Frame header: type, frame number, width, height, number of components,
+// tile size and number of tiles that follow (delta frames only).
+const int HEADER_SIZE = 7;
+
+// When more than this fraction of tiles changed, a key frame is cheaper.
+const double MAX_CHANGED_TILES_FRACTION = 0.5;
+
+struct vtkTile
+{
+  int X;
+  int Y;
+  int Width;
+  int Height;
+};
+
+vtkTile vtkGetTile(int index, int tileSize, int width, int height)
+{
+  const int tilesX = (width + tileSize - 1) / tileSize;
+  vtkTile tile;
+  tile.X = (index % tilesX) * tileSize;
+  tile.Y = (index / tilesX) * tileSize;
+  tile.Width = std::min(tileSize, width - tile.X);
+  tile.Height = std::min(tileSize, height - tile.Y);
+  return tile;
+}
+
+int vtkGetNumberOfTiles(int tileSize, int width, int height)
+{
+  return ((width + tileSize - 1) / tileSize) * ((height + tileSize - 1) / tileSize);
+}
+
+// Copies the rows of a tile between an image and a contiguous tile buffer.
+// When `toImage` is true, `src` is the tile buffer, otherwise `dest` is.
+void vtkCopyTile(const vtkTile& tile, int width, int numComps, unsigned char* dest,
+  const unsigned char* src, bool toImage)
+{
+  const size_t rowStride = static_cast<size_t>(width) * numComps;
+  const size_t tileRow = static_cast<size_t>(tile.Width) * numComps;
+  for (int row = 0; row < tile.Height; ++row)
+  {
+    const size_t imageOffset = (tile.Y + row) * rowStride + tile.X * numComps;
+    const size_t tileOffset = row * tileRow;
+    if (toImage)
+    {
+      memcpy(dest + imageOffset, src + tileOffset, tileRow);
+    }
+    else
+    {
+      memcpy(dest + tileOffset, src + imageOffset, tileRow);
+    }
+  }
+}
+
+// Copies the rows of a tile between two images of the same size.
+void vtkCopyImageTile(
+  const vtkTile& tile, int width, int numComps, unsigned char* dest, const unsigned char* src)
+{
+  const size_t rowStride = static_cast<size_t>(width) * numComps;
+  const size_t tileRow = static_cast<size_t>(tile.Width) * numComps;
+  for (int row = 0; row < tile.Height; ++row)
+  {
+    const size_t offset = (tile.Y + row) * rowStride + tile.X * numComps;
+    memcpy(dest + offset, src + offset, tileRow);
+  }
+}
+
+bool vtkTileChanged(
+  const vtkTile& tile, int width, int numComps, const unsigned char* a, const unsigned char* b)
+{
+  const size_t rowStride = static_cast<size_t>(width) * numComps;
+  const size_t tileRow = static_cast<size_t>(tile.Width) * numComps;
+  for (int row = 0; row < tile.Height; ++row)
+  {
+    const size_t offset = (tile.Y + row) * rowStride + tile.X * numComps;
+    if (memcmp(a + offset, b + offset, tileRow) != 0)
+    {
+      return true;
+    }
+  }
+  return false;
+}
+}
+
+vtkStandardNewMacro(vtkDeltaLZ4Compressor);
+//----------------------------------------------------------------------------
+vtkDeltaLZ4Compressor::vtkDeltaLZ4Compressor()
+  : Quality(3)
+  , TileSize(64)
+  , KeyFrameInterval(100)
+  , Width(0)
+  , Height(0)
+  , KeyFrameRequested(false)
+  , KeyFrameNeeded(false)
+  , PreviousWidth(0)
+  , PreviousHeight(0)
+  , PreviousFrameNumber(-1)
+  , FramesSinceKeyFrame(0)
+{
+}
+
+//----------------------------------------------------------------------------
+vtkDeltaLZ4Compressor::~vtkDeltaLZ4Compressor()
+{
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaLZ4Compressor::SetImageResolution(int width, int height)
+{
+  this->Width = width;
+  this->Height = height;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaLZ4Compressor::Compress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot compress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  // The other side cannot decompress whatever is sent instead of a failed
+  // frame, so the next frame must not depend on it.
+  const int status = this->CompressFrame();
+  if (status != VTK_OK)
+  {
+    this->KeyFrameRequested = true;
+  }
+  return status;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaLZ4Compressor::CompressFrame()
+{
+  unsigned char compress_masks[6][4] = { { 0xFF, 0xFF, 0xFF, 0xFF }, { 0xFE, 0xFF, 0xFE, 0xFE },
+    { 0xFC, 0xFE, 0xFC, 0xFC }, { 0xF8, 0xFC, 0xF8, 0xF8 }, { 0xF0, 0xF8, 0xF0, 0xF0 },
+    { 0xE0, 0xF0, 0xE0, 0xE0 } };
+
+  int compress_level = this->LossLessMode ? 0 : this->Quality;
+  assert(compress_level >= 0 && compress_level <= 5);
+
+  vtkUnsignedCharArray* input = this->Input;
+  const int numComps = input->GetNumberOfComponents();
+  const vtkIdType numTuples = input->GetNumberOfTuples();
+
+  int width = this->Width;
+  int height = this->Height;
+  if (static_cast<vtkIdType>(width) * height != numTuples)
+  {
+    // resolution unknown, treat the image as a single row.
+    width = static_cast<int>(numTuples);
+    height = numTuples > 0 ? 1 : 0;
+  }
+
+  if (compress_level > 0 && numComps == 4)
+  {
+    unsigned int compress_mask;
+    memcpy(&compress_mask, &compress_masks[compress_level], 4);
+    this->TemporaryBuffer->SetNumberOfComponents(numComps);
+    this->TemporaryBuffer->SetNumberOfTuples(numTuples);
+    const unsigned int* in = reinterpret_cast<const unsigned int*>(input->GetPointer(0));
+    unsigned int* out = reinterpret_cast<unsigned int*>(this->TemporaryBuffer->GetPointer(0));
+    for (vtkIdType cc = 0; cc < numTuples; ++cc)
+    {
+      out[cc] = in[cc] & compress_mask;
+    }
+    input = this->TemporaryBuffer.Get();
+  }
+
+  const unsigned char* current = input->GetPointer(0);
+  const int inputSize = static_cast<int>(numTuples * numComps);
+  const int tileSize = this->TileSize;
+  const int numTiles = vtkGetNumberOfTiles(tileSize, width, height);
+
+  bool keyFrame = this->KeyFrameRequested || this->PreviousWidth != width ||
+    this->PreviousHeight != height ||
+    this->PreviousFrame->GetNumberOfComponents() != numComps ||
+    this->PreviousFrame->GetNumberOfTuples() != numTuples ||
+    (this->KeyFrameInterval > 0 && this->FramesSinceKeyFrame >= this->KeyFrameInterval);
+
+  std::vector<int> changedTiles;
+  if (!keyFrame)
+  {
+    const unsigned char* previous = this->PreviousFrame->GetPointer(0);
+    for (int cc = 0; cc < numTiles; ++cc)
+    {
+      if (vtkTileChanged(vtkGetTile(cc, tileSize, width, height), width, numComps, current,
+            previous))
+      {
+        changedTiles.push_back(cc);
+      }
+    }
+    keyFrame = changedTiles.size() > MAX_CHANGED_TILES_FRACTION * numTiles;
+  }
+
+  const int frameNumber = this->PreviousFrameNumber + 1;
+  int header[HEADER_SIZE] = { keyFrame ? KEY_FRAME : DELTA_FRAME, frameNumber, width, height,
+    numComps, tileSize, keyFrame ? 0 : static_cast<int>(changedTiles.size()) };
+
+  // Allocate for the worst case and shrink once done.
+  const int maxTileBytes = tileSize * tileSize * numComps;
+  vtkIdType maxOutputSize = sizeof(header);
+  if (keyFrame)
+  {
+    maxOutputSize += sizeof(int) + LZ4_compressBound(inputSize);
+  }
+  else
+  {
+    maxOutputSize +=
+      static_cast<vtkIdType>(changedTiles.size()) * (2 * sizeof(int) + LZ4_compressBound(maxTileBytes));
+  }
+  this->Output->SetNumberOfComponents(1);
+  char* output = reinterpret_cast<char*>(this->Output->WritePointer(0, maxOutputSize));
+  memcpy(output, header, sizeof(header));
+  vtkIdType outputSize = sizeof(header);
+
+  unsigned char* previous = nullptr;
+  if (keyFrame)
+  {
+    int compressedSize = LZ4_compress_fast(reinterpret_cast<const char*>(current),
+      output + outputSize + sizeof(int), inputSize, LZ4_compressBound(inputSize), 16);
+    if (inputSize > 0 && compressedSize <= 0)
+    {
+      return VTK_ERROR;
+    }
+    memcpy(output + outputSize, &compressedSize, sizeof(int));
+    outputSize += sizeof(int) + compressedSize;
+
+    this->PreviousFrame->SetNumberOfComponents(numComps);
+    this->PreviousFrame->SetNumberOfTuples(numTuples);
+    previous = this->PreviousFrame->GetPointer(0);
+    memcpy(previous, current, inputSize);
+    this->FramesSinceKeyFrame = 0;
+  }
+  else
+  {
+    this->TileBuffer.resize(maxTileBytes);
+    for (int index : changedTiles)
+    {
+      const vtkTile tile = vtkGetTile(index, tileSize, width, height);
+      const int tileBytes = tile.Width * tile.Height * numComps;
+      vtkCopyTile(tile, width, numComps,
+        reinterpret_cast<unsigned char*>(this->TileBuffer.data()), current, false);
+      int compressedSize = LZ4_compress_fast(this->TileBuffer.data(),
+        output + outputSize + 2 * sizeof(int), tileBytes, LZ4_compressBound(tileBytes), 16);
+      if (compressedSize <= 0)
+      {
+        return VTK_ERROR;
+      }
+      memcpy(output + outputSize, &index, sizeof(int));
+      memcpy(output + outputSize + sizeof(int), &compressedSize, sizeof(int));
+      outputSize += 2 * sizeof(int) + compressedSize;
+    }
+
+    // update the reference frame for the tiles that changed only, once they
+    // were all compressed.
+    previous = this->PreviousFrame->GetPointer(0);
+    for (int index : changedTiles)
+    {
+      vtkCopyImageTile(
+        vtkGetTile(index, tileSize, width, height), width, numComps, previous, current);
+    }
+    ++this->FramesSinceKeyFrame;
+  }
+
+  this->Output->SetNumberOfTuples(outputSize);
+  this->PreviousWidth = width;
+  this->PreviousHeight = height;
+  this->PreviousFrameNumber = frameNumber;
+  this->KeyFrameRequested = false;
+  return VTK_OK;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaLZ4Compressor::Decompress()
+{
+  if (!(this->Input && this->Output))
+  {
+    vtkWarningMacro("Cannot decompress, empty input or output detected.");
+    return VTK_ERROR;
+  }
+
+  // Delta frames are rejected while a key frame is needed, so a success
+  // means the previous frame is valid.
+  const int status = this->DecompressFrame();
+  this->KeyFrameNeeded = (status != VTK_OK);
+  return status;
+}
+
+//----------------------------------------------------------------------------
+int vtkDeltaLZ4Compressor::DecompressFrame()
+{
+  const char* input = reinterpret_cast<const char*>(this->Input->GetPointer(0));
+  const vtkIdType inputSize = this->Input->GetNumberOfTuples();
+  int header[HEADER_SIZE];
+  if (inputSize < static_cast<vtkIdType>(sizeof(header)))
+  {
+    vtkErrorMacro("Invalid compressed frame.");
+    return VTK_ERROR;
+  }
+  memcpy(header, input, sizeof(header));
+  const int frameType = header[0];
+  const int frameNumber = header[1];
+  const int width = header[2];
+  const int height = header[3];
+  const int numComps = header[4];
+  const int tileSize = header[5];
+  const int numChangedTiles = header[6];
+
+  const vtkIdType numValues = static_cast<vtkIdType>(width) * height * numComps;
+  if (this->Output->GetNumberOfComponents() != numComps ||
+    this->Output->GetNumberOfValues() != numValues)
+  {
+    vtkErrorMacro("Output does not match the compressed frame size.");
+    return VTK_ERROR;
+  }
+
+  unsigned char* output = this->Output->GetPointer(0);
+  const char* end = input + inputSize;
+  const char* cursor = input + sizeof(header);
+
+  if (frameType == KEY_FRAME)
+  {
+    int compressedSize;
+    if (cursor + sizeof(int) > end)
+    {
+      vtkErrorMacro("Truncated key frame.");
+      return VTK_ERROR;
+    }
+    memcpy(&compressedSize, cursor, sizeof(int));
+    cursor += sizeof(int);
+    if (compressedSize < 0 || cursor + compressedSize > end ||
+      (numValues > 0 &&
+        LZ4_decompress_safe(cursor, reinterpret_cast<char*>(output), compressedSize,
+          static_cast<int>(numValues)) != numValues))
+    {
+      vtkErrorMacro("Failed to decompress key frame.");
+      return VTK_ERROR;
+    }
+
+    this->PreviousFrame->SetNumberOfComponents(numComps);
+    this->PreviousFrame->SetNumberOfTuples(static_cast<vtkIdType>(width) * height);
+    memcpy(this->PreviousFrame->GetPointer(0), output, numValues);
+  }
+  else
+  {
+    if (this->KeyFrameNeeded || frameNumber != this->PreviousFrameNumber + 1 ||
+      width != this->PreviousWidth || height != this->PreviousHeight ||
+      numComps != this->PreviousFrame->GetNumberOfComponents())
+    {
+      // Some frame was lost or could not be decompressed, we cannot recover
+      // until the next key frame.
+      vtkErrorMacro("Delta frame does not match the previous frame.");
+      return VTK_ERROR;
+    }
+
+    // Tiles are decompressed into the output and copied to the previous frame
+    // once they all succeeded.
+    unsigned char* previous = this->PreviousFrame->GetPointer(0);
+    memcpy(output, previous, numValues);
+    const int numTiles = vtkGetNumberOfTiles(tileSize, width, height);
+    this->TileBuffer.resize(static_cast<size_t>(tileSize) * tileSize * numComps);
+    std::vector<int> changedTiles;
+    changedTiles.reserve(numChangedTiles > 0 ? numChangedTiles : 0);
+    for (int cc = 0; cc < numChangedTiles; ++cc)
+    {
+      int index, compressedSize;
+      if (cursor + 2 * sizeof(int) > end)
+      {
+        vtkErrorMacro("Truncated delta frame.");
+        return VTK_ERROR;
+      }
+      memcpy(&index, cursor, sizeof(int));
+      memcpy(&compressedSize, cursor + sizeof(int), sizeof(int));
+      cursor += 2 * sizeof(int);
+      if (index < 0 || index >= numTiles || compressedSize < 0 || cursor + compressedSize > end)
+      {
+        vtkErrorMacro("Invalid tile in delta frame.");
+        return VTK_ERROR;
+      }
+
+      const vtkTile tile = vtkGetTile(index, tileSize, width, height);
+      const int tileBytes = tile.Width * tile.Height * numComps;
+      if (LZ4_decompress_safe(cursor, this->TileBuffer.data(), compressedSize, tileBytes) !=
+        tileBytes)
+      {
+        vtkErrorMacro("Failed to decompress tile.");
+        return VTK_ERROR;
+      }
+      cursor += compressedSize;
+      vtkCopyTile(tile, width, numComps, output,
+        reinterpret_cast<unsigned char*>(this->TileBuffer.data()), true);
+      changedTiles.push_back(index);
+    }
+    for (int index : changedTiles)
+    {
+      vtkCopyImageTile(
+        vtkGetTile(index, tileSize, width, height), width, numComps, previous, output);
+    }
+  }
+
+  this->PreviousWidth = width;
+  this->PreviousHeight = height;
+  this->PreviousFrameNumber = frameNumber;
+  return VTK_OK;
+}
+
+//-----------------------------------------------------------------------------
+void vtkDeltaLZ4Compressor::SaveConfiguration(vtkMultiProcessStream* stream)
+{
+  this->Superclass::SaveConfiguration(stream);
+  *stream << this->Quality;
+}
+
+//-----------------------------------------------------------------------------
+bool vtkDeltaLZ4Compressor::RestoreConfiguration(vtkMultiProcessStream* stream)
+{
+  if (this->Superclass::RestoreConfiguration(stream))
+  {
+    int quality;
+    *stream >> quality;
+    this->SetQuality(quality);
+    return true;
+  }
+  return false;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaLZ4Compressor::SaveConfiguration()
+{
+  std::ostringstream oss;
+  oss << this->Superclass::SaveConfiguration() << " " << this->Quality;
+  this->SetConfiguration(oss.str().c_str());
+  return this->Configuration;
+}
+
+//-----------------------------------------------------------------------------
+const char* vtkDeltaLZ4Compressor::RestoreConfiguration(const char* stream)
+{
+  stream = this->Superclass::RestoreConfiguration(stream);
+  if (stream)
+  {
+    std::istringstream iss(stream);
+    int quality;
+    iss >> quality;
+    this->SetQuality(quality);
+    return stream + iss.tellg();
+  }
+  return 0;
+}
+
+//----------------------------------------------------------------------------
+void vtkDeltaLZ4Compressor::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "Quality: " << this->Quality << endl;
+  os << indent << "TileSize: " << this->TileSize << endl;
+  os << indent << "KeyFrameInterval: " << this->KeyFrameInterval << endl;
+}
@@ -0,0 +1,155 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkDeltaLZ4Compressor.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkDeltaLZ4Compressor
+ * @brief   Image compressor/decompressor that only sends the parts of an
+ * image that changed since the previous frame.
+ *
+ * vtkDeltaLZ4Compressor keeps the previous frame on both the compressing and
+ * the decompressing side. Images are split into square tiles and only the
+ * tiles that differ from the previous frame are LZ4 compressed and sent. When
+ * the image size changes, when too many tiles changed, or every
+ * KeyFrameInterval frames, a complete key frame is sent instead.
+ *
+ * Since frames depend on the previous ones, the same compressor instance
+ * must see every frame, in order, on both sides. For the same reason, the
+ * image must not be split and compressed in pieces (see IsStateless()).
+ *
+ * The configuration stream is `vtkDeltaLZ4Compressor <LossLessMode> <Quality>`
+ * where Quality has the same meaning as for vtkLZ4Compressor.
+*/
+
+#ifndef vtkDeltaLZ4Compressor_h
+#define vtkDeltaLZ4Compressor_h
+
+#include "vtkImageCompressor.h"
+#include "vtkNew.h"                                   // needed for vtkNew
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+#include <vector> // needed for std::vector
+
+class vtkMultiProcessStream;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkDeltaLZ4Compressor : public vtkImageCompressor
+{
+public:
+  static vtkDeltaLZ4Compressor* New();
+  vtkTypeMacro(vtkDeltaLZ4Compressor, vtkImageCompressor);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Set the quality measure. The value can be between 0 and 5. 0 means preserve
+   * input image quality while 5 means improve compression at the cost of image
+   * quality. See vtkLZ4Compressor.
+   */
+  vtkSetClampMacro(Quality, int, 0, 5);
+  vtkGetMacro(Quality, int);
+  //@}
+
+  //@{
+  /**
+   * Size, in pixels, of the square tiles compared between frames. Must be the
+   * same on both sides. Default is 64.
+   */
+  vtkSetClampMacro(TileSize, int, 8, 1024);
+  vtkGetMacro(TileSize, int);
+  //@}
+
+  //@{
+  /**
+   * A key frame is sent at least every KeyFrameInterval frames. 0 means key
+   * frames are only sent when needed. Default is 100.
+   */
+  vtkSetClampMacro(KeyFrameInterval, int, 0, VTK_INT_MAX);
+  vtkGetMacro(KeyFrameInterval, int);
+  //@}
+
+  /**
+   * Forces the next compressed frame to be a key frame.
+   */
+  void ForceKeyFrame() { this->KeyFrameRequested = true; }
+
+  /**
+   * On the decompressing side, true when the last frame could not be
+   * decompressed. Delta frames are then rejected until a key frame is
+   * received, which the compressing side should be asked for (see
+   * ForceKeyFrame()).
+   */
+  bool GetKeyFrameNeeded() const { return this->KeyFrameNeeded; }
+
+  //@{
+  /**
+   * Compress/Decompress data array on the objects input with results
+   * in the objects output. See also Set/GetInput/Output.
+   */
+  int Compress() override;
+  int Decompress() override;
+  //@}
+
+  void SetImageResolution(int width, int height) override;
+
+  /**
+   * Frames are encoded relative to the previous frame.
+   */
+  bool IsStateless() override { return false; }
+
+  //@{
+  /**
+   * Serialize/Restore compressor configuration (but not the data) into the stream.
+   */
+  void SaveConfiguration(vtkMultiProcessStream* stream) override;
+  bool RestoreConfiguration(vtkMultiProcessStream* stream) override;
+  const char* SaveConfiguration() override;
+  const char* RestoreConfiguration(const char* stream) override;
+  //@}
+
+protected:
+  vtkDeltaLZ4Compressor();
+  ~vtkDeltaLZ4Compressor() override;
+
+  int Quality;
+  int TileSize;
+  int KeyFrameInterval;
+
+private:
+  vtkDeltaLZ4Compressor(const vtkDeltaLZ4Compressor&) = delete;
+  void operator=(const vtkDeltaLZ4Compressor&) = delete;
+
+  /**
+   * Compress()/Decompress() without the failure handling. On failure, the
+   * previous frame is left unchanged.
+   */
+  int CompressFrame();
+  int DecompressFrame();
+
+  int Width;
+  int Height;
+  bool KeyFrameRequested;
+  bool KeyFrameNeeded;
+
+  // State of the last frame compressed/decompressed.
+  vtkNew<vtkUnsignedCharArray> PreviousFrame;
+  int PreviousWidth;
+  int PreviousHeight;
+  int PreviousFrameNumber;
+  int FramesSinceKeyFrame;
+
+  // Scratch buffers.
+  vtkNew<vtkUnsignedCharArray> TemporaryBuffer;
+  std::vector<char> TileBuffer;
+};
+
+#endif
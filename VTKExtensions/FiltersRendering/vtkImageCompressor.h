@@ -83,6 +83,15 @@ public:
    */
   virtual void SetImageResolution(int width, int height);
 
+  /**
+   * Returns true when each Compress/Decompress call is independent of the
+   * previous ones. Only such compressors may be used to process an image in
+   * several pieces with separate compressor instances. Compressors that keep
+   * state across frames (e.g. to encode differences between frames) return
+   * false.
+   */
+  virtual bool IsStateless() { return true; }
+
   /**
    * Serialize compressor configuration (but not the data) into the stream.
    */
@@ -31,6 +31,7 @@
 #include "vtkObjectFactory.h"
 #include "vtkOutlineFilter.h"
 #include "vtkPVConfig.h"
+#include "vtkPVDataObjectMarshaller.h"
 #include "vtkPVLogger.h"
 #include "vtkPVSession.h"
 #include "vtkPointData.h"
@@ -46,8 +47,6 @@
 #include <sstream>
 #include <vector>
 
-#include <vector>
-
 bool vtkMPIMoveData::UseZLibCompression = false;
 
 namespace
@@ -959,6 +958,25 @@ void vtkMPIMoveData::MarshalDataToBuffer(vtkDataObject* data)
     this->NumberOfBuffers = 0;
   }
 
+  // Prefer the binary marshaller which copies array buffers as-is. Only data
+  // types it does not support go through the legacy writer.
+  vtkIdType binaryLength = 0;
+  vtkTimerLog::MarkStartEvent("Binary marshal");
+  char* binaryBuffer = vtkPVDataObjectMarshaller::Marshal(
+    data, binaryLength, vtkMPIMoveData::UseZLibCompression);
+  vtkTimerLog::MarkEndEvent("Binary marshal");
+  if (binaryBuffer)
+  {
+    this->NumberOfBuffers = 1;
+    this->BufferLengths = new vtkIdType[1];
+    this->BufferLengths[0] = binaryLength;
+    this->BufferOffsets = new vtkIdType[1];
+    this->BufferOffsets[0] = 0;
+    this->Buffers = binaryBuffer;
+    this->BufferTotalLength = binaryLength;
+    return;
+  }
+
   // Copy input to isolate reader from the pipeline.
   vtkDataWriter* writer = vtkGenericDataObjectWriter::New();
   writer->SetInputData(data);
@@ -1042,6 +1060,25 @@ void vtkMPIMoveData::ReconstructDataFromBuffer(vtkDataObject* data)
     char* bufferArray = this->Buffers + this->BufferOffsets[idx];
     vtkIdType bufferLength = this->BufferLengths[idx];
 
+    if (vtkPVDataObjectMarshaller::IsMarshalledBuffer(bufferArray, bufferLength))
+    {
+      vtkTimerLog::MarkStartEvent("Binary unmarshal");
+      vtkDataObject* piece = vtkPVDataObjectMarshaller::Unmarshal(bufferArray, bufferLength);
+      vtkTimerLog::MarkEndEvent("Binary unmarshal");
+      if (piece)
+      {
+        // reconstructing data distributted on MPI node, so global ids are valid
+        unsetGlobalIdsAttribute(piece);
+        pieces.push_back(piece);
+        piece->Delete();
+      }
+      else
+      {
+        vtkErrorMacro("Failed to decode piece " << idx << ".");
+      }
+      continue;
+    }
+
     char* realBuffer = 0;
     if (bufferLength > 4 && strncmp(bufferArray, "zlib", 4) == 0)
     {
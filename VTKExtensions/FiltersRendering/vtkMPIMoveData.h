@@ -21,6 +21,9 @@
  * processes. It can redistributed polydata from M to N processors.
  * Update: This filter can now support delivering vtkUniformGridAMR datasets in
  * PASS_THROUGH and/or COLLECT modes.
+ *
+ * Data is serialized using vtkPVDataObjectMarshaller's binary format whenever
+ * the data type supports it and with the legacy VTK writer otherwise.
 */
 
 #ifndef vtkMPIMoveData_h
@@ -108,6 +111,8 @@ public:
    * When set to true, zlib compression is used. False by default.
    * This value has any effect only on the data-sender processes. The receiver
    * always checks the received data to see if zlib decompression is required.
+   * Data types supported by vtkPVDataObjectMarshaller are compressed one array
+   * at a time, other types are compressed as a whole.
    */
   static void SetUseZLibCompression(bool b);
   static bool GetUseZLibCompression();
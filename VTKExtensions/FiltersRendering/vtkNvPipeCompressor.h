@@ -56,6 +56,9 @@ public:
 
   void SetImageResolution(int img_width, int img_height);
 
+  // NvPipe encodes a video stream, frames depend on the previous ones.
+  bool IsStateless() override { return false; }
+
   //@{
   /// Description:
   /// Serialize/Restore compressor configuration (but not the data) into the stream.
@@ -0,0 +1,340 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVBinningDecimator.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVBinningDecimator.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkIdList.h"
+#include "vtkInformation.h"
+#include "vtkInformationVector.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkSmartPointer.h"
+
+#include <algorithm>
+#include <array>
+#include <numeric>
+#include <utility>
+#include <vector>
+
+namespace
+{
+enum CellKind
+{
+  VERTS,
+  LINES,
+  POLYS,
+  STRIPS
+};
+
+// Number of vertices, segments or triangles generated for a cell.
+vtkIdType GetNumberOfPrimitives(CellKind kind, vtkIdType npts)
+{
+  switch (kind)
+  {
+    case VERTS:
+      return npts;
+    case LINES:
+      return std::max(npts - 1, static_cast<vtkIdType>(0));
+    default:
+      return std::max(npts - 2, static_cast<vtkIdType>(0));
+  }
+}
+
+// Input point ids of the j-th primitive of a cell.
+void GetPrimitive(CellKind kind, const vtkIdType* pts, vtkIdType j, vtkIdType* ids)
+{
+  switch (kind)
+  {
+    case VERTS:
+      ids[0] = pts[j];
+      break;
+    case LINES:
+      ids[0] = pts[j];
+      ids[1] = pts[j + 1];
+      break;
+    case POLYS:
+      ids[0] = pts[0];
+      ids[1] = pts[j + 1];
+      ids[2] = pts[j + 2];
+      break;
+    case STRIPS:
+      // every other triangle of a strip is flipped to keep the orientation.
+      ids[0] = pts[j + (j & 1)];
+      ids[1] = pts[j + 1 - (j & 1)];
+      ids[2] = pts[j + 2];
+      break;
+  }
+}
+
+// A vertex, segment or triangle of the output, using output point ids, and
+// the id of the input cell it comes from.
+template <int K>
+struct Primitive
+{
+  std::array<vtkIdType, K> Ids;
+  vtkIdType CellId;
+};
+
+// Appends the primitives of the cells to `primitives`.
+template <int K>
+void MapCells(vtkCellArray* cells, CellKind kind, vtkIdType cellIdOffset,
+  const std::vector<vtkIdType>& pointMap, std::vector<Primitive<K> >& primitives)
+{
+  const vtkIdType numCells = cells->GetNumberOfCells();
+  std::vector<vtkIdType> offsets(numCells + 1, 0);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      offsets[cc + 1] = GetNumberOfPrimitives(kind, cells->GetCellSize(cc));
+    }
+  });
+  std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+  const size_t start = primitives.size();
+  primitives.resize(start + offsets[numCells]);
+
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    vtkIdList* cellIds = tlIds.Local();
+    vtkIdType ids[3];
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      cells->GetCellAtId(cc, cellIds);
+      const vtkIdType* pts = cellIds->GetPointer(0);
+      Primitive<K>* primitive = &primitives[start + offsets[cc]];
+      for (vtkIdType j = 0, max = offsets[cc + 1] - offsets[cc]; j < max; ++j, ++primitive)
+      {
+        GetPrimitive(kind, pts, j, ids);
+        for (int k = 0; k < K; ++k)
+        {
+          primitive->Ids[k] = pointMap[ids[k]];
+        }
+        primitive->CellId = cellIdOffset + cc;
+      }
+    }
+  });
+}
+
+// Removes the primitives that collapsed and the duplicates, keeping the first
+// one, while preserving the order of the others.
+template <int K>
+void RemoveDegeneratePrimitives(std::vector<Primitive<K> >& primitives)
+{
+  typedef std::array<vtkIdType, K> KeyType;
+  const vtkIdType size = static_cast<vtkIdType>(primitives.size());
+  std::vector<KeyType> keys(size);
+  std::vector<char> keep(size);
+  std::vector<vtkIdType> order(size);
+  vtkSMPTools::For(0, size, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      keys[cc] = primitives[cc].Ids;
+      std::sort(keys[cc].begin(), keys[cc].end());
+      keep[cc] = std::adjacent_find(keys[cc].begin(), keys[cc].end()) == keys[cc].end();
+      order[cc] = cc;
+    }
+  });
+
+  vtkSMPTools::Sort(order.begin(), order.end(), [&keys](vtkIdType a, vtkIdType b) {
+    return keys[a] != keys[b] ? keys[a] < keys[b] : a < b;
+  });
+  for (vtkIdType cc = 1; cc < size; ++cc)
+  {
+    if (keys[order[cc]] == keys[order[cc - 1]])
+    {
+      keep[order[cc]] = 0;
+    }
+  }
+
+  size_t count = 0;
+  for (vtkIdType cc = 0; cc < size; ++cc)
+  {
+    if (keep[cc])
+    {
+      primitives[count++] = primitives[cc];
+    }
+  }
+  primitives.resize(count);
+}
+
+template <int K>
+vtkSmartPointer<vtkCellArray> NewCellArray(const std::vector<Primitive<K> >& primitives)
+{
+  auto cells = vtkSmartPointer<vtkCellArray>::New();
+  cells->AllocateExact(static_cast<vtkIdType>(primitives.size()),
+    static_cast<vtkIdType>(primitives.size()) * K);
+  for (const auto& primitive : primitives)
+  {
+    cells->InsertNextCell(K, primitive.Ids.data());
+  }
+  return cells;
+}
+
+template <int K>
+void CopyPrimitiveCellData(vtkCellData* inCD, vtkCellData* outCD,
+  const std::vector<Primitive<K> >& primitives, vtkIdType& outCellId)
+{
+  for (const auto& primitive : primitives)
+  {
+    outCD->CopyData(inCD, primitive.CellId, outCellId++);
+  }
+}
+}
+
+vtkStandardNewMacro(vtkPVBinningDecimator);
+//----------------------------------------------------------------------------
+vtkPVBinningDecimator::vtkPVBinningDecimator()
+{
+  this->NumberOfDivisions[0] = this->NumberOfDivisions[1] = this->NumberOfDivisions[2] = 50;
+  this->CopyCellData = true;
+}
+
+//----------------------------------------------------------------------------
+vtkPVBinningDecimator::~vtkPVBinningDecimator() = default;
+
+//----------------------------------------------------------------------------
+int vtkPVBinningDecimator::RequestData(
+  vtkInformation*, vtkInformationVector** inputVector, vtkInformationVector* outputVector)
+{
+  vtkPolyData* input = vtkPolyData::GetData(inputVector[0], 0);
+  vtkPolyData* output = vtkPolyData::GetData(outputVector, 0);
+
+  vtkPoints* inPts = input->GetPoints();
+  const vtkIdType numPts = input->GetNumberOfPoints();
+  if (!inPts || numPts == 0)
+  {
+    return 1;
+  }
+
+  // Bin the points.
+  double bounds[6];
+  inPts->GetBounds(bounds);
+  int divs[3];
+  double scale[3];
+  for (int i = 0; i < 3; ++i)
+  {
+    divs[i] = std::max(this->NumberOfDivisions[i], 1);
+    const double length = bounds[2 * i + 1] - bounds[2 * i];
+    scale[i] = length > 0 ? divs[i] / length : 0.0;
+  }
+
+  std::vector<std::pair<vtkIdType, vtkIdType> > bins(numPts);
+  vtkSMPTools::For(0, numPts, [&](vtkIdType begin, vtkIdType end) {
+    double x[3];
+    for (vtkIdType ptId = begin; ptId < end; ++ptId)
+    {
+      inPts->GetPoint(ptId, x);
+      vtkIdType bin = 0;
+      for (int i = 2; i >= 0; --i)
+      {
+        const int ijk = static_cast<int>((x[i] - bounds[2 * i]) * scale[i]);
+        bin = bin * divs[i] + std::min(std::max(ijk, 0), divs[i] - 1);
+      }
+      bins[ptId] = std::make_pair(bin, ptId);
+    }
+  });
+  vtkSMPTools::Sort(bins.begin(), bins.end());
+  this->UpdateProgress(0.3);
+
+  // The point with the lowest id represents its bin.
+  std::vector<vtkIdType> pointMap(numPts);
+  std::vector<vtkIdType> representatives;
+  for (vtkIdType cc = 0; cc < numPts; ++cc)
+  {
+    if (cc == 0 || bins[cc].first != bins[cc - 1].first)
+    {
+      representatives.push_back(bins[cc].second);
+    }
+    pointMap[bins[cc].second] = static_cast<vtkIdType>(representatives.size()) - 1;
+  }
+
+  const vtkIdType numNewPts = static_cast<vtkIdType>(representatives.size());
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(inPts->GetDataType());
+  newPts->SetNumberOfPoints(numNewPts);
+  vtkPointData* inPD = input->GetPointData();
+  vtkPointData* outPD = output->GetPointData();
+  outPD->CopyAllocate(inPD, numNewPts);
+  for (vtkIdType cc = 0; cc < numNewPts; ++cc)
+  {
+    newPts->SetPoint(cc, inPts->GetPoint(representatives[cc]));
+    outPD->CopyData(inPD, representatives[cc], cc);
+  }
+  output->SetPoints(newPts);
+  this->UpdateProgress(0.5);
+
+  // Map the cells to the representative points. Input cell ids follow the
+  // order of the vtkPolyData cell arrays.
+  const vtkIdType numVerts = input->GetNumberOfVerts();
+  const vtkIdType numLines = input->GetNumberOfLines();
+  const vtkIdType numPolys = input->GetNumberOfPolys();
+
+  std::vector<Primitive<1> > verts;
+  MapCells(input->GetVerts(), VERTS, 0, pointMap, verts);
+  RemoveDegeneratePrimitives(verts);
+
+  std::vector<Primitive<2> > lines;
+  MapCells(input->GetLines(), LINES, numVerts, pointMap, lines);
+  RemoveDegeneratePrimitives(lines);
+
+  std::vector<Primitive<3> > triangles;
+  MapCells(input->GetPolys(), POLYS, numVerts + numLines, pointMap, triangles);
+  MapCells(input->GetStrips(), STRIPS, numVerts + numLines + numPolys, pointMap, triangles);
+  RemoveDegeneratePrimitives(triangles);
+  this->UpdateProgress(0.9);
+
+  if (!verts.empty())
+  {
+    output->SetVerts(NewCellArray(verts));
+  }
+  if (!lines.empty())
+  {
+    output->SetLines(NewCellArray(lines));
+  }
+  if (!triangles.empty())
+  {
+    output->SetPolys(NewCellArray(triangles));
+  }
+
+  if (this->CopyCellData)
+  {
+    vtkCellData* inCD = input->GetCellData();
+    vtkCellData* outCD = output->GetCellData();
+    outCD->CopyAllocate(
+      inCD, static_cast<vtkIdType>(verts.size() + lines.size() + triangles.size()));
+    vtkIdType outCellId = 0;
+    CopyPrimitiveCellData(inCD, outCD, verts, outCellId);
+    CopyPrimitiveCellData(inCD, outCD, lines, outCellId);
+    CopyPrimitiveCellData(inCD, outCD, triangles, outCellId);
+  }
+
+  output->GetFieldData()->PassData(input->GetFieldData());
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVBinningDecimator::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+  os << indent << "NumberOfDivisions: " << this->NumberOfDivisions[0] << ", "
+     << this->NumberOfDivisions[1] << ", " << this->NumberOfDivisions[2] << endl;
+  os << indent << "CopyCellData: " << this->CopyCellData << endl;
+}
@@ -0,0 +1,86 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVBinningDecimator.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVBinningDecimator
+ * @brief   multithreaded vertex clustering decimation for LOD geometry
+ *
+ * vtkPVBinningDecimator reduces a vtkPolyData by binning its points in a
+ * regular grid covering the bounds of the input and by replacing all the
+ * points falling in a bin with a single representative input point, the one
+ * with the lowest id. Cells are then mapped to the representative points:
+ * polygons and triangle strips are output as triangles, polylines as line
+ * segments and polyvertices as vertices. Cells that collapsed (e.g. triangles
+ * with two points in the same bin) and duplicates are removed.
+ *
+ * This is similar to vtkQuadricClustering with UseInputPoints on, without the
+ * quadric error metric, hence it is faster and does not allocate the full
+ * grid, so its cost does not depend on the number of divisions. Binning,
+ * cell mapping and the removal of duplicates are done using vtkSMPTools.
+ *
+ * Point data of the representative points is passed to the output. Cell data
+ * is passed too when CopyCellData is on, each output cell taking the data of
+ * the input cell it comes from.
+ *
+ * @sa
+ * vtkQuadricClustering
+*/
+
+#ifndef vtkPVBinningDecimator_h
+#define vtkPVBinningDecimator_h
+
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
+#include "vtkPolyDataAlgorithm.h"
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkPVBinningDecimator : public vtkPolyDataAlgorithm
+{
+public:
+  static vtkPVBinningDecimator* New();
+  vtkTypeMacro(vtkPVBinningDecimator, vtkPolyDataAlgorithm);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  //@{
+  /**
+   * Set/Get the number of bins along each axis. Default is 50x50x50.
+   */
+  vtkSetVector3Macro(NumberOfDivisions, int);
+  vtkGetVector3Macro(NumberOfDivisions, int);
+  //@}
+
+  //@{
+  /**
+   * When on, cell data is passed from the input cells to the output cells
+   * generated from them. Default is on.
+   */
+  vtkSetMacro(CopyCellData, bool);
+  vtkGetMacro(CopyCellData, bool);
+  vtkBooleanMacro(CopyCellData, bool);
+  //@}
+
+protected:
+  vtkPVBinningDecimator();
+  ~vtkPVBinningDecimator() override;
+
+  int RequestData(vtkInformation* request, vtkInformationVector** inputVector,
+    vtkInformationVector* outputVector) override;
+
+  int NumberOfDivisions[3];
+  bool CopyCellData;
+
+private:
+  vtkPVBinningDecimator(const vtkPVBinningDecimator&) = delete;
+  void operator=(const vtkPVBinningDecimator&) = delete;
+};
+
+#endif
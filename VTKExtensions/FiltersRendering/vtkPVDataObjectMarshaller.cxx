@@ -0,0 +1,999 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVDataObjectMarshaller.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVDataObjectMarshaller.h"
+
+#include "vtkByteSwap.h"
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCompositeDataSet.h"
+#include "vtkDataArray.h"
+#include "vtkDataObjectTypes.h"
+#include "vtkIdTypeArray.h"
+#include "vtkImageData.h"
+#include "vtkInformation.h"
+#include "vtkMatrix3x3.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkMultiPieceDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkRectilinearGrid.h"
+#include "vtkSmartPointer.h"
+#include "vtkStringArray.h"
+#include "vtkStructuredGrid.h"
+#include "vtkTable.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include "vtk_zlib.h"
+
+#include <cassert>
+#include <cstring>
+#include <limits>
+#include <string>
+
+namespace
+{
+// Magic bytes identifying the buffer. Chosen so that it cannot be confused
+// with the legacy writer output ("# vtk") or the "zlib" tag used by
+// vtkMPIMoveData for compressed legacy buffers.
+const char MAGIC[4] = { 'p', 'v', 'd', 'o' };
+const vtkTypeUInt32 ENDIAN_MARKER = 1;
+const vtkTypeUInt32 FORMAT_VERSION = 1;
+
+// Array buffers smaller than this are never compressed.
+const vtkTypeUInt64 COMPRESSION_THRESHOLD = 4096;
+
+enum ArrayKinds
+{
+  NO_ARRAY = 0,
+  DATA_ARRAY = 1,
+  STRING_ARRAY = 2
+};
+
+//----------------------------------------------------------------------------
+// Writer used in two passes: first without a buffer to compute the (upper
+// bound of the) size, then with a buffer of that size to fill it.
+class vtkMarshalWriter
+{
+public:
+  char* Data = nullptr;
+  vtkIdType Size = 0;
+  bool Compress = false;
+
+  void Write(const void* ptr, size_t n)
+  {
+    if (this->Data && n > 0)
+    {
+      memcpy(this->Data + this->Size, ptr, n);
+    }
+    this->Size += static_cast<vtkIdType>(n);
+  }
+
+  template <typename T>
+  void WriteValue(T value)
+  {
+    this->Write(&value, sizeof(T));
+  }
+
+  void WriteString(const char* str)
+  {
+    if (str == nullptr)
+    {
+      this->WriteValue<vtkTypeInt32>(-1);
+      return;
+    }
+    const vtkTypeInt32 len = static_cast<vtkTypeInt32>(strlen(str));
+    this->WriteValue<vtkTypeInt32>(len);
+    this->Write(str, len);
+  }
+
+  void WriteBlock(const void* ptr, vtkTypeUInt64 nbytes)
+  {
+    if (this->Compress && nbytes >= COMPRESSION_THRESHOLD &&
+      nbytes < static_cast<vtkTypeUInt64>(std::numeric_limits<uLong>::max()))
+    {
+      const uLong bound = compressBound(static_cast<uLong>(nbytes));
+      if (this->Data == nullptr)
+      {
+        this->Size += static_cast<vtkIdType>(
+          sizeof(vtkTypeUInt8) + 2 * sizeof(vtkTypeUInt64) + static_cast<size_t>(bound));
+        return;
+      }
+
+      const vtkIdType start = this->Size;
+      this->WriteValue<vtkTypeUInt8>(1);
+      this->WriteValue<vtkTypeUInt64>(nbytes);
+      const vtkIdType sizeLocation = this->Size;
+      this->Size += sizeof(vtkTypeUInt64);
+      uLongf outSize = bound;
+      if (compress2(reinterpret_cast<Bytef*>(this->Data + this->Size), &outSize,
+            reinterpret_cast<const Bytef*>(ptr), static_cast<uLong>(nbytes),
+            Z_DEFAULT_COMPRESSION) == Z_OK)
+      {
+        const vtkTypeUInt64 compressedSize = outSize;
+        memcpy(this->Data + sizeLocation, &compressedSize, sizeof(vtkTypeUInt64));
+        this->Size += static_cast<vtkIdType>(outSize);
+        return;
+      }
+      // compression failed, rewind and store the block uncompressed. That
+      // always fits since the uncompressed size is smaller than the bound.
+      this->Size = start;
+    }
+
+    this->WriteValue<vtkTypeUInt8>(0);
+    this->WriteValue<vtkTypeUInt64>(nbytes);
+    this->Write(ptr, static_cast<size_t>(nbytes));
+  }
+};
+
+//----------------------------------------------------------------------------
+class vtkMarshalReader
+{
+public:
+  const char* Current = nullptr;
+  const char* End = nullptr;
+  bool Swap = false;
+  bool Valid = true;
+
+  bool Read(void* ptr, size_t n)
+  {
+    if (!this->Valid || static_cast<size_t>(this->End - this->Current) < n)
+    {
+      this->Valid = false;
+      return false;
+    }
+    memcpy(ptr, this->Current, n);
+    this->Current += n;
+    return true;
+  }
+
+  template <typename T>
+  T ReadValue()
+  {
+    T value = T();
+    if (this->Read(&value, sizeof(T)) && this->Swap)
+    {
+      vtkByteSwap::SwapVoidRange(&value, 1, sizeof(T));
+    }
+    return value;
+  }
+
+  bool ReadString(std::string& str, bool& isNull)
+  {
+    const vtkTypeInt32 len = this->ReadValue<vtkTypeInt32>();
+    isNull = (len < 0);
+    if (len <= 0)
+    {
+      str.clear();
+      return this->Valid;
+    }
+    if (static_cast<vtkTypeInt64>(this->End - this->Current) < len)
+    {
+      this->Valid = false;
+      return false;
+    }
+    str.assign(this->Current, static_cast<size_t>(len));
+    this->Current += len;
+    return true;
+  }
+
+  // Decodes a block directly into `dest`, which must be `nbytes` long.
+  bool ReadBlock(void* dest, vtkTypeUInt64 nbytes, int wordSize)
+  {
+    const vtkTypeUInt8 compressed = this->ReadValue<vtkTypeUInt8>();
+    const vtkTypeUInt64 rawSize = this->ReadValue<vtkTypeUInt64>();
+    if (!this->Valid || rawSize != nbytes)
+    {
+      this->Valid = false;
+      return false;
+    }
+    if (compressed)
+    {
+      const vtkTypeUInt64 compressedSize = this->ReadValue<vtkTypeUInt64>();
+      if (!this->Valid ||
+        static_cast<vtkTypeUInt64>(this->End - this->Current) < compressedSize)
+      {
+        this->Valid = false;
+        return false;
+      }
+      uLongf destLen = static_cast<uLongf>(nbytes);
+      if (uncompress(reinterpret_cast<Bytef*>(dest), &destLen,
+            reinterpret_cast<const Bytef*>(this->Current),
+            static_cast<uLong>(compressedSize)) != Z_OK ||
+        destLen != nbytes)
+      {
+        this->Valid = false;
+        return false;
+      }
+      this->Current += compressedSize;
+    }
+    else if (!this->Read(dest, static_cast<size_t>(nbytes)))
+    {
+      return false;
+    }
+
+    if (this->Swap && wordSize > 1 && nbytes > 0)
+    {
+      vtkByteSwap::SwapVoidRange(dest, static_cast<size_t>(nbytes / wordSize), wordSize);
+    }
+    return true;
+  }
+};
+
+//----------------------------------------------------------------------------
+bool WriteArray(vtkMarshalWriter& writer, vtkAbstractArray* array)
+{
+  if (array == nullptr)
+  {
+    writer.WriteValue<vtkTypeUInt8>(NO_ARRAY);
+    return true;
+  }
+
+  vtkDataArray* da = vtkDataArray::SafeDownCast(array);
+  vtkStringArray* sa = vtkStringArray::SafeDownCast(array);
+  if (da == nullptr && sa == nullptr)
+  {
+    // vtkVariantArray, vtkBitArray storage etc. are not supported.
+    return false;
+  }
+  if (da && da->GetDataType() == VTK_BIT)
+  {
+    return false;
+  }
+
+  const int numComps = array->GetNumberOfComponents();
+  writer.WriteValue<vtkTypeUInt8>(da ? DATA_ARRAY : STRING_ARRAY);
+  writer.WriteValue<vtkTypeInt32>(array->GetDataType());
+  writer.WriteValue<vtkTypeInt32>(array->GetDataTypeSize());
+  writer.WriteValue<vtkTypeInt32>(numComps);
+  writer.WriteValue<vtkTypeInt64>(array->GetNumberOfTuples());
+  writer.WriteString(array->GetName());
+
+  const bool hasComponentNames = array->HasAComponentName();
+  writer.WriteValue<vtkTypeUInt8>(hasComponentNames ? 1 : 0);
+  if (hasComponentNames)
+  {
+    for (int cc = 0; cc < numComps; ++cc)
+    {
+      writer.WriteString(array->GetComponentName(cc));
+    }
+  }
+
+  if (da)
+  {
+    const vtkTypeUInt64 nbytes = static_cast<vtkTypeUInt64>(da->GetNumberOfValues()) *
+      static_cast<vtkTypeUInt64>(da->GetDataTypeSize());
+    vtkSmartPointer<vtkDataArray> contiguous = da;
+    if (writer.Data != nullptr && nbytes > 0 && !da->HasStandardMemoryLayout())
+    {
+      // e.g. SOA or implicit arrays; flatten to an array-of-structs copy.
+      contiguous = vtkSmartPointer<vtkDataArray>::Take(
+        vtkDataArray::CreateDataArray(da->GetDataType()));
+      contiguous->DeepCopy(da);
+    }
+    writer.WriteBlock(
+      (writer.Data != nullptr && nbytes > 0) ? contiguous->GetVoidPointer(0) : nullptr, nbytes);
+  }
+  else
+  {
+    const vtkIdType numValues = sa->GetNumberOfValues();
+    for (vtkIdType cc = 0; cc < numValues; ++cc)
+    {
+      const vtkStdString& value = sa->GetValue(cc);
+      writer.WriteValue<vtkTypeUInt64>(static_cast<vtkTypeUInt64>(value.size()));
+      writer.Write(value.c_str(), value.size());
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+// Returns false on error. `array` is left null when the sender wrote no
+// array.
+bool ReadArray(vtkMarshalReader& reader, vtkSmartPointer<vtkAbstractArray>& array)
+{
+  array = nullptr;
+  const vtkTypeUInt8 kind = reader.ReadValue<vtkTypeUInt8>();
+  if (!reader.Valid)
+  {
+    return false;
+  }
+  if (kind == NO_ARRAY)
+  {
+    return true;
+  }
+  if (kind != DATA_ARRAY && kind != STRING_ARRAY)
+  {
+    return false;
+  }
+
+  const int dataType = reader.ReadValue<vtkTypeInt32>();
+  const int dataTypeSize = reader.ReadValue<vtkTypeInt32>();
+  const int numComps = reader.ReadValue<vtkTypeInt32>();
+  const vtkIdType numTuples = static_cast<vtkIdType>(reader.ReadValue<vtkTypeInt64>());
+  std::string name;
+  bool nameIsNull;
+  if (!reader.ReadString(name, nameIsNull) || numComps < 1 || numTuples < 0)
+  {
+    return false;
+  }
+
+  array = vtkSmartPointer<vtkAbstractArray>::Take(vtkAbstractArray::CreateArray(dataType));
+  if (!array || array->GetDataTypeSize() != dataTypeSize ||
+    (kind == DATA_ARRAY) != (vtkDataArray::SafeDownCast(array) != nullptr))
+  {
+    // this happens, for example, when vtkIdType sizes differ between sender
+    // and receiver.
+    array = nullptr;
+    return false;
+  }
+  array->SetNumberOfComponents(numComps);
+  if (!nameIsNull)
+  {
+    array->SetName(name.c_str());
+  }
+
+  if (reader.ReadValue<vtkTypeUInt8>() != 0)
+  {
+    for (int cc = 0; cc < numComps; ++cc)
+    {
+      std::string compName;
+      bool compNameIsNull;
+      if (!reader.ReadString(compName, compNameIsNull))
+      {
+        return false;
+      }
+      if (!compNameIsNull)
+      {
+        array->SetComponentName(cc, compName.c_str());
+      }
+    }
+  }
+
+  array->SetNumberOfTuples(numTuples);
+  if (kind == DATA_ARRAY)
+  {
+    const vtkTypeUInt64 nbytes = static_cast<vtkTypeUInt64>(array->GetNumberOfValues()) *
+      static_cast<vtkTypeUInt64>(dataTypeSize);
+    return reader.ReadBlock(
+      nbytes > 0 ? array->GetVoidPointer(0) : nullptr, nbytes, dataTypeSize);
+  }
+
+  vtkStringArray* sa = vtkStringArray::SafeDownCast(array);
+  const vtkIdType numValues = sa->GetNumberOfValues();
+  for (vtkIdType cc = 0; cc < numValues; ++cc)
+  {
+    const vtkTypeUInt64 len = reader.ReadValue<vtkTypeUInt64>();
+    if (!reader.Valid || static_cast<vtkTypeUInt64>(reader.End - reader.Current) < len)
+    {
+      return false;
+    }
+    sa->SetValue(cc, vtkStdString(reader.Current, static_cast<size_t>(len)));
+    reader.Current += len;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+template <typename ArrayT>
+bool ReadTypedArray(vtkMarshalReader& reader, vtkSmartPointer<ArrayT>& array)
+{
+  vtkSmartPointer<vtkAbstractArray> abstractArray;
+  if (!ReadArray(reader, abstractArray))
+  {
+    return false;
+  }
+  array = ArrayT::SafeDownCast(abstractArray);
+  return abstractArray == nullptr || array != nullptr;
+}
+
+//----------------------------------------------------------------------------
+bool WriteFieldData(vtkMarshalWriter& writer, vtkFieldData* fd)
+{
+  const int numArrays = fd ? fd->GetNumberOfArrays() : 0;
+  writer.WriteValue<vtkTypeInt32>(numArrays);
+  for (int cc = 0; cc < numArrays; ++cc)
+  {
+    if (!WriteArray(writer, fd->GetAbstractArray(cc)))
+    {
+      return false;
+    }
+  }
+
+  if (vtkDataSetAttributes* dsa = vtkDataSetAttributes::SafeDownCast(fd))
+  {
+    int attributeIndices[vtkDataSetAttributes::NUM_ATTRIBUTES];
+    dsa->GetAttributeIndices(attributeIndices);
+    for (int cc = 0; cc < vtkDataSetAttributes::NUM_ATTRIBUTES; ++cc)
+    {
+      writer.WriteValue<vtkTypeInt32>(attributeIndices[cc]);
+    }
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool ReadFieldData(vtkMarshalReader& reader, vtkFieldData* fd)
+{
+  const int numArrays = reader.ReadValue<vtkTypeInt32>();
+  if (!reader.Valid || numArrays < 0)
+  {
+    return false;
+  }
+
+  for (int cc = 0; cc < numArrays; ++cc)
+  {
+    vtkSmartPointer<vtkAbstractArray> array;
+    if (!ReadArray(reader, array))
+    {
+      return false;
+    }
+    if (array)
+    {
+      fd->AddArray(array);
+    }
+  }
+
+  if (vtkDataSetAttributes* dsa = vtkDataSetAttributes::SafeDownCast(fd))
+  {
+    for (int cc = 0; cc < vtkDataSetAttributes::NUM_ATTRIBUTES; ++cc)
+    {
+      const int index = reader.ReadValue<vtkTypeInt32>();
+      if (index >= 0 && index < numArrays)
+      {
+        dsa->SetActiveAttribute(index, cc);
+      }
+    }
+  }
+  return reader.Valid;
+}
+
+//----------------------------------------------------------------------------
+bool WritePoints(vtkMarshalWriter& writer, vtkPoints* points)
+{
+  return WriteArray(writer, points ? points->GetData() : nullptr);
+}
+
+//----------------------------------------------------------------------------
+bool ReadPoints(vtkMarshalReader& reader, vtkPointSet* ps)
+{
+  vtkSmartPointer<vtkDataArray> data;
+  if (!ReadTypedArray(reader, data))
+  {
+    return false;
+  }
+  if (data)
+  {
+    vtkNew<vtkPoints> points;
+    points->SetData(data);
+    ps->SetPoints(points);
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool WriteCells(vtkMarshalWriter& writer, vtkCellArray* cells)
+{
+  if (cells == nullptr || cells->GetNumberOfCells() == 0)
+  {
+    writer.WriteValue<vtkTypeUInt8>(0);
+    return true;
+  }
+  writer.WriteValue<vtkTypeUInt8>(1);
+  return WriteArray(writer, cells->GetOffsetsArray()) &&
+    WriteArray(writer, cells->GetConnectivityArray());
+}
+
+//----------------------------------------------------------------------------
+bool ReadCells(vtkMarshalReader& reader, vtkSmartPointer<vtkCellArray>& cells)
+{
+  cells = nullptr;
+  if (reader.ReadValue<vtkTypeUInt8>() == 0)
+  {
+    return reader.Valid;
+  }
+
+  vtkSmartPointer<vtkDataArray> offsets;
+  vtkSmartPointer<vtkDataArray> connectivity;
+  if (!ReadTypedArray(reader, offsets) || !ReadTypedArray(reader, connectivity) || !offsets ||
+    !connectivity)
+  {
+    return false;
+  }
+  cells = vtkSmartPointer<vtkCellArray>::New();
+  return cells->SetData(offsets, connectivity);
+}
+
+//----------------------------------------------------------------------------
+bool WriteDataObject(vtkMarshalWriter& writer, vtkDataObject* dobj);
+vtkSmartPointer<vtkDataObject> ReadDataObject(vtkMarshalReader& reader);
+
+//----------------------------------------------------------------------------
+void WriteChildName(vtkMarshalWriter& writer, vtkInformation* metaData)
+{
+  writer.WriteString(metaData && metaData->Has(vtkCompositeDataSet::NAME())
+      ? metaData->Get(vtkCompositeDataSet::NAME())
+      : nullptr);
+}
+
+//----------------------------------------------------------------------------
+bool WriteDataObject(vtkMarshalWriter& writer, vtkDataObject* dobj)
+{
+  if (dobj == nullptr)
+  {
+    writer.WriteValue<vtkTypeInt32>(-1);
+    return true;
+  }
+
+  const int type = dobj->GetDataObjectType();
+  writer.WriteValue<vtkTypeInt32>(type);
+  switch (type)
+  {
+    case VTK_POLY_DATA:
+    {
+      vtkPolyData* pd = vtkPolyData::SafeDownCast(dobj);
+      if (!WritePoints(writer, pd->GetPoints()) || !WriteCells(writer, pd->GetVerts()) ||
+        !WriteCells(writer, pd->GetLines()) || !WriteCells(writer, pd->GetPolys()) ||
+        !WriteCells(writer, pd->GetStrips()))
+      {
+        return false;
+      }
+    }
+    break;
+
+    case VTK_UNSTRUCTURED_GRID:
+    {
+      vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(dobj);
+      if (!WritePoints(writer, ug->GetPoints()) || !WriteArray(writer, ug->GetCellTypesArray()) ||
+        !WriteCells(writer, ug->GetCells()) || !WriteArray(writer, ug->GetFaceLocations()) ||
+        !WriteArray(writer, ug->GetFaces()))
+      {
+        return false;
+      }
+    }
+    break;
+
+    case VTK_IMAGE_DATA:
+    case VTK_STRUCTURED_POINTS:
+    case VTK_UNIFORM_GRID:
+    {
+      vtkImageData* id = vtkImageData::SafeDownCast(dobj);
+      const int* extent = id->GetExtent();
+      for (int cc = 0; cc < 6; ++cc)
+      {
+        writer.WriteValue<vtkTypeInt32>(extent[cc]);
+      }
+      writer.Write(id->GetOrigin(), 3 * sizeof(double));
+      writer.Write(id->GetSpacing(), 3 * sizeof(double));
+      writer.Write(id->GetDirectionMatrix()->GetData(), 9 * sizeof(double));
+    }
+    break;
+
+    case VTK_STRUCTURED_GRID:
+    {
+      vtkStructuredGrid* sg = vtkStructuredGrid::SafeDownCast(dobj);
+      const int* extent = sg->GetExtent();
+      for (int cc = 0; cc < 6; ++cc)
+      {
+        writer.WriteValue<vtkTypeInt32>(extent[cc]);
+      }
+      if (!WritePoints(writer, sg->GetPoints()))
+      {
+        return false;
+      }
+    }
+    break;
+
+    case VTK_RECTILINEAR_GRID:
+    {
+      vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(dobj);
+      const int* extent = rg->GetExtent();
+      for (int cc = 0; cc < 6; ++cc)
+      {
+        writer.WriteValue<vtkTypeInt32>(extent[cc]);
+      }
+      if (!WriteArray(writer, rg->GetXCoordinates()) ||
+        !WriteArray(writer, rg->GetYCoordinates()) || !WriteArray(writer, rg->GetZCoordinates()))
+      {
+        return false;
+      }
+    }
+    break;
+
+    case VTK_TABLE:
+      if (!WriteFieldData(writer, vtkTable::SafeDownCast(dobj)->GetRowData()))
+      {
+        return false;
+      }
+      break;
+
+    case VTK_MULTIBLOCK_DATA_SET:
+    {
+      vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(dobj);
+      const unsigned int numBlocks = mb->GetNumberOfBlocks();
+      writer.WriteValue<vtkTypeUInt32>(numBlocks);
+      for (unsigned int cc = 0; cc < numBlocks; ++cc)
+      {
+        WriteChildName(writer, mb->HasMetaData(cc) ? mb->GetMetaData(cc) : nullptr);
+        if (!WriteDataObject(writer, mb->GetBlock(cc)))
+        {
+          return false;
+        }
+      }
+    }
+    break;
+
+    case VTK_MULTIPIECE_DATA_SET:
+    {
+      vtkMultiPieceDataSet* mp = vtkMultiPieceDataSet::SafeDownCast(dobj);
+      const unsigned int numPieces = mp->GetNumberOfPieces();
+      writer.WriteValue<vtkTypeUInt32>(numPieces);
+      for (unsigned int cc = 0; cc < numPieces; ++cc)
+      {
+        WriteChildName(writer, mp->HasMetaData(cc) ? mp->GetMetaData(cc) : nullptr);
+        if (!WriteDataObject(writer, mp->GetPieceAsDataObject(cc)))
+        {
+          return false;
+        }
+      }
+    }
+    break;
+
+    default:
+      return false;
+  }
+
+  if (vtkDataSet* ds = vtkDataSet::SafeDownCast(dobj))
+  {
+    if (!WriteFieldData(writer, ds->GetPointData()) || !WriteFieldData(writer, ds->GetCellData()))
+    {
+      return false;
+    }
+  }
+  return WriteFieldData(writer, dobj->GetFieldData());
+}
+
+//----------------------------------------------------------------------------
+bool ReadExtent(vtkMarshalReader& reader, int extent[6])
+{
+  for (int cc = 0; cc < 6; ++cc)
+  {
+    extent[cc] = reader.ReadValue<vtkTypeInt32>();
+  }
+  return reader.Valid;
+}
+
+//----------------------------------------------------------------------------
+bool ReadDoubles(vtkMarshalReader& reader, double* values, int count)
+{
+  for (int cc = 0; cc < count; ++cc)
+  {
+    values[cc] = reader.ReadValue<double>();
+  }
+  return reader.Valid;
+}
+
+//----------------------------------------------------------------------------
+vtkSmartPointer<vtkDataObject> ReadDataObject(vtkMarshalReader& reader)
+{
+  const int type = reader.ReadValue<vtkTypeInt32>();
+  if (!reader.Valid || type < 0)
+  {
+    return nullptr;
+  }
+
+  auto dobj = vtkSmartPointer<vtkDataObject>::Take(vtkDataObjectTypes::NewDataObject(type));
+  if (!dobj)
+  {
+    reader.Valid = false;
+    return nullptr;
+  }
+
+  switch (type)
+  {
+    case VTK_POLY_DATA:
+    {
+      vtkPolyData* pd = vtkPolyData::SafeDownCast(dobj);
+      vtkSmartPointer<vtkCellArray> cells[4];
+      if (!ReadPoints(reader, pd) || !ReadCells(reader, cells[0]) ||
+        !ReadCells(reader, cells[1]) || !ReadCells(reader, cells[2]) ||
+        !ReadCells(reader, cells[3]))
+      {
+        reader.Valid = false;
+        return nullptr;
+      }
+      pd->SetVerts(cells[0]);
+      pd->SetLines(cells[1]);
+      pd->SetPolys(cells[2]);
+      pd->SetStrips(cells[3]);
+    }
+    break;
+
+    case VTK_UNSTRUCTURED_GRID:
+    {
+      vtkUnstructuredGrid* ug = vtkUnstructuredGrid::SafeDownCast(dobj);
+      vtkSmartPointer<vtkUnsignedCharArray> cellTypes;
+      vtkSmartPointer<vtkCellArray> cells;
+      vtkSmartPointer<vtkIdTypeArray> faceLocations;
+      vtkSmartPointer<vtkIdTypeArray> faces;
+      if (!ReadPoints(reader, ug) || !ReadTypedArray(reader, cellTypes) ||
+        !ReadCells(reader, cells) || !ReadTypedArray(reader, faceLocations) ||
+        !ReadTypedArray(reader, faces))
+      {
+        reader.Valid = false;
+        return nullptr;
+      }
+      if (cellTypes && cells)
+      {
+        if (faceLocations && faces)
+        {
+          ug->SetCells(cellTypes, cells, faceLocations, faces);
+        }
+        else
+        {
+          ug->SetCells(cellTypes, cells);
+        }
+      }
+    }
+    break;
+
+    case VTK_IMAGE_DATA:
+    case VTK_STRUCTURED_POINTS:
+    case VTK_UNIFORM_GRID:
+    {
+      vtkImageData* id = vtkImageData::SafeDownCast(dobj);
+      int extent[6];
+      double origin[3], spacing[3], direction[9];
+      if (!ReadExtent(reader, extent) || !ReadDoubles(reader, origin, 3) ||
+        !ReadDoubles(reader, spacing, 3) || !ReadDoubles(reader, direction, 9))
+      {
+        return nullptr;
+      }
+      id->SetExtent(extent);
+      id->SetOrigin(origin);
+      id->SetSpacing(spacing);
+      id->SetDirectionMatrix(direction);
+    }
+    break;
+
+    case VTK_STRUCTURED_GRID:
+    {
+      vtkStructuredGrid* sg = vtkStructuredGrid::SafeDownCast(dobj);
+      int extent[6];
+      if (!ReadExtent(reader, extent) || !ReadPoints(reader, sg))
+      {
+        reader.Valid = false;
+        return nullptr;
+      }
+      sg->SetExtent(extent);
+    }
+    break;
+
+    case VTK_RECTILINEAR_GRID:
+    {
+      vtkRectilinearGrid* rg = vtkRectilinearGrid::SafeDownCast(dobj);
+      int extent[6];
+      vtkSmartPointer<vtkDataArray> coords[3];
+      if (!ReadExtent(reader, extent) || !ReadTypedArray(reader, coords[0]) ||
+        !ReadTypedArray(reader, coords[1]) || !ReadTypedArray(reader, coords[2]))
+      {
+        reader.Valid = false;
+        return nullptr;
+      }
+      rg->SetExtent(extent);
+      rg->SetXCoordinates(coords[0]);
+      rg->SetYCoordinates(coords[1]);
+      rg->SetZCoordinates(coords[2]);
+    }
+    break;
+
+    case VTK_TABLE:
+      if (!ReadFieldData(reader, vtkTable::SafeDownCast(dobj)->GetRowData()))
+      {
+        reader.Valid = false;
+        return nullptr;
+      }
+      break;
+
+    case VTK_MULTIBLOCK_DATA_SET:
+    {
+      vtkMultiBlockDataSet* mb = vtkMultiBlockDataSet::SafeDownCast(dobj);
+      const unsigned int numBlocks = reader.ReadValue<vtkTypeUInt32>();
+      if (!reader.Valid)
+      {
+        return nullptr;
+      }
+      mb->SetNumberOfBlocks(numBlocks);
+      for (unsigned int cc = 0; cc < numBlocks; ++cc)
+      {
+        std::string name;
+        bool nameIsNull;
+        if (!reader.ReadString(name, nameIsNull))
+        {
+          return nullptr;
+        }
+        mb->SetBlock(cc, ReadDataObject(reader));
+        if (!reader.Valid)
+        {
+          return nullptr;
+        }
+        if (!nameIsNull)
+        {
+          mb->GetMetaData(cc)->Set(vtkCompositeDataSet::NAME(), name.c_str());
+        }
+      }
+    }
+    break;
+
+    case VTK_MULTIPIECE_DATA_SET:
+    {
+      vtkMultiPieceDataSet* mp = vtkMultiPieceDataSet::SafeDownCast(dobj);
+      const unsigned int numPieces = reader.ReadValue<vtkTypeUInt32>();
+      if (!reader.Valid)
+      {
+        return nullptr;
+      }
+      mp->SetNumberOfPieces(numPieces);
+      for (unsigned int cc = 0; cc < numPieces; ++cc)
+      {
+        std::string name;
+        bool nameIsNull;
+        if (!reader.ReadString(name, nameIsNull))
+        {
+          return nullptr;
+        }
+        mp->SetPiece(cc, ReadDataObject(reader));
+        if (!reader.Valid)
+        {
+          return nullptr;
+        }
+        if (!nameIsNull)
+        {
+          mp->GetMetaData(cc)->Set(vtkCompositeDataSet::NAME(), name.c_str());
+        }
+      }
+    }
+    break;
+
+    default:
+      reader.Valid = false;
+      return nullptr;
+  }
+
+  if (vtkDataSet* ds = vtkDataSet::SafeDownCast(dobj))
+  {
+    if (!ReadFieldData(reader, ds->GetPointData()) || !ReadFieldData(reader, ds->GetCellData()))
+    {
+      reader.Valid = false;
+      return nullptr;
+    }
+  }
+  if (!ReadFieldData(reader, dobj->GetFieldData()))
+  {
+    reader.Valid = false;
+    return nullptr;
+  }
+  return dobj;
+}
+
+//----------------------------------------------------------------------------
+bool WriteBuffer(vtkMarshalWriter& writer, vtkDataObject* data)
+{
+  writer.Write(MAGIC, sizeof(MAGIC));
+  writer.WriteValue<vtkTypeUInt32>(ENDIAN_MARKER);
+  writer.WriteValue<vtkTypeUInt32>(FORMAT_VERSION);
+  return WriteDataObject(writer, data);
+}
+}
+
+vtkStandardNewMacro(vtkPVDataObjectMarshaller);
+//----------------------------------------------------------------------------
+vtkPVDataObjectMarshaller::vtkPVDataObjectMarshaller()
+{
+}
+
+//----------------------------------------------------------------------------
+vtkPVDataObjectMarshaller::~vtkPVDataObjectMarshaller()
+{
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataObjectMarshaller::CanMarshal(vtkDataObject* data)
+{
+  // A sizing pass does not touch any array memory.
+  vtkMarshalWriter writer;
+  return WriteBuffer(writer, data);
+}
+
+//----------------------------------------------------------------------------
+char* vtkPVDataObjectMarshaller::Marshal(vtkDataObject* data, vtkIdType& length, bool compress)
+{
+  length = 0;
+
+  // First pass computes the required size (an upper bound when compressing),
+  // the second pass fills the buffer.
+  vtkMarshalWriter writer;
+  writer.Compress = compress;
+  if (!WriteBuffer(writer, data))
+  {
+    return nullptr;
+  }
+
+  const vtkIdType capacity = writer.Size;
+  writer.Data = new char[capacity];
+  writer.Size = 0;
+  WriteBuffer(writer, data);
+  assert(writer.Size <= capacity);
+
+  length = writer.Size;
+  return writer.Data;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPVDataObjectMarshaller::IsMarshalledBuffer(const char* buffer, vtkIdType length)
+{
+  return buffer != nullptr && length >= static_cast<vtkIdType>(sizeof(MAGIC)) &&
+    memcmp(buffer, MAGIC, sizeof(MAGIC)) == 0;
+}
+
+//----------------------------------------------------------------------------
+vtkDataObject* vtkPVDataObjectMarshaller::Unmarshal(const char* buffer, vtkIdType length)
+{
+  if (!vtkPVDataObjectMarshaller::IsMarshalledBuffer(buffer, length))
+  {
+    return nullptr;
+  }
+
+  vtkMarshalReader reader;
+  reader.Current = buffer + sizeof(MAGIC);
+  reader.End = buffer + length;
+
+  vtkTypeUInt32 marker = reader.ReadValue<vtkTypeUInt32>();
+  if (marker != ENDIAN_MARKER)
+  {
+    vtkByteSwap::SwapVoidRange(&marker, 1, sizeof(vtkTypeUInt32));
+    if (marker != ENDIAN_MARKER)
+    {
+      vtkGenericWarningMacro("Invalid marshalled data object buffer.");
+      return nullptr;
+    }
+    reader.Swap = true;
+  }
+
+  const vtkTypeUInt32 version = reader.ReadValue<vtkTypeUInt32>();
+  if (!reader.Valid || version != FORMAT_VERSION)
+  {
+    vtkGenericWarningMacro("Unsupported marshalled data object version: " << version);
+    return nullptr;
+  }
+
+  vtkSmartPointer<vtkDataObject> dobj = ReadDataObject(reader);
+  if (!reader.Valid || !dobj)
+  {
+    vtkGenericWarningMacro("Failed to decode marshalled data object buffer.");
+    return nullptr;
+  }
+  dobj->Register(nullptr);
+  return dobj;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataObjectMarshaller::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
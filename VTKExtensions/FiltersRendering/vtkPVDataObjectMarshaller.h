@@ -0,0 +1,89 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVDataObjectMarshaller.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVDataObjectMarshaller
+ * @brief   binary wire format for moving data objects between processes.
+ *
+ * vtkPVDataObjectMarshaller converts data objects to and from a compact
+ * binary buffer that is used by vtkMPIMoveData and vtkClientServerMoveData to
+ * deliver data. Unlike the legacy VTK writer/reader pair, array contents are
+ * copied as raw contiguous memory: the sender writes each array's buffer
+ * directly into the message and the receiver decodes it directly into the
+ * storage of the final array, without any text parsing or intermediate
+ * copies. Individual arrays can optionally be zlib-compressed.
+ *
+ * vtkPolyData, vtkUnstructuredGrid, vtkImageData (and subclasses),
+ * vtkStructuredGrid, vtkRectilinearGrid, vtkTable, vtkMultiBlockDataSet and
+ * vtkMultiPieceDataSet are supported, as long as their arrays are either
+ * vtkDataArray or vtkStringArray subclasses. `CanMarshal` can be used to
+ * check whether a data object is supported; callers are expected to fall back
+ * to another serialization for other types.
+ *
+ * The buffer is tagged with a magic header and an endianness marker, so
+ * receivers can tell it apart from other encodings (`IsMarshalledBuffer`)
+ * and byte-swap when the sender has a different byte order.
+*/
+
+#ifndef vtkPVDataObjectMarshaller_h
+#define vtkPVDataObjectMarshaller_h
+
+#include "vtkObject.h"
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for exports
+
+class vtkDataObject;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkPVDataObjectMarshaller : public vtkObject
+{
+public:
+  static vtkPVDataObjectMarshaller* New();
+  vtkTypeMacro(vtkPVDataObjectMarshaller, vtkObject);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Returns true if `data` can be encoded using this marshaller.
+   */
+  static bool CanMarshal(vtkDataObject* data);
+
+  /**
+   * Encodes `data` into a newly allocated buffer. The caller takes ownership
+   * of the returned buffer and must release it using `delete[]`. `length` is
+   * set to the number of valid bytes in the buffer. When `compress` is true,
+   * array buffers larger than a few kilobytes are zlib-compressed.
+   * Returns nullptr if the data object is not supported.
+   */
+  static char* Marshal(vtkDataObject* data, vtkIdType& length, bool compress = false);
+
+  /**
+   * Decodes a buffer produced by `Marshal`. Returns a new data object (the
+   * caller is responsible for releasing the reference) or nullptr if the
+   * buffer is invalid.
+   */
+  static vtkDataObject* Unmarshal(const char* buffer, vtkIdType length);
+
+  /**
+   * Returns true if the buffer starts with the header written by `Marshal`.
+   */
+  static bool IsMarshalledBuffer(const char* buffer, vtkIdType length);
+
+protected:
+  vtkPVDataObjectMarshaller();
+  ~vtkPVDataObjectMarshaller() override;
+
+private:
+  vtkPVDataObjectMarshaller(const vtkPVDataObjectMarshaller&) = delete;
+  void operator=(const vtkPVDataObjectMarshaller&) = delete;
+};
+
+#endif
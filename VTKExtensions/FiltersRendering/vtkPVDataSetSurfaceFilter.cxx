@@ -0,0 +1,424 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVDataSetSurfaceFilter.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+#include "vtkPVDataSetSurfaceFilter.h"
+
+#include "vtkCellArray.h"
+#include "vtkCellData.h"
+#include "vtkCellType.h"
+#include "vtkDataSetAttributes.h"
+#include "vtkIdList.h"
+#include "vtkIdTypeArray.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkPolyData.h"
+#include "vtkSMPThreadLocal.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
+#include "vtkUnsignedCharArray.h"
+#include "vtkUnstructuredGrid.h"
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <numeric>
+#include <vector>
+
+namespace
+{
+// Faces of the linear 3D cells, with the same ordering (and orientation) as
+// the corresponding vtkCell subclasses. Triangles are terminated by -1.
+const int TetraFaces[4][4] = { { 0, 1, 3, -1 }, { 1, 2, 3, -1 }, { 2, 0, 3, -1 },
+  { 0, 2, 1, -1 } };
+const int VoxelFaces[6][4] = { { 0, 4, 6, 2 }, { 1, 3, 7, 5 }, { 0, 1, 5, 4 }, { 2, 6, 7, 3 },
+  { 0, 2, 3, 1 }, { 4, 5, 7, 6 } };
+const int HexahedronFaces[6][4] = { { 0, 4, 7, 3 }, { 1, 2, 6, 5 }, { 0, 1, 5, 4 },
+  { 3, 7, 6, 2 }, { 0, 3, 2, 1 }, { 4, 5, 6, 7 } };
+const int WedgeFaces[5][4] = { { 0, 1, 2, -1 }, { 3, 5, 4, -1 }, { 0, 3, 4, 1 }, { 1, 4, 5, 2 },
+  { 2, 5, 3, 0 } };
+const int PyramidFaces[5][4] = { { 0, 3, 2, 1 }, { 0, 1, 4, -1 }, { 1, 2, 4, -1 },
+  { 2, 3, 4, -1 }, { 3, 0, 4, -1 } };
+
+const int (*GetFaces(int cellType, int& numFaces))[4]
+{
+  switch (cellType)
+  {
+    case VTK_TETRA:
+      numFaces = 4;
+      return TetraFaces;
+    case VTK_VOXEL:
+      numFaces = 6;
+      return VoxelFaces;
+    case VTK_HEXAHEDRON:
+      numFaces = 6;
+      return HexahedronFaces;
+    case VTK_WEDGE:
+      numFaces = 5;
+      return WedgeFaces;
+    case VTK_PYRAMID:
+      numFaces = 5;
+      return PyramidFaces;
+    default:
+      numFaces = 0;
+      return nullptr;
+  }
+}
+
+// Cell types passed as they are to the output.
+bool IsPassedCellType(int cellType)
+{
+  switch (cellType)
+  {
+    case VTK_EMPTY_CELL:
+    case VTK_VERTEX:
+    case VTK_POLY_VERTEX:
+    case VTK_LINE:
+    case VTK_POLY_LINE:
+    case VTK_TRIANGLE:
+    case VTK_QUAD:
+    case VTK_POLYGON:
+    case VTK_PIXEL:
+      return true;
+    default:
+      return false;
+  }
+}
+
+// A face of a 3D cell. The key holds the sorted point ids of the face, the
+// triangles having a leading -1. IdType is int when all the point and cell ids
+// fit, which makes records of 24 bytes instead of 48 bytes.
+template <typename IdType>
+struct FaceRecord
+{
+  std::array<IdType, 4> Key;
+  IdType CellId;
+  int Face;
+
+  bool operator<(const FaceRecord& other) const
+  {
+    return this->Key != other.Key ? this->Key < other.Key : this->CellId < other.CellId;
+  }
+};
+
+// A cell of the output: either a face of a 3D cell or, when Face is -1, the
+// input cell itself.
+struct OutputCell
+{
+  vtkIdType CellId;
+  int Face;
+
+  bool operator<(const OutputCell& other) const
+  {
+    return this->CellId != other.CellId ? this->CellId < other.CellId : this->Face < other.Face;
+  }
+};
+
+// Collects the cells of the output, unsorted: the external faces of the 3D
+// cells, and the other cells, which are output as they are.
+template <typename IdType>
+void CollectOutputCells(
+  vtkUnstructuredGrid* input, vtkAlgorithm* self, std::vector<OutputCell>& outputCells)
+{
+  typedef FaceRecord<IdType> RecordType;
+  typedef std::vector<std::vector<RecordType> > FacePartitions;
+
+  const vtkIdType numCells = input->GetNumberOfCells();
+  vtkCellArray* cells = input->GetCells();
+
+  // Hash the faces of the 3D cells into partitions using their largest point
+  // id.
+  const size_t numPartitions =
+    4 * static_cast<size_t>(std::max(vtkSMPTools::GetEstimatedNumberOfThreads(), 1));
+  vtkSMPThreadLocal<FacePartitions> tlFaces;
+  vtkSMPThreadLocal<std::vector<OutputCell> > tlPassedCells;
+  vtkSMPThreadLocalObject<vtkIdList> tlIds;
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    FacePartitions& partitions = tlFaces.Local();
+    partitions.resize(numPartitions);
+    std::vector<OutputCell>& passedCells = tlPassedCells.Local();
+    vtkIdList* ids = tlIds.Local();
+    for (vtkIdType cellId = begin; cellId < end; ++cellId)
+    {
+      const int cellType = input->GetCellType(cellId);
+      int numFaces;
+      const int(*faces)[4] = GetFaces(cellType, numFaces);
+      if (!faces)
+      {
+        if (cellType != VTK_EMPTY_CELL)
+        {
+          passedCells.push_back(OutputCell{ cellId, -1 });
+        }
+        continue;
+      }
+
+      cells->GetCellAtId(cellId, ids);
+      const vtkIdType* pts = ids->GetPointer(0);
+      for (int face = 0; face < numFaces; ++face)
+      {
+        RecordType record;
+        record.Key[0] = faces[face][3] < 0 ? -1 : static_cast<IdType>(pts[faces[face][3]]);
+        record.Key[1] = static_cast<IdType>(pts[faces[face][0]]);
+        record.Key[2] = static_cast<IdType>(pts[faces[face][1]]);
+        record.Key[3] = static_cast<IdType>(pts[faces[face][2]]);
+        std::sort(record.Key.begin(), record.Key.end());
+        record.CellId = static_cast<IdType>(cellId);
+        record.Face = face;
+        partitions[static_cast<size_t>(record.Key[3]) % numPartitions].push_back(record);
+      }
+    }
+  });
+  self->UpdateProgress(0.4);
+
+  std::vector<FacePartitions*> threadFaces;
+  for (auto iter = tlFaces.begin(); iter != tlFaces.end(); ++iter)
+  {
+    if (!iter->empty())
+    {
+      threadFaces.push_back(&*iter);
+    }
+  }
+
+  // Merge each partition independently, keeping the faces used only once.
+  std::vector<std::vector<OutputCell> > externalFaces(numPartitions);
+  vtkSMPTools::For(0, static_cast<vtkIdType>(numPartitions), [&](vtkIdType begin, vtkIdType end) {
+    std::vector<RecordType> records;
+    for (vtkIdType partition = begin; partition < end; ++partition)
+    {
+      records.clear();
+      for (FacePartitions* partitions : threadFaces)
+      {
+        const auto& faces = (*partitions)[partition];
+        records.insert(records.end(), faces.begin(), faces.end());
+      }
+      std::sort(records.begin(), records.end());
+
+      auto& result = externalFaces[partition];
+      for (size_t cc = 0; cc < records.size();)
+      {
+        size_t next = cc + 1;
+        while (next < records.size() && records[next].Key == records[cc].Key)
+        {
+          ++next;
+        }
+        if (next == cc + 1)
+        {
+          result.push_back(OutputCell{ records[cc].CellId, records[cc].Face });
+        }
+        cc = next;
+      }
+    }
+  });
+  self->UpdateProgress(0.7);
+
+  for (const auto& faces : externalFaces)
+  {
+    outputCells.insert(outputCells.end(), faces.begin(), faces.end());
+  }
+  for (auto iter = tlPassedCells.begin(); iter != tlPassedCells.end(); ++iter)
+  {
+    outputCells.insert(outputCells.end(), iter->begin(), iter->end());
+  }
+}
+}
+
+vtkStandardNewMacro(vtkPVDataSetSurfaceFilter);
+//----------------------------------------------------------------------------
+vtkPVDataSetSurfaceFilter::vtkPVDataSetSurfaceFilter() = default;
+
+//----------------------------------------------------------------------------
+vtkPVDataSetSurfaceFilter::~vtkPVDataSetSurfaceFilter() = default;
+
+//----------------------------------------------------------------------------
+bool vtkPVDataSetSurfaceFilter::IsThreadedExecutionSupported(vtkUnstructuredGrid* input)
+{
+  if (!input || !input->GetCells() || !input->GetCellTypesArray())
+  {
+    return false;
+  }
+
+  const vtkIdType numCells = input->GetNumberOfCells();
+  vtkUnsignedCharArray* ghosts = input->GetCellGhostArray();
+  std::atomic<bool> supported(true);
+  vtkSMPTools::For(0, numCells, [&](vtkIdType begin, vtkIdType end) {
+    for (vtkIdType cellId = begin; cellId < end && supported; ++cellId)
+    {
+      const int cellType = input->GetCellType(cellId);
+      int numFaces;
+      if ((!IsPassedCellType(cellType) && !GetFaces(cellType, numFaces)) ||
+        (ghosts && (ghosts->GetValue(cellId) & vtkDataSetAttributes::HIDDENCELL)))
+      {
+        supported = false;
+      }
+    }
+  });
+  return supported;
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataSetSurfaceFilter::UnstructuredGridExecute(vtkDataSet* input, vtkPolyData* output)
+{
+  vtkUnstructuredGrid* grid = vtkUnstructuredGrid::SafeDownCast(input);
+  if (grid && grid->GetNumberOfCells() > 0 &&
+    vtkPVDataSetSurfaceFilter::IsThreadedExecutionSupported(grid))
+  {
+    return this->ThreadedUnstructuredGridExecute(grid, output);
+  }
+  return this->Superclass::UnstructuredGridExecute(input, output);
+}
+
+//----------------------------------------------------------------------------
+int vtkPVDataSetSurfaceFilter::ThreadedUnstructuredGridExecute(
+  vtkUnstructuredGrid* input, vtkPolyData* output)
+{
+  vtkCellArray* cells = input->GetCells();
+
+  // Use compact face records when all the ids fit in an int.
+  std::vector<OutputCell> outputCells;
+  if (input->GetNumberOfPoints() <= VTK_INT_MAX && input->GetNumberOfCells() <= VTK_INT_MAX)
+  {
+    CollectOutputCells<int>(input, this, outputCells);
+  }
+  else
+  {
+    CollectOutputCells<vtkIdType>(input, this, outputCells);
+  }
+  vtkSMPTools::Sort(outputCells.begin(), outputCells.end());
+
+  // Generate the output cells, in the verts, lines, polys order of vtkPolyData,
+  // and number the points by first use.
+  std::vector<vtkIdType> pointMap(input->GetNumberOfPoints(), -1);
+  vtkNew<vtkIdList> srcPointIds;
+  vtkNew<vtkIdList> srcCellIds;
+  srcCellIds->Allocate(static_cast<vtkIdType>(outputCells.size()));
+  vtkNew<vtkCellArray> verts;
+  vtkNew<vtkCellArray> lines;
+  vtkNew<vtkCellArray> polys;
+  vtkNew<vtkIdList> ids;
+  std::vector<vtkIdType> outPts;
+  for (int pass = 0; pass < 3; ++pass)
+  {
+    vtkCellArray* outCells = pass == 0 ? verts.Get() : (pass == 1 ? lines.Get() : polys.Get());
+    for (const auto& outputCell : outputCells)
+    {
+      const int cellType = input->GetCellType(outputCell.CellId);
+      const int kind = (cellType == VTK_VERTEX || cellType == VTK_POLY_VERTEX)
+        ? 0
+        : ((cellType == VTK_LINE || cellType == VTK_POLY_LINE) ? 1 : 2);
+      if (kind != pass)
+      {
+        continue;
+      }
+
+      cells->GetCellAtId(outputCell.CellId, ids);
+      const vtkIdType* pts = ids->GetPointer(0);
+      outPts.clear();
+      if (outputCell.Face >= 0)
+      {
+        int numFaces;
+        const int* face = GetFaces(cellType, numFaces)[outputCell.Face];
+        for (int cc = 0; cc < 4 && face[cc] >= 0; ++cc)
+        {
+          outPts.push_back(pts[face[cc]]);
+        }
+      }
+      else if (cellType == VTK_PIXEL)
+      {
+        outPts.insert(outPts.end(), { pts[0], pts[1], pts[3], pts[2] });
+      }
+      else
+      {
+        outPts.insert(outPts.end(), pts, pts + ids->GetNumberOfIds());
+      }
+
+      for (auto& ptId : outPts)
+      {
+        if (pointMap[ptId] < 0)
+        {
+          pointMap[ptId] = srcPointIds->GetNumberOfIds();
+          srcPointIds->InsertNextId(ptId);
+        }
+        ptId = pointMap[ptId];
+      }
+      outCells->InsertNextCell(static_cast<vtkIdType>(outPts.size()), outPts.data());
+      srcCellIds->InsertNextId(outputCell.CellId);
+    }
+  }
+  this->UpdateProgress(0.9);
+
+  const vtkIdType numOutPts = srcPointIds->GetNumberOfIds();
+  const vtkIdType numOutCells = srcCellIds->GetNumberOfIds();
+  vtkNew<vtkIdList> dstPointIds;
+  dstPointIds->SetNumberOfIds(numOutPts);
+  std::iota(dstPointIds->GetPointer(0), dstPointIds->GetPointer(0) + numOutPts, 0);
+  vtkNew<vtkIdList> dstCellIds;
+  dstCellIds->SetNumberOfIds(numOutCells);
+  std::iota(dstCellIds->GetPointer(0), dstCellIds->GetPointer(0) + numOutCells, 0);
+
+  vtkPoints* inPts = input->GetPoints();
+  vtkNew<vtkPoints> newPts;
+  newPts->SetDataType(inPts->GetDataType());
+  newPts->SetNumberOfPoints(numOutPts);
+  newPts->InsertPoints(dstPointIds, srcPointIds, inPts);
+  output->SetPoints(newPts);
+
+  vtkPointData* outPD = output->GetPointData();
+  outPD->CopyAllocate(input->GetPointData(), numOutPts);
+  outPD->CopyData(input->GetPointData(), srcPointIds, dstPointIds);
+  vtkCellData* outCD = output->GetCellData();
+  outCD->CopyAllocate(input->GetCellData(), numOutCells);
+  outCD->CopyData(input->GetCellData(), srcCellIds, dstCellIds);
+
+  if (verts->GetNumberOfCells() > 0)
+  {
+    output->SetVerts(verts);
+  }
+  if (lines->GetNumberOfCells() > 0)
+  {
+    output->SetLines(lines);
+  }
+  if (polys->GetNumberOfCells() > 0)
+  {
+    output->SetPolys(polys);
+  }
+
+  if (this->PassThroughCellIds)
+  {
+    vtkNew<vtkIdTypeArray> originalCellIds;
+    originalCellIds->SetName(this->GetOriginalCellIdsName());
+    originalCellIds->SetNumberOfValues(numOutCells);
+    std::copy(srcCellIds->GetPointer(0), srcCellIds->GetPointer(0) + numOutCells,
+      originalCellIds->GetPointer(0));
+    outCD->AddArray(originalCellIds);
+  }
+  if (this->PassThroughPointIds)
+  {
+    vtkNew<vtkIdTypeArray> originalPointIds;
+    originalPointIds->SetName(this->GetOriginalPointIdsName());
+    originalPointIds->SetNumberOfValues(numOutPts);
+    std::copy(srcPointIds->GetPointer(0), srcPointIds->GetPointer(0) + numOutPts,
+      originalPointIds->GetPointer(0));
+    outPD->AddArray(originalPointIds);
+  }
+
+  output->GetFieldData()->PassData(input->GetFieldData());
+  return 1;
+}
+
+//----------------------------------------------------------------------------
+void vtkPVDataSetSurfaceFilter::PrintSelf(ostream& os, vtkIndent indent)
+{
+  this->Superclass::PrintSelf(os, indent);
+}
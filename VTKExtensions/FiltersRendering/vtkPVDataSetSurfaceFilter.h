@@ -0,0 +1,78 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    vtkPVDataSetSurfaceFilter.h
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+/**
+ * @class   vtkPVDataSetSurfaceFilter
+ * @brief   vtkDataSetSurfaceFilter with threaded extraction for unstructured grids
+ *
+ * vtkPVDataSetSurfaceFilter extracts the external faces of vtkUnstructuredGrid
+ * inputs using vtkSMPTools. The faces of the 3D cells are hashed into
+ * partitions by each thread; partitions are then sorted and merged
+ * independently of one another, keeping the faces used by a single cell. 2D
+ * and lower dimensional cells are passed as they are, as
+ * vtkDataSetSurfaceFilter does.
+ *
+ * Output cells are ordered by the id of the input cell they come from, and
+ * output points by first use. Point and cell data, as well as the original
+ * point and cell ids when PassThroughPointIds and PassThroughCellIds are on,
+ * are passed the same way as vtkDataSetSurfaceFilter.
+ *
+ * Only linear cells (vertices, lines, polygons, pixels, tetrahedra, voxels,
+ * hexahedra, wedges and pyramids) are handled by the threaded
+ * implementation. Other unstructured grids, including ones with hidden cells,
+ * as well as all other types of inputs are processed by the superclass.
+ *
+ * @sa
+ * vtkPVGeometryFilter
+*/
+
+#ifndef vtkPVDataSetSurfaceFilter_h
+#define vtkPVDataSetSurfaceFilter_h
+
+#include "vtkDataSetSurfaceFilter.h"
+#include "vtkPVVTKExtensionsFiltersRenderingModule.h" // needed for export macro
+
+class vtkUnstructuredGrid;
+
+class VTKPVVTKEXTENSIONSFILTERSRENDERING_EXPORT vtkPVDataSetSurfaceFilter
+  : public vtkDataSetSurfaceFilter
+{
+public:
+  static vtkPVDataSetSurfaceFilter* New();
+  vtkTypeMacro(vtkPVDataSetSurfaceFilter, vtkDataSetSurfaceFilter);
+  void PrintSelf(ostream& os, vtkIndent indent) override;
+
+  /**
+   * Extracts the surface of an unstructured grid, using the threaded
+   * implementation when the input supports it.
+   */
+  int UnstructuredGridExecute(vtkDataSet* input, vtkPolyData* output) override;
+
+  /**
+   * Returns true if the threaded implementation can process the input.
+   */
+  static bool IsThreadedExecutionSupported(vtkUnstructuredGrid* input);
+
+protected:
+  vtkPVDataSetSurfaceFilter();
+  ~vtkPVDataSetSurfaceFilter() override;
+
+  int ThreadedUnstructuredGridExecute(vtkUnstructuredGrid* input, vtkPolyData* output);
+
+private:
+  vtkPVDataSetSurfaceFilter(const vtkPVDataSetSurfaceFilter&) = delete;
+  void operator=(const vtkPVDataSetSurfaceFilter&) = delete;
+};
+
+#endif
@@ -51,6 +51,7 @@
 #include "vtkNew.h"
 #include "vtkObjectFactory.h"
 #include "vtkOutlineSource.h"
+#include "vtkPVDataSetSurfaceFilter.h"
 #include "vtkPVRecoverGeometryWireframe.h"
 #include "vtkPVTrivialProducer.h"
 #include "vtkPointData.h"
@@ -58,6 +59,8 @@
 #include "vtkPolygon.h"
 #include "vtkRectilinearGrid.h"
 #include "vtkRectilinearGridOutlineFilter.h"
+#include "vtkSMPThreadLocalObject.h"
+#include "vtkSMPTools.h"
 #include "vtkSelectionNode.h"
 #include "vtkSmartPointer.h"
 #include "vtkStreamingDemandDrivenPipeline.h"
@@ -150,6 +153,75 @@ public:
   int Commutative() override { return 1; }
 };
 
+//----------------------------------------------------------------------------
+// Functor used to extract the surfaces of the leaves of a composite dataset
+// concurrently. Each thread gets its own vtkPVGeometryFilter (and hence its
+// own internal filters) configured like the filter being executed.
+class vtkPVGeometryFilter::ParallelBlockExecutor
+{
+public:
+  vtkPVGeometryFilter* Self;
+  const std::vector<vtkDataObject*>& Blocks;
+  std::vector<vtkSmartPointer<vtkPolyData> >& Outputs;
+  std::vector<int>& OutlineFlags;
+  const int* WholeExtent;
+  vtkSMPThreadLocalObject<vtkPVGeometryFilter> Workers;
+
+  ParallelBlockExecutor(vtkPVGeometryFilter* self, const std::vector<vtkDataObject*>& blocks,
+    std::vector<vtkSmartPointer<vtkPolyData> >& outputs, std::vector<int>& outlineFlags,
+    const int* wholeExtent)
+    : Self(self)
+    , Blocks(blocks)
+    , Outputs(outputs)
+    , OutlineFlags(outlineFlags)
+    , WholeExtent(wholeExtent)
+  {
+  }
+
+  void Initialize()
+  {
+    vtkPVGeometryFilter* self = this->Self;
+    vtkPVGeometryFilter* worker = this->Workers.Local();
+    worker->SetController(self->Controller);
+    worker->UseOutline = self->UseOutline;
+    worker->GenerateFeatureEdges = self->GenerateFeatureEdges;
+    worker->BlockColorsDistinctValues = self->BlockColorsDistinctValues;
+    worker->UseStrips = self->UseStrips;
+    worker->DataSetSurfaceFilter->SetUseStrips(self->UseStrips);
+    worker->GenerateCellNormals = self->GenerateCellNormals;
+    worker->Triangulate = self->Triangulate;
+    worker->SetNonlinearSubdivisionLevel(self->NonlinearSubdivisionLevel);
+    worker->SetPassThroughCellIds(self->PassThroughCellIds);
+    worker->SetPassThroughPointIds(self->PassThroughPointIds);
+    worker->GenerateProcessIds = self->GenerateProcessIds;
+    worker->HideInternalAMRFaces = self->HideInternalAMRFaces;
+    worker->UseNonOverlappingAMRMetaDataForOutlines =
+      self->UseNonOverlappingAMRMetaDataForOutlines;
+  }
+
+  void operator()(vtkIdType begin, vtkIdType end)
+  {
+    vtkPVGeometryFilter* worker = this->Workers.Local();
+    for (vtkIdType cc = begin; cc < end; ++cc)
+    {
+      // the workers abort, and hence their internal filters, along with the
+      // filter being executed. Aborted leaves have no output.
+      worker->SetAbortExecute(this->Self->GetAbortExecute());
+      if (this->Blocks[cc] == nullptr || worker->GetAbortExecute())
+      {
+        continue;
+      }
+      vtkNew<vtkPolyData> tmpOut;
+      worker->ExecuteBlock(this->Blocks[cc], tmpOut, 0, 0, 1, 0, this->WholeExtent);
+      worker->CleanupOutputData(tmpOut, 0);
+      this->Outputs[cc] = tmpOut.Get();
+      this->OutlineFlags[cc] = worker->OutlineFlag;
+    }
+  }
+
+  void Reduce() {}
+};
+
 //----------------------------------------------------------------------------
 vtkPVGeometryFilter::vtkPVGeometryFilter()
 {
@@ -166,7 +238,7 @@ vtkPVGeometryFilter::vtkPVGeometryFilter()
   this->Triangulate = false;
   this->NonlinearSubdivisionLevel = 1;
 
-  this->DataSetSurfaceFilter = vtkDataSetSurfaceFilter::New();
+  this->DataSetSurfaceFilter = vtkPVDataSetSurfaceFilter::New();
   this->GenericGeometryFilter = vtkGenericGeometryFilter::New();
   this->UnstructuredGridGeometryFilter = vtkUnstructuredGridGeometryFilter::New();
   this->RecoverWireframeFilter = vtkPVRecoverGeometryWireframe::New();
@@ -195,6 +267,7 @@ vtkPVGeometryFilter::vtkPVGeometryFilter()
 
   this->HideInternalAMRFaces = true;
   this->UseNonOverlappingAMRMetaDataForOutlines = true;
+  this->ExecuteBlocksInParallel = false;
 }
 
 //----------------------------------------------------------------------------
@@ -946,8 +1019,42 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
 
   int* wholeExtent =
     vtkStreamingDemandDrivenPipeline::GetWholeExtent(inputVector[0]->GetInformationObject(0));
+
+  // When requested, extract all leaves concurrently first. The results are
+  // then added to the output in the traversal order below, exactly like the
+  // serial path does.
+  const bool executeInParallel = this->ExecuteBlocksInParallel && totNumBlocks > 1;
+  std::vector<vtkSmartPointer<vtkPolyData> > parallelOutputs;
+  if (executeInParallel)
+  {
+    std::vector<vtkDataObject*> blocks;
+    blocks.reserve(totNumBlocks);
+    for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+    {
+      blocks.push_back(inIter->GetCurrentDataObject());
+    }
+    parallelOutputs.resize(blocks.size());
+    std::vector<int> outlineFlags(blocks.size(), 0);
+
+    ParallelBlockExecutor executor(this, blocks, parallelOutputs, outlineFlags, wholeExtent);
+    vtkSMPTools::For(0, static_cast<vtkIdType>(blocks.size()), 1, executor);
+
+    // match the serial path, where the last non-null block processed sets the
+    // flag.
+    for (size_t cc = blocks.size(); cc > 0; --cc)
+    {
+      if (blocks[cc - 1] != nullptr)
+      {
+        this->OutlineFlag = outlineFlags[cc - 1];
+        break;
+      }
+    }
+  }
+
   int numInputs = 0;
-  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal(); inIter->GoToNextItem())
+  size_t leafIndex = 0;
+  for (inIter->InitTraversal(); !inIter->IsDoneWithTraversal();
+       inIter->GoToNextItem(), ++leafIndex)
   {
     vtkDataObject* block = inIter->GetCurrentDataObject();
     if (!block)
@@ -955,9 +1062,26 @@ int vtkPVGeometryFilter::RequestDataObjectTree(
       continue;
     }
 
-    vtkPolyData* tmpOut = vtkPolyData::New();
-    this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
-    this->CleanupOutputData(tmpOut, 0);
+    vtkPolyData* tmpOut = nullptr;
+    if (executeInParallel)
+    {
+      tmpOut = parallelOutputs[leafIndex];
+      if (tmpOut)
+      {
+        tmpOut->Register(nullptr);
+        parallelOutputs[leafIndex] = nullptr;
+      }
+      else
+      {
+        tmpOut = vtkPolyData::New();
+      }
+    }
+    else
+    {
+      tmpOut = vtkPolyData::New();
+      this->ExecuteBlock(block, tmpOut, 0, 0, 1, 0, wholeExtent);
+      this->CleanupOutputData(tmpOut, 0);
+    }
     // skip empty nodes.
     if (tmpOut->GetNumberOfPoints() > 0)
     {
@@ -1781,6 +1905,7 @@ void vtkPVGeometryFilter::PrintSelf(ostream& os, vtkIndent indent)
 
   os << indent << "PassThroughCellIds: " << (this->PassThroughCellIds ? "On\n" : "Off\n");
   os << indent << "PassThroughPointIds: " << (this->PassThroughPointIds ? "On\n" : "Off\n");
+  os << indent << "ExecuteBlocksInParallel: " << this->ExecuteBlocksInParallel << endl;
 }
 
 //----------------------------------------------------------------------------
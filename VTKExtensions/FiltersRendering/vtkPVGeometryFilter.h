@@ -207,6 +207,19 @@ public:
   vtkBooleanMacro(UseNonOverlappingAMRMetaDataForOutlines, bool);
   //@}
 
+  //@{
+  /**
+   * When set, leaves of composite (non-AMR) inputs are processed concurrently
+   * using vtkSMPTools, each thread using its own set of internal filters.
+   * Results are assembled in block order, so the output (including the
+   * composite index and block color arrays) is identical to the serial
+   * execution. Off by default.
+   */
+  vtkSetMacro(ExecuteBlocksInParallel, bool);
+  vtkGetMacro(ExecuteBlocksInParallel, bool);
+  vtkBooleanMacro(ExecuteBlocksInParallel, bool);
+  //@}
+
   // These keys are put in the output composite-data metadata for multipieces
   // since this filter merges multipieces together.
   static vtkInformationIntegerVectorKey* POINT_OFFSETS();
@@ -331,6 +344,7 @@ protected:
   bool HideInternalAMRFaces;
   bool UseNonOverlappingAMRMetaDataForOutlines;
   bool GenerateFeatureEdges;
+  bool ExecuteBlocksInParallel;
 
 private:
   vtkPVGeometryFilter(const vtkPVGeometryFilter&) = delete;
@@ -347,6 +361,7 @@ private:
   void AddBlockColors(vtkDataObject* pd, unsigned int index);
   void AddHierarchicalIndex(vtkPolyData* pd, unsigned int level, unsigned int index);
   class BoundsReductionOperation;
+  class ParallelBlockExecutor;
   //@}
 };
 
@@ -30,6 +30,7 @@
 #include "vtkPartitionedDataSetCollection.h"
 #include "vtkPointData.h"
 #include "vtkPoints.h"
+#include "vtkSMPTools.h"
 #include "vtkSelection.h"
 #include "vtkSelectionNode.h"
 #include "vtkSignedCharArray.h"
@@ -418,6 +419,54 @@ public:
       return *this; // Return ref for multiple assignment
     }
   };
+
+  // Order used by the sorted index: values in the requested order, then
+  // original indices. Values are compared as doubles since that is how the
+  // splitters are exchanged between processes.
+  class IndexOrder
+  {
+  public:
+    bool Inverted;
+
+    IndexOrder(bool inverted)
+      : Inverted(inverted)
+    {
+    }
+
+    bool operator()(const SortableArrayItem& a, const SortableArrayItem& b) const
+    {
+      const double aValue = static_cast<double>(a.Value);
+      const double bValue = static_cast<double>(b.Value);
+      if (aValue != bValue)
+      {
+        return this->Inverted ? aValue > bValue : aValue < bValue;
+      }
+      return a.OriginalIndex < b.OriginalIndex;
+    }
+  };
+
+  // Position of a value in the global order, used as splitter between the
+  // buckets of the sorted index.
+  struct IndexKey
+  {
+    double Value;
+    vtkIdType ProcessId;
+    vtkIdType Position; // in the sorted local array
+  };
+
+  static bool KeyLess(const IndexKey& a, const IndexKey& b, bool inverted)
+  {
+    if (a.Value != b.Value)
+    {
+      return inverted ? a.Value > b.Value : a.Value < b.Value;
+    }
+    if (a.ProcessId != b.ProcessId)
+    {
+      return a.ProcessId < b.ProcessId;
+    }
+    return a.Position < b.Position;
+  }
+
   class ArraySorter
   {
   public:
@@ -517,6 +566,44 @@ public:
       }
     }
 
+    // Value to sort for the i-th tuple: the selected component or the
+    // normalized magnitude when selectedComponent < 0.
+    static T GetValue(const T* dataPtr, vtkIdType i, int numComponents, int selectedComponent)
+    {
+      if (selectedComponent < 0 && numComponents > 1)
+      {
+        double value = 0;
+        for (int k = 0; k < numComponents; k++)
+        {
+          const double tmp = static_cast<double>(dataPtr[k + i * numComponents]);
+          value += tmp * tmp;
+        }
+        return static_cast<T>(sqrt(value) / sqrt(static_cast<double>(numComponents)));
+      }
+      return dataPtr[(selectedComponent < 0 ? 0 : selectedComponent) + i * numComponents];
+    }
+
+    // Sort the array using the IndexOrder, without building any histogram.
+    // Filling and sorting the array are done using vtkSMPTools.
+    void Sort(const T* dataPtr, vtkIdType numTuples, int numComponents, int selectedComponent,
+      bool reverseOrder)
+    {
+      // Clear memory if needed
+      this->Clear();
+
+      this->ArraySize = numTuples;
+      this->Array = new SortableArrayItem[this->ArraySize];
+      SortableArrayItem* array = this->Array;
+      vtkSMPTools::For(0, numTuples, [&](vtkIdType begin, vtkIdType end) {
+        for (vtkIdType i = begin; i < end; ++i)
+        {
+          array[i].OriginalIndex = i;
+          array[i].Value = GetValue(dataPtr, i, numComponents, selectedComponent);
+        }
+      });
+      vtkSMPTools::Sort(array, array + numTuples, IndexOrder(reverseOrder));
+    }
+
     void SortProcessId(vtkIdType* dataPtr, vtkIdType numTuples, vtkIdType histogramSize,
       double* scalarRange, bool reverseOrder)
     {
@@ -556,7 +643,6 @@ public:
   {
     // Only used for testing
     this->LocalSorter = 0;
-    this->GlobalHistogram = 0;
     this->Debug = false;
   }
 
@@ -565,6 +651,9 @@ public:
     // Default values
     this->SelectedComponent = 0;
     this->NeedToBuildCache = true;
+    this->Sortable = -1;
+    this->IndexInverted = false;
+    this->GlobalSize = 0;
     this->DataToSort = dataToSort;
 
     this->InputMTime = input->GetMTime();
@@ -581,20 +670,24 @@ public:
 
     // Create internal objects
     this->LocalSorter = new ArraySorter();
-    this->GlobalHistogram = new Histogram(HISTOGRAM_SIZE);
   }
 
   ~Internals() override
   {
     if (this->LocalSorter)
       delete this->LocalSorter;
-    if (this->GlobalHistogram)
-      delete this->GlobalHistogram;
   }
 
   // --------------------------------------------------------------------------
   bool IsSortable() override
   {
+    // The answer only depends on the data, which this object is bound to, and
+    // on the selected component.
+    if (this->Sortable != -1)
+    {
+      return this->Sortable == 1;
+    }
+
     // See if one process is able to sort the table,
     // if not then just say NOT sortable
     int localCanSort = (this->DataToSort == NULL) ? 0 : 1;
@@ -602,6 +695,7 @@ public:
     this->MPI->AllReduce(&localCanSort, &globalCanSort, 1, vtkCommunicator::MAX_OP);
     if (globalCanSort == 0)
     {
+      this->Sortable = 0;
       return false;
     }
 
@@ -652,18 +746,16 @@ public:
     this->CommonRange[0] -= FLT_EPSILON;
     this->CommonRange[1] += FLT_EPSILON;
 
+    this->Sortable = sortable ? 1 : 0;
     return sortable;
   }
 
   // --------------------------------------------------------------------------
-  int BuildCache(bool sortableArray, bool invertOrder)
+  int BuildCache(bool sortableArray, bool invertOrder, vtkIdType blockSize)
   {
     // We are building the cache so no need to build it next time
     this->NeedToBuildCache = false;
 
-    // Communication buffer
-    vtkIdType* bufferHistogramValues = new vtkIdType[this->NumProcs * HISTOGRAM_SIZE];
-
     // Is there something to sort ???
     if (!sortableArray)
     {
@@ -672,45 +764,133 @@ public:
       {
         this->LocalSorter->FillArray(this->DataToSort->GetNumberOfTuples());
       }
+      return 1;
+    }
+
+    this->BuildSortedIndex(invertOrder, blockSize);
+    return 1;
+  }
+
+  // --------------------------------------------------------------------------
+  // Sort the local array and build the index of a distributed sample sort.
+  // The global order is split in buckets using splitters picked from a
+  // regular sample of every sorted local array. Since each process knows
+  // where the buckets start in its own array and, once the local bucket
+  // sizes are summed, where they start in the global order, any block can
+  // then be served by only sending the buckets overlapping it to the merging
+  // process. This is done once for a given data, column and order.
+  void BuildSortedIndex(bool invertOrder, vtkIdType blockSize)
+  {
+    this->IndexInverted = invertOrder;
+
+    vtkIdType localSize = 0;
+    if (this->DataToSort)
+    {
+      localSize = this->DataToSort->GetNumberOfTuples();
+      this->LocalSorter->Sort(static_cast<T*>(this->DataToSort->GetVoidPointer(0)), localSize,
+        this->DataToSort->GetNumberOfComponents(), this->SelectedComponent, invertOrder);
     }
     else
     {
-      if (this->DataToSort)
-      {
-        // Sort and build local histogram
-        this->LocalSorter->Update(static_cast<T*>(this->DataToSort->GetVoidPointer(0)),
-          this->DataToSort->GetNumberOfTuples(), this->DataToSort->GetNumberOfComponents(),
-          this->SelectedComponent, HISTOGRAM_SIZE, this->CommonRange, invertOrder);
-      }
-      else
+      this->LocalSorter->Clear();
+    }
+    this->MPI->AllReduce(&localSize, &this->GlobalSize, 1, vtkCommunicator::SUM_OP);
+
+    // Aim for buckets of about a block.
+    blockSize = std::max(blockSize, static_cast<vtkIdType>(1));
+    const vtkIdType nbBuckets = std::max(static_cast<vtkIdType>(1),
+      std::min(this->GlobalSize / blockSize, static_cast<vtkIdType>(MAX_NUMBER_OF_BUCKETS)));
+
+    // Sample the local sorted array proportionally to its size
+    std::vector<IndexKey> samples;
+    if (localSize > 0)
+    {
+      vtkIdType nbSamples =
+        (SAMPLING_RATIO * nbBuckets * localSize + this->GlobalSize - 1) / this->GlobalSize;
+      nbSamples = std::min(std::max(nbSamples, static_cast<vtkIdType>(1)), localSize);
+      samples.resize(nbSamples);
+      for (vtkIdType cc = 0; cc < nbSamples; ++cc)
       {
-        // Build empty local histogram
-        this->LocalSorter->Clear();
-        this->LocalSorter->Histo = new Histogram(HISTOGRAM_SIZE);
-        this->LocalSorter->Histo->SetScalarRange(this->CommonRange);
-        this->LocalSorter->Histo->Inverted = invertOrder;
+        samples[cc] = this->GetKey((cc * localSize) / nbSamples);
       }
+    }
 
-      // Initialize the global histogram with same range
-      this->LocalSorter->Histo->CopyRangeTo(*this->GlobalHistogram);
+    // Share the samples with everybody
+    const vtkIdType sendLength = static_cast<vtkIdType>(samples.size() * sizeof(IndexKey));
+    std::vector<vtkIdType> recvLengths(this->NumProcs);
+    std::vector<vtkIdType> offsets(this->NumProcs);
+    this->MPI->AllGather(&sendLength, &recvLengths[0], 1);
+    vtkIdType totalLength = 0;
+    for (int i = 0; i < this->NumProcs; ++i)
+    {
+      offsets[i] = totalLength;
+      totalLength += recvLengths[i];
+    }
+    std::vector<IndexKey> allSamples(totalLength / sizeof(IndexKey) + 1);
+    this->MPI->AllGatherV(reinterpret_cast<const char*>(samples.empty() ? nullptr : &samples[0]),
+      reinterpret_cast<char*>(&allSamples[0]), sendLength, &recvLengths[0], &offsets[0]);
+    allSamples.resize(totalLength / sizeof(IndexKey));
 
-      // Make sure that the global histogram is properly initialized
-      this->GlobalHistogram->ClearHistogramValues();
-      this->GlobalHistogram->Inverted = invertOrder;
+    // Every process sorts the same samples, hence agrees on the splitters
+    std::sort(allSamples.begin(), allSamples.end(),
+      [invertOrder](const IndexKey& a, const IndexKey& b) { return KeyLess(a, b, invertOrder); });
 
-      // Send local histogram and receive every histogram from everybody
-      this->MPI->AllGather(this->LocalSorter->Histo->Values, bufferHistogramValues, HISTOGRAM_SIZE);
+    // Locate the buckets in the local sorted array
+    this->LocalBucketOffsets.assign(nbBuckets + 1, 0);
+    this->LocalBucketOffsets[nbBuckets] = localSize;
+    const vtkIdType nbAllSamples = static_cast<vtkIdType>(allSamples.size());
+    for (vtkIdType cc = 1; cc < nbBuckets && nbAllSamples > 0; ++cc)
+    {
+      this->LocalBucketOffsets[cc] =
+        this->LowerBound(allSamples[(cc * nbAllSamples) / nbBuckets], invertOrder);
+    }
 
-      // Merge all histogram into the GlobalHistogram
-      for (int idx = 0, nb = this->NumProcs * HISTOGRAM_SIZE; idx < nb; ++idx)
+    // Sum the bucket sizes to locate them in the global order
+    std::vector<vtkIdType> localCounts(nbBuckets);
+    std::vector<vtkIdType> globalCounts(nbBuckets);
+    for (vtkIdType cc = 0; cc < nbBuckets; ++cc)
+    {
+      localCounts[cc] = this->LocalBucketOffsets[cc + 1] - this->LocalBucketOffsets[cc];
+    }
+    this->MPI->AllReduce(&localCounts[0], &globalCounts[0], nbBuckets, vtkCommunicator::SUM_OP);
+    this->GlobalBucketOffsets.assign(nbBuckets + 1, 0);
+    for (vtkIdType cc = 0; cc < nbBuckets; ++cc)
+    {
+      this->GlobalBucketOffsets[cc + 1] = this->GlobalBucketOffsets[cc] + globalCounts[cc];
+    }
+  }
+
+  // --------------------------------------------------------------------------
+  IndexKey GetKey(vtkIdType position) const
+  {
+    IndexKey key;
+    key.Value = static_cast<double>(this->LocalSorter->Array[position].Value);
+    key.ProcessId = this->Me;
+    key.Position = position;
+    return key;
+  }
+
+  // --------------------------------------------------------------------------
+  // Number of elements of the local sorted array that come before the given
+  // key in the global order.
+  vtkIdType LowerBound(const IndexKey& key, bool inverted) const
+  {
+    vtkIdType first = 0;
+    vtkIdType count = this->LocalSorter->ArraySize;
+    while (count > 0)
+    {
+      const vtkIdType step = count / 2;
+      if (KeyLess(this->GetKey(first + step), key, inverted))
+      {
+        first += step + 1;
+        count -= step + 1;
+      }
+      else
       {
-        this->GlobalHistogram->TotalValues += bufferHistogramValues[idx];
-        this->GlobalHistogram->Values[idx % HISTOGRAM_SIZE] += bufferHistogramValues[idx];
+        count = step;
       }
     }
-
-    delete[] bufferHistogramValues;
-    return 1;
+    return first;
   }
 
   // --------------------------------------------------------------------------
@@ -725,7 +905,7 @@ public:
     // ------------------------------------------------------------------------
     if (this->NeedToBuildCache)
     {
-      this->BuildCache(false, revertOrder);
+      this->BuildCache(false, revertOrder, blockSize);
     }
 
     // Build empty local table with empty arrays so they stay in the same order
@@ -852,39 +1032,35 @@ public:
     bool revertOrder) override
   {
     // ------------------------------------------------------------------------
-    // Make sure that the Cache is built
+    // Make sure that the sorted index is built
     //    This will sort the local array, that's why we don't want to do it
     //    at each execution. Specially when we only change the requested block.
     // ------------------------------------------------------------------------
-    if (this->NeedToBuildCache)
+    if (this->NeedToBuildCache || this->GlobalBucketOffsets.empty() ||
+      this->IndexInverted != revertOrder)
     {
-      this->BuildCache(true, revertOrder);
+      this->BuildCache(true, revertOrder, blockSize);
     }
 
     // ------------------------------------------------------------------------
-    // Search for lower bound
+    // Find the buckets overlapping the requested block
     // ------------------------------------------------------------------------
+    const vtkIdType first = std::min(block * blockSize, this->GlobalSize);
+    const vtkIdType last = std::min(first + blockSize, this->GlobalSize);
     vtkIdType nbElementsToRemoveFromHead = 0;
     vtkIdType localOffset = 0;
-    vtkIdType nbElementsInBar = 0;
-    this->SearchGlobalIndexLocation((block * blockSize), this->LocalSorter->Histo,
-      this->GlobalHistogram, nbElementsToRemoveFromHead, localOffset, nbElementsInBar);
-
-    // ------------------------------------------------------------------------
-    // Search for upper bound
-    // ------------------------------------------------------------------------
-    vtkIdType upperOffset = 0;
-    vtkIdType globalUpperOffset = 0;
-    vtkIdType searchIdx = (this->GlobalHistogram->TotalValues < (block + 1) * blockSize)
-      ? this->GlobalHistogram->TotalValues
-      : ((block + 1) * blockSize);
-    searchIdx--; // It is not a size it is an index (so -1)
-
-    this->SearchGlobalIndexLocation(searchIdx, this->LocalSorter->Histo, this->GlobalHistogram,
-      globalUpperOffset, upperOffset, nbElementsInBar);
-
-    // We have to include our searched index (so +1)
-    vtkIdType localSize = (upperOffset + nbElementsInBar) - localOffset + 1;
+    vtkIdType localSize = 0;
+    if (first < last)
+    {
+      const auto& offsets = this->GlobalBucketOffsets;
+      const size_t firstBucket =
+        std::upper_bound(offsets.begin(), offsets.end(), first) - offsets.begin() - 1;
+      const size_t lastBucket =
+        std::lower_bound(offsets.begin(), offsets.end(), last) - offsets.begin();
+      nbElementsToRemoveFromHead = first - offsets[firstBucket];
+      localOffset = this->LocalBucketOffsets[firstBucket];
+      localSize = this->LocalBucketOffsets[lastBucket] - localOffset;
+    }
 
     // ------------------------------------------------------------------------
     // Build local subset table
@@ -898,149 +1074,76 @@ public:
     // ------------------------------------------------------------------------
     int mergePid = GetMergingProcessId(localSubset.GetPointer());
 
-    // ------------------------------------------------------------------------
-    // Add local meta-data in case of merge process
-    // ------------------------------------------------------------------------
-    if (this->NumProcs > 1 && this->Me == mergePid)
-    {
-      vtkSmartPointer<vtkIdTypeArray> processIdArray = vtkSmartPointer<vtkIdTypeArray>::New();
-      processIdArray->SetName("vtkOriginalProcessIds");
-      processIdArray->SetNumberOfComponents(1);
-      processIdArray->Allocate((blockSize < localSize) ? localSize : blockSize);
-      for (vtkIdType idx = 0; idx < localSubset->GetNumberOfRows(); idx++)
-      {
-        processIdArray->InsertNextTuple1(mergePid);
-      }
-      localSubset->GetRowData()->AddArray(processIdArray);
-    }
-
     // ------------------------------------------------------------------------
     // Send local subset array to process mergePid
     // ------------------------------------------------------------------------
     if (this->Me != mergePid)
     {
       this->MPI->Send(localSubset.GetPointer(), mergePid, VTK_TABLE_EXCHANGE_TAG);
+
+      // Ask other processes to provide metadata for table decoration
+      this->DecorateTable(input, NULL, mergePid);
+      return 1;
     }
 
     // ------------------------------------------------------------------------
     // Merging procedure only on process mergePid
+    //    Subsets are merged in process order so that, once sorted by value
+    //    then by row, rows follow the global order used by the index.
     // ------------------------------------------------------------------------
-    if (this->Me == mergePid)
+    vtkSmartPointer<vtkTable> mergedSubset;
+    mergedSubset.TakeReference(this->NewSubsetTable(localSubset, NULL, 0, 0));
+    if (this->NumProcs > 1)
     {
-      vtkSmartPointer<vtkTable> tmp = vtkSmartPointer<vtkTable>::New();
-      for (int i = 0; i < this->NumProcs; i++)
-      {
-        if (i == mergePid)
-          continue;
-
-        this->MPI->Receive(tmp.GetPointer(), i, VTK_TABLE_EXCHANGE_TAG);
-        this->MergeTable(i, tmp.GetPointer(), localSubset.GetPointer(), blockSize);
-      }
-
-      // Sort new table/array
-      if (!this->DataToSort)
-      {
-        // This mean that no output can be provided
-        // cout << "ERROR the merge process have no DataArray." << endl;
-        return 1;
-      }
-      vtkDataArray* subsetArray =
-        vtkDataArray::SafeDownCast(localSubset->GetColumnByName(this->DataToSort->GetName()));
+      vtkSmartPointer<vtkIdTypeArray> processIdArray = vtkSmartPointer<vtkIdTypeArray>::New();
+      processIdArray->SetName("vtkOriginalProcessIds");
+      processIdArray->SetNumberOfComponents(1);
+      processIdArray->Allocate((blockSize < localSize) ? localSize : blockSize);
+      mergedSubset->GetRowData()->AddArray(processIdArray);
+    }
 
-      if (!subsetArray)
+    vtkSmartPointer<vtkTable> tmp = vtkSmartPointer<vtkTable>::New();
+    for (int i = 0; i < this->NumProcs; i++)
+    {
+      if (i == mergePid)
       {
-        vtkSortedTableStreamer::PrintInfo(localSubset.GetPointer());
+        this->MergeTable(i, localSubset, mergedSubset, blockSize);
+        continue;
       }
 
-      ArraySorter sorter;
-      sorter.Update(static_cast<T*>(subsetArray->GetVoidPointer(0)),
-        subsetArray->GetNumberOfTuples(), subsetArray->GetNumberOfComponents(),
-        this->SelectedComponent, HISTOGRAM_SIZE, this->CommonRange, revertOrder);
-
-      // trim it (remove head and tail that don't belong to the result)
-      localSubset.TakeReference(this->NewSubsetTable(
-        localSubset.GetPointer(), &sorter, nbElementsToRemoveFromHead, blockSize));
-
-      // Add extra information such as structured indices, block number...
-      this->DecorateTable(input, localSubset.GetPointer(), mergePid);
-
-      // ShallowCopy it to the output
-      output->ShallowCopy(localSubset.GetPointer());
+      this->MPI->Receive(tmp.GetPointer(), i, VTK_TABLE_EXCHANGE_TAG);
+      this->MergeTable(i, tmp.GetPointer(), mergedSubset.GetPointer(), blockSize);
     }
-    else
-    {
-      // Ask other processes to provide metadata for table decoration
-      this->DecorateTable(input, NULL, mergePid);
-    }
-
-    return 1;
-  }
-
-  // --------------------------------------------------------------------------
-  // nbGlobalToSkip is the number of elements that should be skipped at the end
-  // if you exactly want to reach the searchedGlobalIndex.
-  // localOffset is the corresponding local index in the sorted table to the
-  // global index of (searchedGlobalIndex - nbGlobalToSkip)
-  // nbInLocalBar is the local number of elements that are available
-  // in the histogram bar where the searchedGlobalIndex has been found.
-  // nbInLocalBar is used when you want to get an upper bound that
-  // will include the searchedGlobalIndex.
-  void SearchGlobalIndexLocation(vtkIdType searchedGlobalIndex, Histogram* localHistogram,
-    Histogram* globalHistogram, vtkIdType& nbGlobalToSkip, vtkIdType& localOffset,
-    vtkIdType& nbInLocalBar)
-  {
-    // Communication buffer
-    vtkIdType* bufferHistogramValues = new vtkIdType[this->NumProcs * HISTOGRAM_SIZE];
 
-    // Local internal working var
-    vtkIdType histogramBarIdx = -1;
-    double currentRange[2];
-    vtkIdType idx, idxEnd;
-
-    // Setup initial histogram range and values
-    Histogram _globalHistogram;
-    Histogram _localHistogram;
-    localHistogram->CopyTo(_localHistogram);
-    globalHistogram->CopyTo(_globalHistogram);
-
-    // Reset local offsets
-    localOffset = 0;
-    nbGlobalToSkip = searchedGlobalIndex;
-
-    do
+    // Sort new table/array
+    vtkDataArray* subsetArray = this->DataToSort
+      ? vtkDataArray::SafeDownCast(mergedSubset->GetColumnByName(this->DataToSort->GetName()))
+      : NULL;
+    if (!subsetArray)
     {
-      nbGlobalToSkip -= _globalHistogram.GetNewRange(nbGlobalToSkip, histogramBarIdx, currentRange);
-
-      localOffset += _localHistogram.GetNumberOfElements(0, histogramBarIdx);
-      nbInLocalBar = _localHistogram.GetNumberOfElements(histogramBarIdx, histogramBarIdx + 1);
-
-      // Based on a narrowed range, build local histogram to get closer to the
-      // real index of the object
-      _localHistogram.SetScalarRange(currentRange);
-      _localHistogram.ClearHistogramValues();
-
-      idxEnd = localOffset + nbInLocalBar;
-      for (idx = localOffset; idx < idxEnd; ++idx)
+      // This mean that no output can be provided
+      if (this->DataToSort)
       {
-        _localHistogram.AddValue(this->LocalSorter->Array[idx].Value);
+        vtkSortedTableStreamer::PrintInfo(mergedSubset.GetPointer());
       }
+      this->DecorateTable(input, NULL, mergePid);
+      return 1;
+    }
 
-      // Exchange local histo with everyone
-      this->MPI->AllGather(_localHistogram.Values, bufferHistogramValues, HISTOGRAM_SIZE);
+    ArraySorter sorter;
+    sorter.Sort(static_cast<T*>(subsetArray->GetVoidPointer(0)), subsetArray->GetNumberOfTuples(),
+      subsetArray->GetNumberOfComponents(), this->SelectedComponent, revertOrder);
 
-      // Build global histogram
-      _globalHistogram.SetScalarRange(currentRange);
-      _globalHistogram.ClearHistogramValues();
+    // trim it (remove head and tail that don't belong to the result)
+    mergedSubset.TakeReference(this->NewSubsetTable(
+      mergedSubset.GetPointer(), &sorter, nbElementsToRemoveFromHead, last - first));
 
-      idxEnd = this->NumProcs * HISTOGRAM_SIZE;
-      for (idx = 0; idx < idxEnd; ++idx)
-      {
-        _globalHistogram.TotalValues += bufferHistogramValues[idx];
-        _globalHistogram.Values[idx % HISTOGRAM_SIZE] += bufferHistogramValues[idx];
-      }
-    } while (nbGlobalToSkip > 0 && _globalHistogram.CanBeReduced());
+    // Add extra information such as structured indices, block number...
+    this->DecorateTable(input, mergedSubset.GetPointer(), mergePid);
 
-    delete[] bufferHistogramValues;
+    // ShallowCopy it to the output
+    output->ShallowCopy(mergedSubset.GetPointer());
+    return 1;
   }
 
   // --------------------------------------------------------------------------
@@ -1106,7 +1209,11 @@ public:
   }
 
   // --------------------------------------------------------------------------
-  void InvalidateCache() override { this->NeedToBuildCache = true; }
+  void InvalidateCache() override
+  {
+    this->NeedToBuildCache = true;
+    this->Sortable = -1;
+  }
 
   // --------------------------------------------------------------------------
   bool IsInvalid(vtkTable* input, vtkDataArray* dataToProcess) override
@@ -1309,7 +1416,6 @@ private:
   vtkMTimeType DataMTime;     // Keep the original data MTime
   vtkDataArray* DataToSort;   // DataArray to sort
   ArraySorter* LocalSorter;   // Local ArraySorter based on global range
-  Histogram* GlobalHistogram; // Globaly merged Histogram based on global range
   double CommonRange[2];      // Scalar range used across processes
   int Me;                     // Current process ID
   int NumProcs;               // Number of processes involved
@@ -1317,6 +1423,13 @@ private:
   int SelectedComponent;      // Component used to sort array
   bool NeedToBuildCache;
   bool Debug;
+  int Sortable; // Cached result of IsSortable(), -1 when unknown
+
+  // Sorted index, see BuildSortedIndex()
+  bool IndexInverted;
+  vtkIdType GlobalSize;
+  std::vector<vtkIdType> LocalBucketOffsets;
+  std::vector<vtkIdType> GlobalBucketOffsets;
 
   const static int VTK_TABLE_EXCHANGE_TAG = 50;
   // HISTOGRAM_SIZE could be computed dynamically based on the type of the
@@ -1326,6 +1439,10 @@ private:
   // Maybe make some test on huge cluster to see which histogram size is
   // the best.
   const static int HISTOGRAM_SIZE = 256;
+  // Upper bound on the number of buckets of the sorted index and number of
+  // samples taken per bucket to choose the splitters.
+  const static int MAX_NUMBER_OF_BUCKETS = 16384;
+  const static int SAMPLING_RATIO = 4;
 };
 //****************************************************************************
 vtkStandardNewMacro(vtkSortedTableStreamer);
@@ -1342,6 +1459,7 @@ vtkSortedTableStreamer::vtkSortedTableStreamer()
   this->BlockSize = 1024;
   this->Internal = 0;
   this->SelectedComponent = 0;
+  this->MergedInputMTime = 0;
   this->SetController(vtkMultiProcessController::GetGlobalController());
 }
 
@@ -1545,8 +1663,15 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
 
   bool orderInverted = this->InvertOrder > 0;
 
-  // Convert a composite dataset into a vtkTable input.
-  if (auto inputCD = vtkCompositeDataSet::SafeDownCast(inputDO))
+  // Convert a composite dataset into a vtkTable input. The result is kept
+  // until the input changes, so that the sorted index built for it remains
+  // valid when only the requested block changes.
+  auto inputCD = vtkCompositeDataSet::SafeDownCast(inputDO);
+  if (inputCD && this->MergedInput && this->MergedInputMTime == inputCD->GetMTime())
+  {
+    input = this->MergedInput;
+  }
+  else if (inputCD)
   {
     input = this->MergeBlocks(inputCD);
     if (input->GetColumnByName("vtkCompositeIndexArray") == nullptr)
@@ -1564,6 +1689,12 @@ int vtkSortedTableStreamer::RequestData(vtkInformation* vtkNotUsed(request),
         input->GetFieldData()->AddArray(array_pair.first);
       }
     }
+    this->MergedInput = input;
+    this->MergedInputMTime = inputCD->GetMTime();
+  }
+  else
+  {
+    this->MergedInput = nullptr;
   }
 
   // Get input data
@@ -20,6 +20,11 @@
  * This filter is used quickly get a sorted subset of a given vtkTable.
  * By sorted we mean a subset build from a global sort even if some optimisation
  * allow us to skip a global table sorting.
+ *
+ * The first request for a given input, column and order sorts the local
+ * tables and builds a distributed index of the global order (see the
+ * internal BuildSortedIndex()). Requests for other blocks reuse it and only
+ * exchange the rows of the requested block, plus a few neighbors.
 */
 
 #ifndef vtkSortedTableStreamer_h
@@ -142,6 +147,11 @@ private:
     vtkCompositeDataSet* cd, vtkIdType maxSize);
   std::pair<vtkSmartPointer<vtkStringArray>, vtkSmartPointer<vtkIdTypeArray> >
   GenerateBlockNameArray(vtkCompositeDataSet* cd, vtkIdType maxSize);
+
+  // Composite input merged into a single table, and the MTime of the
+  // composite input it was built from.
+  vtkSmartPointer<vtkTable> MergedInput;
+  vtkMTimeType MergedInputMTime;
 };
 
 #endif
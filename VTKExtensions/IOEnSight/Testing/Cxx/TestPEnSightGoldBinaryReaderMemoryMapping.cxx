@@ -0,0 +1,222 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPEnSightGoldBinaryReaderMemoryMapping.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Writes an EnSight Gold C binary case made of a hexahedral grid with a point
+// scalar, reads it with and without memory mapping and checks both outputs
+// match. The timings of both reads are reported; the size of the grid can be
+// given as argument to benchmark larger cases.
+
+#include "vtkDataArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkPEnSightGoldBinaryReader.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkTimerLog.h"
+#include "vtkUnstructuredGrid.h"
+
+#include "vtksys/FStream.hxx"
+
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+void WriteString(ostream& os, const char* str)
+{
+  char line[80];
+  memset(line, ' ', 80);
+  memcpy(line, str, strlen(str));
+  os.write(line, 80);
+}
+
+void WriteInt(ostream& os, int value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(int));
+}
+
+template <typename T>
+void WriteArray(ostream& os, const std::vector<T>& values)
+{
+  os.write(reinterpret_cast<const char*>(values.data()), sizeof(T) * values.size());
+}
+
+bool WriteCase(const std::string& dir, int dim)
+{
+  const int np = dim + 1;
+  const int numPts = np * np * np;
+  std::vector<float> x(numPts), y(numPts), z(numPts), pressure(numPts);
+  for (int k = 0, id = 0; k < np; ++k)
+  {
+    for (int j = 0; j < np; ++j)
+    {
+      for (int i = 0; i < np; ++i, ++id)
+      {
+        x[id] = static_cast<float>(i);
+        y[id] = static_cast<float>(j);
+        z[id] = static_cast<float>(k);
+        pressure[id] = static_cast<float>(i * j + k);
+      }
+    }
+  }
+  std::vector<int> connectivity;
+  connectivity.reserve(8 * static_cast<size_t>(dim) * dim * dim);
+  const int corners[8][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 }, { 0, 0, 1 },
+    { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } };
+  for (int k = 0; k < dim; ++k)
+  {
+    for (int j = 0; j < dim; ++j)
+    {
+      for (int i = 0; i < dim; ++i)
+      {
+        for (int c = 0; c < 8; ++c)
+        {
+          // EnSight ids are one based.
+          connectivity.push_back(
+            1 + (i + corners[c][0]) + np * ((j + corners[c][1]) + np * (k + corners[c][2])));
+        }
+      }
+    }
+  }
+
+  vtksys::ofstream geo((dir + "/mapping.geo").c_str(), ios::out | ios::binary);
+  WriteString(geo, "C Binary");
+  WriteString(geo, "Memory mapping test");
+  WriteString(geo, "Hexahedral grid");
+  WriteString(geo, "node id off");
+  WriteString(geo, "element id off");
+  WriteString(geo, "part");
+  WriteInt(geo, 1);
+  WriteString(geo, "grid");
+  WriteString(geo, "coordinates");
+  WriteInt(geo, numPts);
+  WriteArray(geo, x);
+  WriteArray(geo, y);
+  WriteArray(geo, z);
+  WriteString(geo, "hexa8");
+  WriteInt(geo, dim * dim * dim);
+  WriteArray(geo, connectivity);
+  geo.close();
+
+  vtksys::ofstream var((dir + "/mapping.pressure").c_str(), ios::out | ios::binary);
+  WriteString(var, "pressure");
+  WriteString(var, "part");
+  WriteInt(var, 1);
+  WriteString(var, "coordinates");
+  WriteArray(var, pressure);
+  var.close();
+
+  vtksys::ofstream caseFile((dir + "/mapping.case").c_str(), ios::out);
+  caseFile << "FORMAT\n"
+           << "type: ensight gold\n\n"
+           << "GEOMETRY\n"
+           << "model: mapping.geo\n\n"
+           << "VARIABLE\n"
+           << "scalar per node: pressure mapping.pressure\n";
+  caseFile.close();
+  return !geo.fail() && !var.fail() && !caseFile.fail();
+}
+
+vtkUnstructuredGrid* Read(
+  vtkPEnSightGoldBinaryReader* reader, const std::string& dir, bool mapping, double& time)
+{
+  reader->SetFilePath(dir.c_str());
+  reader->SetCaseFileName("mapping.case");
+  reader->SetByteOrder(vtkPEnSightGoldBinaryReader::FILE_UNKNOWN_ENDIAN);
+  reader->SetUseMemoryMapping(mapping);
+  vtkNew<vtkTimerLog> timer;
+  timer->StartTimer();
+  reader->Update();
+  timer->StopTimer();
+  time = timer->GetElapsedTime();
+  return vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()->GetBlock(0));
+}
+
+bool Equal(vtkDataArray* a1, vtkDataArray* a2)
+{
+  if (!a1 || !a2 || a1->GetNumberOfTuples() != a2->GetNumberOfTuples() ||
+    a1->GetNumberOfComponents() != a2->GetNumberOfComponents())
+  {
+    return false;
+  }
+  const int nc = a1->GetNumberOfComponents();
+  for (vtkIdType i = 0; i < a1->GetNumberOfTuples(); ++i)
+  {
+    for (int c = 0; c < nc; ++c)
+    {
+      if (a1->GetComponent(i, c) != a2->GetComponent(i, c))
+      {
+        return false;
+      }
+    }
+  }
+  return true;
+}
+}
+
+int TestPEnSightGoldBinaryReaderMemoryMapping(int argc, char* argv[])
+{
+  int dim = 64;
+  for (int cc = 1; cc < argc - 1; ++cc)
+  {
+    if (strcmp(argv[cc], "--dimension") == 0)
+    {
+      dim = atoi(argv[cc + 1]);
+    }
+  }
+
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return EXIT_FAILURE;
+  }
+  std::string dir = tempDir;
+  delete[] tempDir;
+
+  if (!WriteCase(dir, dim))
+  {
+    cerr << "ERROR: could not write the case in " << dir << endl;
+    return EXIT_FAILURE;
+  }
+
+  double streamTime, mappedTime;
+  vtkNew<vtkPEnSightGoldBinaryReader> streamReader;
+  vtkUnstructuredGrid* expected = Read(streamReader, dir, false, streamTime);
+  vtkNew<vtkPEnSightGoldBinaryReader> mappedReader;
+  vtkUnstructuredGrid* result = Read(mappedReader, dir, true, mappedTime);
+
+  cout << dim * dim * dim << " hexahedra: stream read " << streamTime << "s, mapped read "
+       << mappedTime << "s" << endl;
+
+  if (!expected || !result || expected->GetNumberOfCells() != dim * dim * dim)
+  {
+    cerr << "ERROR: the grid was not read." << endl;
+    return EXIT_FAILURE;
+  }
+  if (result->GetNumberOfPoints() != expected->GetNumberOfPoints() ||
+    result->GetNumberOfCells() != expected->GetNumberOfCells() ||
+    !Equal(result->GetPoints()->GetData(), expected->GetPoints()->GetData()) ||
+    !Equal(result->GetPointData()->GetArray("pressure"),
+      expected->GetPointData()->GetArray("pressure")))
+  {
+    cerr << "ERROR: the memory mapped read differs from the stream read." << endl;
+    return EXIT_FAILURE;
+  }
+  return EXIT_SUCCESS;
+}
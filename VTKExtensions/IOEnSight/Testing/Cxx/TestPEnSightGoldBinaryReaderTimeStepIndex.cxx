@@ -0,0 +1,329 @@
+/*=========================================================================
+
+  Program:   ParaView
+  Module:    TestPEnSightGoldBinaryReaderTimeStepIndex.cxx
+
+  Copyright (c) Kitware, Inc.
+  All rights reserved.
+  See Copyright.txt or http://www.paraview.org/HTML/Copyright.html for details.
+
+     This software is distributed WITHOUT ANY WARRANTY; without even
+     the implied warranty of MERCHANTABILITY or FITNESS FOR A PARTICULAR
+     PURPOSE.  See the above copyright notice for more information.
+
+=========================================================================*/
+// Writes an EnSight Gold C binary case whose geometry and variable files hold
+// all the time steps, and checks that reading the time steps out of order
+// gives the same results with and without the time step index, including when
+// the index is persisted and loaded back by another reader. Also checks that
+// the index is only built up to the requested time step when not persisted,
+// and that a stale persisted index with a matching file size and modification
+// time is ignored.
+
+#include "vtkDataArray.h"
+#include "vtkMultiBlockDataSet.h"
+#include "vtkNew.h"
+#include "vtkObjectFactory.h"
+#include "vtkPEnSightGoldBinaryReader.h"
+#include "vtkPointData.h"
+#include "vtkPoints.h"
+#include "vtkTestUtilities.h"
+#include "vtkUnstructuredGrid.h"
+
+#include "vtksys/FStream.hxx"
+#include "vtksys/SystemTools.hxx"
+
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+const int NumberOfSteps = 4;
+const int Dimension = 8;
+
+// Gives access to the time step offsets known by the reader.
+class vtkIndexingReader : public vtkPEnSightGoldBinaryReader
+{
+public:
+  static vtkIndexingReader* New();
+  vtkTypeMacro(vtkIndexingReader, vtkPEnSightGoldBinaryReader);
+
+  size_t GetNumberOfKnownTimeSteps(const char* fileName)
+  {
+    auto iter = this->FileOffsets.find(fileName);
+    return iter != this->FileOffsets.end() ? iter->second.size() : 0;
+  }
+
+protected:
+  vtkIndexingReader() = default;
+
+private:
+  vtkIndexingReader(const vtkIndexingReader&) = delete;
+  void operator=(const vtkIndexingReader&) = delete;
+};
+vtkStandardNewMacro(vtkIndexingReader);
+
+void WriteString(ostream& os, const char* str)
+{
+  char line[80];
+  memset(line, ' ', 80);
+  memcpy(line, str, strlen(str));
+  os.write(line, 80);
+}
+
+void WriteInt(ostream& os, int value)
+{
+  os.write(reinterpret_cast<const char*>(&value), sizeof(int));
+}
+
+template <typename T>
+void WriteArray(ostream& os, const std::vector<T>& values)
+{
+  os.write(reinterpret_cast<const char*>(values.data()), sizeof(T) * values.size());
+}
+
+// Each time step moves the grid and changes the values of the scalar.
+bool WriteCase(const std::string& dir)
+{
+  const int np = Dimension + 1;
+  const int numPts = np * np * np;
+  std::vector<int> connectivity;
+  for (int k = 0; k < Dimension; ++k)
+  {
+    for (int j = 0; j < Dimension; ++j)
+    {
+      for (int i = 0; i < Dimension; ++i)
+      {
+        const int corners[8][3] = { { 0, 0, 0 }, { 1, 0, 0 }, { 1, 1, 0 }, { 0, 1, 0 },
+          { 0, 0, 1 }, { 1, 0, 1 }, { 1, 1, 1 }, { 0, 1, 1 } };
+        for (int c = 0; c < 8; ++c)
+        {
+          connectivity.push_back(
+            1 + (i + corners[c][0]) + np * ((j + corners[c][1]) + np * (k + corners[c][2])));
+        }
+      }
+    }
+  }
+
+  vtksys::ofstream geo((dir + "/index.geo").c_str(), ios::out | ios::binary);
+  vtksys::ofstream var((dir + "/index.pressure").c_str(), ios::out | ios::binary);
+  WriteString(geo, "C Binary");
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    std::vector<float> x(numPts), y(numPts), z(numPts), pressure(numPts);
+    for (int k = 0, id = 0; k < np; ++k)
+    {
+      for (int j = 0; j < np; ++j)
+      {
+        for (int i = 0; i < np; ++i, ++id)
+        {
+          x[id] = static_cast<float>(i + step);
+          y[id] = static_cast<float>(j);
+          z[id] = static_cast<float>(k);
+          pressure[id] = static_cast<float>(1000 * step + id);
+        }
+      }
+    }
+
+    WriteString(geo, "BEGIN TIME STEP");
+    WriteString(geo, "Time step index test");
+    WriteString(geo, "Moving hexahedral grid");
+    WriteString(geo, "node id off");
+    WriteString(geo, "element id off");
+    WriteString(geo, "part");
+    WriteInt(geo, 1);
+    WriteString(geo, "grid");
+    WriteString(geo, "coordinates");
+    WriteInt(geo, numPts);
+    WriteArray(geo, x);
+    WriteArray(geo, y);
+    WriteArray(geo, z);
+    WriteString(geo, "hexa8");
+    WriteInt(geo, Dimension * Dimension * Dimension);
+    WriteArray(geo, connectivity);
+    WriteString(geo, "END TIME STEP");
+
+    WriteString(var, "BEGIN TIME STEP");
+    WriteString(var, "pressure");
+    WriteString(var, "part");
+    WriteInt(var, 1);
+    WriteString(var, "coordinates");
+    WriteArray(var, pressure);
+    WriteString(var, "END TIME STEP");
+  }
+  geo.close();
+  var.close();
+
+  vtksys::ofstream caseFile((dir + "/index.case").c_str(), ios::out);
+  caseFile << "FORMAT\n"
+           << "type: ensight gold\n\n"
+           << "GEOMETRY\n"
+           << "model: 1 1 index.geo\n\n"
+           << "VARIABLE\n"
+           << "scalar per node: 1 1 pressure index.pressure\n\n"
+           << "TIME\n"
+           << "time set: 1\n"
+           << "number of steps: " << NumberOfSteps << "\n"
+           << "time values:";
+  for (int step = 0; step < NumberOfSteps; ++step)
+  {
+    caseFile << " " << step;
+  }
+  caseFile << "\n\n"
+           << "FILE\n"
+           << "file set: 1\n"
+           << "number of steps: " << NumberOfSteps << "\n";
+  caseFile.close();
+  return !geo.fail() && !var.fail() && !caseFile.fail();
+}
+
+void Setup(vtkPEnSightGoldBinaryReader* reader, const std::string& dir, bool index, bool persist)
+{
+  reader->SetFilePath(dir.c_str());
+  reader->SetCaseFileName("index.case");
+  reader->SetByteOrder(vtkPEnSightGoldBinaryReader::FILE_UNKNOWN_ENDIAN);
+  reader->SetUseTimeStepIndex(index);
+  reader->SetPersistTimeStepIndex(persist);
+  reader->UpdateInformation();
+}
+
+// Checks the time step read by the reader is `step`.
+bool Check(vtkPEnSightGoldBinaryReader* reader, int step, const char* name)
+{
+  reader->UpdateTimeStep(step);
+  vtkUnstructuredGrid* grid =
+    vtkUnstructuredGrid::SafeDownCast(reader->GetOutput()->GetBlock(0));
+  vtkDataArray* pressure = grid ? grid->GetPointData()->GetArray("pressure") : nullptr;
+  if (!pressure || grid->GetNumberOfCells() != Dimension * Dimension * Dimension)
+  {
+    cerr << "ERROR: " << name << " did not read time step " << step << endl;
+    return false;
+  }
+  for (vtkIdType id = 0; id < grid->GetNumberOfPoints(); ++id)
+  {
+    if (grid->GetPoint(id)[0] != (id % (Dimension + 1)) + step ||
+      pressure->GetTuple1(id) != 1000 * step + id)
+    {
+      cerr << "ERROR: " << name << " read wrong values for time step " << step << endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+// Rewrites the persisted index of a file with the same header but the offsets
+// of all the time steps but the first one moved, as if the file had been
+// rewritten with other time steps of the same total size within the same
+// second.
+bool MakeIndexStale(const std::string& indexFileName)
+{
+  vtksys::ifstream in(indexFileName.c_str(), ios::in);
+  std::string header, stamp;
+  std::vector<long> offsets;
+  long offset;
+  if (!std::getline(in, header) || !std::getline(in, stamp))
+  {
+    return false;
+  }
+  while (in >> offset)
+  {
+    offsets.push_back(offset);
+  }
+  in.close();
+  if (static_cast<int>(offsets.size()) != NumberOfSteps)
+  {
+    return false;
+  }
+
+  vtksys::ofstream out(indexFileName.c_str(), ios::out);
+  out << header << "\n" << stamp << "\n" << offsets[0] << "\n";
+  for (size_t step = 1; step < offsets.size(); ++step)
+  {
+    out << offsets[step] + 80 << "\n";
+  }
+  out.close();
+  return !out.fail();
+}
+}
+
+int TestPEnSightGoldBinaryReaderTimeStepIndex(int argc, char* argv[])
+{
+  char* tempDir =
+    vtkTestUtilities::GetArgOrEnvOrDefault("-T", argc, argv, "VTK_TEMP_DIR", "Testing/Temporary");
+  if (!tempDir)
+  {
+    cerr << "Could not determine temporary directory." << endl;
+    return EXIT_FAILURE;
+  }
+  std::string dir = tempDir;
+  delete[] tempDir;
+
+  if (!WriteCase(dir))
+  {
+    cerr << "ERROR: could not write the case in " << dir << endl;
+    return EXIT_FAILURE;
+  }
+  vtksys::SystemTools::RemoveFile(dir + "/index.geo.index");
+  vtksys::SystemTools::RemoveFile(dir + "/index.pressure.index");
+
+  const int steps[] = { 2, 0, 3, 1, 3 };
+  vtkNew<vtkPEnSightGoldBinaryReader> scanning;
+  Setup(scanning, dir, false, false);
+  vtkNew<vtkPEnSightGoldBinaryReader> indexing;
+  Setup(indexing, dir, true, true);
+  for (int step : steps)
+  {
+    if (!Check(scanning, step, "Scanning reader") || !Check(indexing, step, "Indexing reader"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (!vtksys::SystemTools::FileExists(dir + "/index.geo.index") ||
+    !vtksys::SystemTools::FileExists(dir + "/index.pressure.index"))
+  {
+    cerr << "ERROR: the time step indices were not persisted." << endl;
+    return EXIT_FAILURE;
+  }
+
+  // Without persistence, the file is only scanned up to the requested time
+  // step.
+  vtkNew<vtkIndexingReader> lazy;
+  Setup(lazy, dir, true, false);
+  if (!Check(lazy, 1, "Lazy index reader") ||
+    lazy->GetNumberOfKnownTimeSteps("index.pressure") != 2 ||
+    !Check(lazy, 3, "Lazy index reader") ||
+    lazy->GetNumberOfKnownTimeSteps("index.pressure") != NumberOfSteps ||
+    !Check(lazy, 2, "Lazy index reader"))
+  {
+    cerr << "ERROR: the time step index was not built lazily." << endl;
+    return EXIT_FAILURE;
+  }
+
+  vtkNew<vtkPEnSightGoldBinaryReader> persisted;
+  Setup(persisted, dir, true, true);
+  for (int step : steps)
+  {
+    if (!Check(persisted, step, "Persisted index reader"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+
+  if (!MakeIndexStale(dir + "/index.pressure.index"))
+  {
+    cerr << "ERROR: could not rewrite the persisted time step index." << endl;
+    return EXIT_FAILURE;
+  }
+  vtkNew<vtkPEnSightGoldBinaryReader> stale;
+  Setup(stale, dir, true, true);
+  for (int step : steps)
+  {
+    if (!Check(stale, step, "Stale index reader"))
+    {
+      return EXIT_FAILURE;
+    }
+  }
+  return EXIT_SUCCESS;
+}
@@ -18,14 +18,299 @@
 #include "vtksys/FStream.hxx"
 #include "vtksys/SystemTools.hxx"
 
+#include <algorithm>
 #include <ctype.h>
+#include <cstring>
+#include <streambuf>
 #include <string>
+#include <vector>
+
+#ifdef _WIN32
+#include "vtkWindows.h"
+#include "vtksys/Encoding.hxx"
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
 
 vtkStandardNewMacro(vtkPEnSightGoldBinaryReader);
 
 // This is half the precision of an int.
 #define MAXIMUM_PART_ID 65536
 
+namespace
+{
+//----------------------------------------------------------------------------
+// Read-only stream buffer over a file mapped in memory. The whole file is the
+// get area, so reads are plain memory copies and seeks only move the get
+// pointer.
+class vtkPEnSightMappedFileBuffer : public std::streambuf
+{
+public:
+  vtkPEnSightMappedFileBuffer() = default;
+  ~vtkPEnSightMappedFileBuffer() override { this->Close(); }
+
+  bool Open(const char* filename)
+  {
+    this->Close();
+#ifdef _WIN32
+    HANDLE file = CreateFileW(vtksys::Encoding::ToWide(filename).c_str(), GENERIC_READ,
+      FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+    if (file == INVALID_HANDLE_VALUE)
+    {
+      return false;
+    }
+    LARGE_INTEGER size;
+    if (!GetFileSizeEx(file, &size) || size.QuadPart == 0)
+    {
+      CloseHandle(file);
+      return false;
+    }
+    HANDLE mapping = CreateFileMappingW(file, NULL, PAGE_READONLY, 0, 0, NULL);
+    CloseHandle(file);
+    if (!mapping)
+    {
+      return false;
+    }
+    void* data = MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0);
+    CloseHandle(mapping);
+    if (!data)
+    {
+      return false;
+    }
+    this->Size = static_cast<size_t>(size.QuadPart);
+#else
+    int fd = open(filename, O_RDONLY);
+    if (fd < 0)
+    {
+      return false;
+    }
+    struct stat fs;
+    if (fstat(fd, &fs) != 0 || fs.st_size <= 0)
+    {
+      close(fd);
+      return false;
+    }
+    void* data = mmap(NULL, static_cast<size_t>(fs.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (data == MAP_FAILED)
+    {
+      return false;
+    }
+    this->Size = static_cast<size_t>(fs.st_size);
+#endif
+    this->Data = static_cast<char*>(data);
+    this->setg(this->Data, this->Data, this->Data + this->Size);
+    return true;
+  }
+
+  void Close()
+  {
+    if (this->Data)
+    {
+#ifdef _WIN32
+      UnmapViewOfFile(this->Data);
+#else
+      munmap(this->Data, this->Size);
+#endif
+    }
+    this->Data = nullptr;
+    this->Size = 0;
+    this->setg(nullptr, nullptr, nullptr);
+  }
+
+protected:
+  std::streamsize xsgetn(char* s, std::streamsize n) override
+  {
+    std::streamsize count = static_cast<std::streamsize>(this->egptr() - this->gptr());
+    if (n < count)
+    {
+      count = n;
+    }
+    if (count > 0)
+    {
+      memcpy(s, this->gptr(), static_cast<size_t>(count));
+      // gbump takes an int, which may be too small for large blocks.
+      this->setg(this->eback(), this->gptr() + count, this->egptr());
+    }
+    return count;
+  }
+
+  pos_type seekoff(
+    off_type off, std::ios_base::seekdir dir, std::ios_base::openmode which) override
+  {
+    if (!(which & std::ios_base::in) || !this->Data)
+    {
+      return pos_type(off_type(-1));
+    }
+    off_type position = off;
+    if (dir == std::ios_base::cur)
+    {
+      position += this->gptr() - this->eback();
+    }
+    else if (dir == std::ios_base::end)
+    {
+      position += static_cast<off_type>(this->Size);
+    }
+    if (position < 0 || position > static_cast<off_type>(this->Size))
+    {
+      return pos_type(off_type(-1));
+    }
+    this->setg(this->eback(), this->eback() + position, this->egptr());
+    return pos_type(position);
+  }
+
+  pos_type seekpos(pos_type pos, std::ios_base::openmode which) override
+  {
+    return this->seekoff(off_type(pos), std::ios_base::beg, which);
+  }
+
+private:
+  vtkPEnSightMappedFileBuffer(const vtkPEnSightMappedFileBuffer&) = delete;
+  void operator=(const vtkPEnSightMappedFileBuffer&) = delete;
+
+  char* Data = nullptr;
+  size_t Size = 0;
+};
+
+//----------------------------------------------------------------------------
+// Input stream owning a vtkPEnSightMappedFileBuffer, so that it can be used
+// and deleted like the vtksys::ifstream it replaces.
+class vtkPEnSightMappedFileStream : public std::istream
+{
+public:
+  vtkPEnSightMappedFileStream()
+    : std::istream(nullptr)
+  {
+    this->rdbuf(&this->Buffer);
+  }
+
+  bool Open(const char* filename)
+  {
+    if (!this->Buffer.Open(filename))
+    {
+      this->setstate(std::ios_base::failbit);
+      return false;
+    }
+    this->clear();
+    return true;
+  }
+
+private:
+  vtkPEnSightMappedFileBuffer Buffer;
+};
+
+//----------------------------------------------------------------------------
+// Whether the 80 characters record starts with "BEGIN TIME STEP" and its
+// remaining characters, up to the first null one, are printable.
+bool vtkPEnSightIsTimeStepRecord(const char* record)
+{
+  const char marker[] = "BEGIN TIME STEP";
+  const size_t markerLength = 15;
+  const size_t recordLength = 80;
+  if (memcmp(record, marker, markerLength) != 0)
+  {
+    return false;
+  }
+  size_t cc = markerLength;
+  while (cc < recordLength && record[cc] != '\0' &&
+    isprint(static_cast<unsigned char>(record[cc])))
+  {
+    ++cc;
+  }
+  return cc == recordLength || record[cc] == '\0';
+}
+
+//----------------------------------------------------------------------------
+// Returns the offsets of the "BEGIN TIME STEP" records of a file holding
+// several time steps, in order, starting the search at `start` and stopping
+// after `maxSteps` records unless it is 0. The file is read in large chunks,
+// looking for 80 characters time step records.
+std::vector<long> vtkPEnSightScanTimeSteps(
+  istream* file, bool fortran, long start, size_t maxSteps)
+{
+  const size_t recordLength = 80;
+  const size_t chunkLength = 1 << 20;
+
+  std::vector<long> offsets;
+  std::vector<char> buffer(chunkLength + recordLength);
+  const long initialPosition = file->tellg();
+  file->seekg(start, ios::beg);
+
+  // Offset in the file of the first character of the buffer, of the first
+  // character not yet searched, and number of characters kept from the
+  // previous chunk.
+  long bufferOffset = start;
+  long searchOffset = start;
+  size_t kept = 0;
+  bool done = false;
+  while (!done)
+  {
+    file->read(&buffer[kept], chunkLength);
+    done = !file->good();
+    const size_t length = kept + static_cast<size_t>(file->gcount());
+    if (length < recordLength)
+    {
+      break;
+    }
+
+    // Only the records entirely in the buffer are searched.
+    const size_t end = length - recordLength + 1;
+    for (size_t pos = static_cast<size_t>(searchOffset - bufferOffset); pos < end; ++pos)
+    {
+      const char* candidate = static_cast<const char*>(memchr(&buffer[pos], 'B', end - pos));
+      if (!candidate)
+      {
+        break;
+      }
+      pos = candidate - &buffer[0];
+      if (!vtkPEnSightIsTimeStepRecord(candidate))
+      {
+        continue;
+      }
+      // Fortran records start with their length.
+      offsets.push_back(bufferOffset + static_cast<long>(pos) - (fortran ? 4 : 0));
+      searchOffset = bufferOffset + static_cast<long>(pos + recordLength);
+      pos += recordLength - 1;
+      if (offsets.size() == maxSteps)
+      {
+        done = true;
+        break;
+      }
+    }
+
+    searchOffset = std::max(searchOffset, bufferOffset + static_cast<long>(end));
+    kept = length - end;
+    memmove(&buffer[0], &buffer[end], kept);
+    bufferOffset += static_cast<long>(end);
+  }
+
+  file->clear();
+  file->seekg(initialPosition, ios::beg);
+  return offsets;
+}
+
+//----------------------------------------------------------------------------
+// Whether each of the offsets is the one of a "BEGIN TIME STEP" record of the
+// file.
+bool vtkPEnSightCheckTimeSteps(istream* file, bool fortran, const std::vector<long>& offsets)
+{
+  const long initialPosition = file->tellg();
+  char record[80];
+  bool valid = true;
+  for (size_t step = 0; valid && step < offsets.size(); ++step)
+  {
+    file->seekg(offsets[step] + (fortran ? 4 : 0), ios::beg);
+    valid = file->read(record, sizeof(record)) && vtkPEnSightIsTimeStepRecord(record);
+  }
+  file->clear();
+  file->seekg(initialPosition, ios::beg);
+  return valid;
+}
+}
+
 //----------------------------------------------------------------------------
 vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
 {
@@ -34,6 +319,9 @@ vtkPEnSightGoldBinaryReader::vtkPEnSightGoldBinaryReader()
   this->Fortran = 0;
   this->NodeIdsListed = 0;
   this->ElementIdsListed = 0;
+  this->UseMemoryMapping = true;
+  this->UseTimeStepIndex = true;
+  this->PersistTimeStepIndex = false;
 
   this->FloatBufferSize = 1000;
 
@@ -77,11 +365,27 @@ int vtkPEnSightGoldBinaryReader::OpenFile(const char* filename)
     // Find out how big the file is.
     this->FileSize = (long)(fs.st_size);
 
+    if (this->UseMemoryMapping)
+    {
+      vtkPEnSightMappedFileStream* mappedFile = new vtkPEnSightMappedFileStream;
+      if (mappedFile->Open(filename))
+      {
+        this->IFile = mappedFile;
+      }
+      else
+      {
+        vtkDebugMacro(<< "Could not map " << filename << " in memory, reading it as a stream.");
+        delete mappedFile;
+      }
+    }
+    if (!this->IFile)
+    {
 #ifdef _WIN32
-    this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
+      this->IFile = new vtksys::ifstream(filename, ios::in | ios::binary);
 #else
-    this->IFile = new vtksys::ifstream(filename, ios::in);
+      this->IFile = new vtksys::ifstream(filename, ios::in);
 #endif
+    }
   }
   else
   {
@@ -227,6 +531,7 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
   {
     return 0;
   }
+  line[0] = '\0';
 
   /* Disable this. This is too slow on big files and the CASE file
    * is supposed to be correct anyway...
@@ -241,6 +546,7 @@ int vtkPEnSightGoldBinaryReader::ReadGeometryFile(
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     int j = 0;
     // Try to find the nearest time step for which we know the offset
@@ -1074,7 +1380,6 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
   char line[80], subLine[80];
   vtkIdType i;
   int* pointIds;
-  float *xCoords, *yCoords, *zCoords;
   vtkPoints* points = vtkPoints::New();
   vtkPolyData* pd = vtkPolyData::New();
 
@@ -1120,6 +1425,7 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     int k, j = 0;
     // Try to find the nearest time step for which we know the offset
@@ -1200,9 +1506,7 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
     partId, dimensions, newDimensions, &splitDimension, &splitDimensionBeginIndex, 0, NULL, NULL);
 
   pointIds = new int[this->NumberOfMeasuredPoints];
-  xCoords = new float[this->NumberOfMeasuredPoints];
-  yCoords = new float[this->NumberOfMeasuredPoints];
-  zCoords = new float[this->NumberOfMeasuredPoints];
+  std::vector<float> coords(3 * static_cast<size_t>(this->NumberOfMeasuredPoints));
 
   points->Allocate(this->GetPointIds(partId)->GetLocalNumberOfIds());
   pd->Allocate(this->GetPointIds(partId)->GetLocalNumberOfIds());
@@ -1217,26 +1521,19 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
   this->ReadIntArray(pointIds, this->NumberOfMeasuredPoints);
 
   // Read point coordinates tuple by tuple while each tuple contains three
-  // components: (x-cord, y-cord, z-cord)
-  int floatSize = sizeof(float);
-  for (i = 0; i < this->NumberOfMeasuredPoints; i++)
+  // components: (x-cord, y-cord, z-cord). All tuples are read at once.
+  if (this->NumberOfMeasuredPoints > 0)
   {
-    this->IFile->read((char*)(xCoords + i), floatSize);
-    this->IFile->read((char*)(yCoords + i), floatSize);
-    this->IFile->read((char*)(zCoords + i), floatSize);
+    this->IFile->read(reinterpret_cast<char*>(coords.data()), sizeof(float) * coords.size());
   }
 
   if (this->ByteOrder == FILE_LITTLE_ENDIAN)
   {
-    vtkByteSwap::Swap4LERange(xCoords, this->NumberOfMeasuredPoints);
-    vtkByteSwap::Swap4LERange(yCoords, this->NumberOfMeasuredPoints);
-    vtkByteSwap::Swap4LERange(zCoords, this->NumberOfMeasuredPoints);
+    vtkByteSwap::Swap4LERange(coords.data(), coords.size());
   }
   else
   {
-    vtkByteSwap::Swap4BERange(xCoords, this->NumberOfMeasuredPoints);
-    vtkByteSwap::Swap4BERange(yCoords, this->NumberOfMeasuredPoints);
-    vtkByteSwap::Swap4BERange(zCoords, this->NumberOfMeasuredPoints);
+    vtkByteSwap::Swap4BERange(coords.data(), coords.size());
   }
 
   for (i = 0; i < this->NumberOfMeasuredPoints; i++)
@@ -1245,7 +1542,7 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
     if (realId != -1)
     {
       vtkIdType tempId = realId;
-      points->InsertNextPoint(xCoords[i], yCoords[i], zCoords[i]);
+      points->InsertNextPoint(coords[3 * i], coords[3 * i + 1], coords[3 * i + 2]);
       pd->InsertNextCell(VTK_VERTEX, 1, &tempId);
     }
   }
@@ -1256,9 +1553,6 @@ int vtkPEnSightGoldBinaryReader::ReadMeasuredGeometryFile(
   points->Delete();
   pd->Delete();
   delete[] pointIds;
-  delete[] xCoords;
-  delete[] yCoords;
-  delete[] zCoords;
   delete this->IFile;
   this->IFile = NULL;
 
@@ -1307,6 +1601,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerNode(const char* fileName, const
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
@@ -1524,6 +1819,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerNode(const char* fileName, const
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
@@ -1729,6 +2025,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerNode(const char* fileName, const
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     int j = 0;
     // Try to find the nearest time step for which we know the offset
@@ -1889,6 +2186,7 @@ int vtkPEnSightGoldBinaryReader::ReadScalarsPerElement(const char* fileName,
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
@@ -2135,6 +2433,7 @@ int vtkPEnSightGoldBinaryReader::ReadVectorsPerElement(const char* fileName,
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
@@ -2381,6 +2680,7 @@ int vtkPEnSightGoldBinaryReader::ReadTensorsPerElement(const char* fileName,
 
   if (this->UseFileSets)
   {
+    this->BuildTimeStepIndex(fileName, timeStep);
     int realTimeStep = timeStep - 1;
     // Try to find the nearest time step for which we know the offset
     int j = 0;
@@ -4514,8 +4814,181 @@ void vtkPEnSightGoldBinaryReader::UpdateFloatBuffer()
   this->IFile->seekg(currentPosition);
 }
 
+//----------------------------------------------------------------------------
+void vtkPEnSightGoldBinaryReader::BuildTimeStepIndex(const char* fileName, int timeStep)
+{
+  // Nothing to do for the first time step, which starts the file, nor for time
+  // steps whose offset is already known.
+  const int realTimeStep = timeStep - 1;
+  std::map<int, long>& fileOffsets = this->FileOffsets[fileName];
+  if (!this->UseTimeStepIndex || !this->IFile || realTimeStep <= 0 ||
+    fileOffsets.find(realTimeStep) != fileOffsets.end() ||
+    this->IndexedFileNames.find(fileName) != this->IndexedFileNames.end())
+  {
+    return;
+  }
+
+  std::string sfilename;
+  if (this->FilePath)
+  {
+    sfilename = this->FilePath;
+    if (sfilename.at(sfilename.length() - 1) != '/')
+    {
+      sfilename += "/";
+    }
+    sfilename += fileName;
+  }
+  else
+  {
+    sfilename = fileName;
+  }
+
+  if (this->PersistTimeStepIndex)
+  {
+    // A persisted index holds all the time steps of the file.
+    std::vector<long> offsets;
+    if (!this->ReadTimeStepIndex(sfilename, offsets))
+    {
+      offsets = vtkPEnSightScanTimeSteps(this->IFile, this->Fortran != 0, 0, 0);
+      // Only one process writes the index of a file read by all of them.
+      if (!offsets.empty() && this->GetMultiProcessLocalProcessId() <= 0 &&
+        !this->WriteTimeStepIndex(sfilename, offsets))
+      {
+        vtkDebugMacro(<< "Could not write the time step index of " << sfilename);
+      }
+    }
+    vtkDebugMacro(<< "Indexed " << offsets.size() << " time steps in " << sfilename);
+    for (size_t step = 0; step < offsets.size(); ++step)
+    {
+      fileOffsets[static_cast<int>(step)] = offsets[step];
+    }
+    this->IndexedFileNames.insert(fileName);
+    return;
+  }
+
+  // Otherwise only the time steps between the last known one before the
+  // requested time step and the requested one are scanned, past the
+  // "BEGIN TIME STEP" record of the known one.
+  int knownStep = -1;
+  long start = 0;
+  auto known = fileOffsets.lower_bound(realTimeStep);
+  if (known != fileOffsets.begin())
+  {
+    --known;
+    knownStep = known->first;
+    start = known->second + (this->Fortran ? 4 : 0) + 80;
+  }
+  const size_t numberOfSteps = static_cast<size_t>(realTimeStep - knownStep);
+  const std::vector<long> offsets =
+    vtkPEnSightScanTimeSteps(this->IFile, this->Fortran != 0, start, numberOfSteps);
+  vtkDebugMacro(<< "Indexed time steps " << knownStep + 1 << " to "
+                << knownStep + static_cast<int>(offsets.size()) << " in " << sfilename);
+  for (size_t cc = 0; cc < offsets.size(); ++cc)
+  {
+    fileOffsets[knownStep + 1 + static_cast<int>(cc)] = offsets[cc];
+  }
+  if (offsets.size() < numberOfSteps)
+  {
+    // The end of the file was reached, all its time steps are known.
+    this->IndexedFileNames.insert(fileName);
+  }
+}
+
+//----------------------------------------------------------------------------
+bool vtkPEnSightGoldBinaryReader::ReadTimeStepIndex(
+  const std::string& fileName, std::vector<long>& offsets)
+{
+  vtksys::SystemTools::Stat_t fs;
+  if (vtksys::SystemTools::Stat(fileName.c_str(), &fs) != 0)
+  {
+    return false;
+  }
+
+  vtksys::ifstream index((fileName + ".index").c_str(), ios::in);
+  std::string header;
+  long long size, modifiedTime;
+  size_t numberOfSteps;
+  if (!std::getline(index, header) || header != "EnSight Gold time step index 1" ||
+    !(index >> size >> modifiedTime >> numberOfSteps) ||
+    size != static_cast<long long>(fs.st_size) ||
+    modifiedTime != static_cast<long long>(fs.st_mtime))
+  {
+    return false;
+  }
+
+  offsets.resize(numberOfSteps);
+  for (size_t step = 0; step < numberOfSteps; ++step)
+  {
+    if (!(index >> offsets[step]) || offsets[step] < 0 || offsets[step] >= size)
+    {
+      offsets.clear();
+      return false;
+    }
+  }
+
+  // The size and the modification time, in whole seconds, do not tell a file
+  // rewritten with different time steps within the same second, so the index
+  // must also match the time steps of the opened file: the first one found in
+  // the file and a record at each indexed offset.
+  const bool fortran = this->Fortran != 0;
+  const std::vector<long> first = vtkPEnSightScanTimeSteps(this->IFile, fortran, 0, 1);
+  if (numberOfSteps == 0 || first.empty() || first[0] != offsets[0] ||
+    !vtkPEnSightCheckTimeSteps(this->IFile, fortran, offsets))
+  {
+    vtkDebugMacro(<< "Ignoring the stale time step index of " << fileName);
+    offsets.clear();
+    return false;
+  }
+  return true;
+}
+
+//----------------------------------------------------------------------------
+bool vtkPEnSightGoldBinaryReader::WriteTimeStepIndex(
+  const std::string& fileName, const std::vector<long>& offsets)
+{
+  vtksys::SystemTools::Stat_t fs;
+  if (vtksys::SystemTools::Stat(fileName.c_str(), &fs) != 0)
+  {
+    return false;
+  }
+
+  // The index is written aside and then renamed so that readers never see a
+  // partial index. The temporary file is named after the process so that
+  // processes sharing the file, such as several ParaView sessions, never write
+  // the same one.
+#ifdef _WIN32
+  const unsigned long pid = static_cast<unsigned long>(GetCurrentProcessId());
+#else
+  const unsigned long pid = static_cast<unsigned long>(getpid());
+#endif
+  const std::string indexFileName = fileName + ".index";
+  const std::string tempFileName = indexFileName + "." + std::to_string(pid) + ".tmp";
+  vtksys::ofstream index(tempFileName.c_str(), ios::out);
+  if (!index)
+  {
+    return false;
+  }
+  index << "EnSight Gold time step index 1\n"
+        << static_cast<long long>(fs.st_size) << " " << static_cast<long long>(fs.st_mtime)
+        << " " << offsets.size() << "\n";
+  for (size_t step = 0; step < offsets.size(); ++step)
+  {
+    index << offsets[step] << "\n";
+  }
+  index.close();
+  if (index.fail() || !vtksys::SystemTools::RenameFile(tempFileName, indexFileName))
+  {
+    vtksys::SystemTools::RemoveFile(tempFileName);
+    return false;
+  }
+  return true;
+}
+
 //----------------------------------------------------------------------------
 void vtkPEnSightGoldBinaryReader::PrintSelf(ostream& os, vtkIndent indent)
 {
   this->Superclass::PrintSelf(os, indent);
+  os << indent << "UseMemoryMapping: " << this->UseMemoryMapping << endl;
+  os << indent << "UseTimeStepIndex: " << this->UseTimeStepIndex << endl;
+  os << indent << "PersistTimeStepIndex: " << this->PersistTimeStepIndex << endl;
 }
@@ -35,6 +35,10 @@
 #include "vtkPEnSightReader.h"
 #include "vtkPVVTKExtensionsIOEnSightModule.h" //needed for exports
 
+#include <set>    // For ivars
+#include <string> // For ivars
+#include <vector> // For ivars
+
 class vtkMultiBlockDataSet;
 class vtkUnstructuredGrid;
 class vtkPoints;
@@ -46,6 +50,45 @@ public:
   vtkTypeMacro(vtkPEnSightGoldBinaryReader, vtkPEnSightReader);
   void PrintSelf(ostream& os, vtkIndent indent) override;
 
+  //@{
+  /**
+   * When on, data files are mapped in memory instead of being read through a
+   * file stream, which turns the many small reads done by this reader into
+   * memory copies. Reading falls back to a file stream when a file cannot be
+   * mapped. Default is on.
+   */
+  vtkSetMacro(UseMemoryMapping, bool);
+  vtkGetMacro(UseMemoryMapping, bool);
+  vtkBooleanMacro(UseMemoryMapping, bool);
+  //@}
+
+  //@{
+  /**
+   * When on, the time steps of a file holding several of them are located by
+   * scanning the file for their "BEGIN TIME STEP" records instead of skipping
+   * the data of all the previous time steps. The scan only goes from the last
+   * time step whose offset is known up to the requested one, and the offsets
+   * found are kept so that these time steps are then a single seek away.
+   * Default is on.
+   */
+  vtkSetMacro(UseTimeStepIndex, bool);
+  vtkGetMacro(UseTimeStepIndex, bool);
+  vtkBooleanMacro(UseTimeStepIndex, bool);
+  //@}
+
+  //@{
+  /**
+   * When on, the first time step index built for a file covers all its time
+   * steps, and is saved beside it, in a file named after it with the ".index"
+   * extension appended, and loaded back instead of scanning the file again as
+   * long as the file is unchanged. Only the first process writes the index.
+   * Default is off.
+   */
+  vtkSetMacro(PersistTimeStepIndex, bool);
+  vtkGetMacro(PersistTimeStepIndex, bool);
+  vtkBooleanMacro(PersistTimeStepIndex, bool);
+  //@}
+
 protected:
   vtkPEnSightGoldBinaryReader();
   ~vtkPEnSightGoldBinaryReader() override;
@@ -200,9 +243,32 @@ protected:
   int SkipImageData(char line[256]);
   //@}
 
+  /**
+   * Makes sure FileOffsets holds the offset of the requested time step of the
+   * opened file when it is past the known offsets, by scanning the file from
+   * the last known time step, or by loading or building the persisted index of
+   * all the time steps. Does nothing when UseTimeStepIndex is off.
+   */
+  void BuildTimeStepIndex(const char* fileName, int timeStep);
+
+  //@{
+  /**
+   * Read or write the persisted time step index of a file. Reading fails when
+   * the file changed since the index was written, or when the indexed offsets
+   * are not the ones of the time steps of the opened file.
+   */
+  bool ReadTimeStepIndex(const std::string& fileName, std::vector<long>& offsets);
+  bool WriteTimeStepIndex(const std::string& fileName, const std::vector<long>& offsets);
+  //@}
+
   int NodeIdsListed;
   int ElementIdsListed;
   int Fortran;
+  bool UseMemoryMapping;
+  bool UseTimeStepIndex;
+  bool PersistTimeStepIndex;
+  // Files whose time steps are all in FileOffsets.
+  std::set<std::string> IndexedFileNames;
 
   istream* IFile;
   // The size of the file could be used to choose byte order.
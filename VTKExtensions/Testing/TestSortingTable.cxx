@@ -25,6 +25,7 @@
 #include "vtkUnsignedCharArray.h"
 
 #include <float.h>
+#include <vector>
 // ----------------------------------------------------------------------------
 void fillArray(vtkDoubleArray* array, double* dataPointer, int dataSize, const char* name)
 {
@@ -164,6 +165,72 @@ int sortMagnitudeOnUnsignedCharVector()
   return EXIT_SUCCESS;
 }
 
+// ----------------------------------------------------------------------------
+// Page through all the blocks of a table with many equal values and make sure
+// that, put together, they hold every row once and in order.
+int sortPagedBlocks(bool invertOrder, bool debug)
+{
+  const int size = 5000;
+  const int blockSize = 64;
+  vtkSmartPointer<vtkDoubleArray> dataToSort = vtkSmartPointer<vtkDoubleArray>::New();
+  vtkSmartPointer<vtkDoubleArray> ids = vtkSmartPointer<vtkDoubleArray>::New();
+  std::vector<double> values(size);
+  std::vector<double> rowIds(size);
+  for (int i = 0; i < size; i++)
+  {
+    values[i] = (i * 7919) % 97;
+    rowIds[i] = i;
+  }
+  fillArray(dataToSort.GetPointer(), &values[0], size, "data");
+  fillArray(ids.GetPointer(), &rowIds[0], size, "ids");
+
+  vtkSmartPointer<vtkTable> input = vtkSmartPointer<vtkTable>::New();
+  input->AddColumn(dataToSort);
+  input->AddColumn(ids);
+  vtkSmartPointer<vtkSortedTableStreamer> sortingfilter =
+    vtkSmartPointer<vtkSortedTableStreamer>::New();
+
+  sortingfilter->SetInputData(input.GetPointer());
+  sortingfilter->SetSelectedComponent(0);
+  sortingfilter->SetColumnNameToSort("data");
+  sortingfilter->SetInvertOrder(invertOrder ? 1 : 0);
+  sortingfilter->SetBlockSize(blockSize);
+
+  std::vector<bool> seen(size, false);
+  double previous = invertOrder ? VTK_DOUBLE_MAX : -VTK_DOUBLE_MAX;
+  int count = 0;
+  for (int block = 0; block * blockSize < size; block++)
+  {
+    sortingfilter->SetBlock(block);
+    sortingfilter->Update();
+    vtkTable* output = sortingfilter->GetOutput();
+    vtkDoubleArray* sorted = vtkDoubleArray::SafeDownCast(output->GetColumnByName("data"));
+    vtkDoubleArray* sortedIds = vtkDoubleArray::SafeDownCast(output->GetColumnByName("ids"));
+    if (!sorted || !sortedIds)
+    {
+      return EXIT_FAILURE;
+    }
+    for (vtkIdType i = 0; i < sorted->GetNumberOfTuples(); i++, count++)
+    {
+      const double value = sorted->GetValue(i);
+      const int id = static_cast<int>(sortedIds->GetValue(i));
+      if (debug)
+      {
+        cout << "Block " << block << " value " << value << " id " << id << endl;
+      }
+      if ((invertOrder ? value > previous : value < previous) || id < 0 || id >= size ||
+        seen[id] || values[id] != value)
+      {
+        return EXIT_FAILURE;
+      }
+      seen[id] = true;
+      previous = value;
+    }
+  }
+
+  return count == size ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
 // ----------------------------------------------------------------------------
 int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
 {
@@ -183,6 +250,12 @@ int TestSortingTable(int vtkNotUsed(argc), char** vtkNotUsed(argv))
   cout << "Testing sorting with magnitude on unsigned char: "
        << ((result += sortMagnitudeOnUnsignedCharVector()) ? "FAILED" : "SUCCESS") << endl;
   // --------------------------------------------------------------------------
+  cout << "Testing paging through sorted blocks: "
+       << ((result += sortPagedBlocks(false, debug)) ? "FAILED" : "SUCCESS") << endl;
+  // --------------------------------------------------------------------------
+  cout << "Testing paging through sorted blocks in inverted order: "
+       << ((result += sortPagedBlocks(true, debug)) ? "FAILED" : "SUCCESS") << endl;
+  // --------------------------------------------------------------------------
   // --------------------------------------------------------------------------
 
   // Delete Fake MPI controller
@@ -0,0 +1,189 @@
+r"""Module for saving an animation as a series of images using several
+independent batch processes.
+
+`SaveAnimationInParallel` splits the frame window of the animation into
+disjoint, contiguous chunks, one per worker. Each worker is a separate
+``pvbatch`` process that loads the same state file and saves its chunk using
+:func:`paraview.simple.SaveAnimation`. Since images are named after the index
+of their frame in the animation, the images written by all the workers make up
+the same series a single call to `SaveAnimation` would produce. Typical usage
+of this module is as follows::
+
+    from paraview.simple import *
+    from paraview import parallelanimation
+
+    LoadState("state.pvsm")
+    parallelanimation.SaveAnimationInParallel("/tmp/frames.png",
+        numberOfWorkers=16, ImageResolution=[1920, 1080])
+
+Movie formats are not supported since a single stream cannot be written by
+several processes.
+
+This module is also the script run by the workers::
+
+    pvbatch parallelanimation.py --state <state.pvsm> --frame-window <first> <last>
+        [--save-all-views] [--params <json>] <filename>
+"""
+
+from __future__ import absolute_import, division, print_function
+
+import json
+import os
+import shutil
+import subprocess
+import sys
+import tempfile
+
+# extensions of the image series formats supported by SaveAnimation.
+_IMAGE_EXTENSIONS = (".png", ".jpg", ".jpeg", ".tif", ".tiff", ".bmp", ".ppm")
+
+def _GetWorkerExecutable():
+    """Returns the pvbatch executable installed next to the current one."""
+    from paraview import servermanager
+    selfDir = servermanager.vtkProcessModule.GetProcessModule().GetSelfDir()
+    name = "pvbatch.exe" if sys.platform == "win32" else "pvbatch"
+    return os.path.join(selfDir, name)
+
+def _GetWorkerScript():
+    script = os.path.abspath(__file__)
+    if script.endswith(".pyc"):
+        script = script[:-1]
+    return script
+
+def _GetFrameWindow(scene, frameRate=None):
+    """Returns the frame window of the whole animation, as determined by the
+    vtkSMAnimationFrameWindowDomain of the SaveAnimation proxy."""
+    from paraview import servermanager
+    controller = servermanager.ParaViewPipelineController()
+    options = servermanager.misc.SaveAnimation()
+    controller.PreInitializeProxy(options)
+    options.AnimationScene = scene
+    if frameRate is not None:
+        options.FrameRate = frameRate
+    controller.PostInitializeProxy(options)
+    return [options.FrameWindow[0], options.FrameWindow[1]]
+
+def SplitFrameWindow(frameWindow, numberOfChunks):
+    """Splits the frame window in at most `numberOfChunks` disjoint contiguous
+    windows of nearly equal sizes, covering the whole window in order."""
+    first, last = frameWindow
+    numberOfFrames = last - first + 1
+    numberOfChunks = max(1, min(numberOfChunks, numberOfFrames))
+    chunks = []
+    for chunk in range(numberOfChunks):
+        begin = first + (numberOfFrames * chunk) // numberOfChunks
+        end = first + (numberOfFrames * (chunk + 1)) // numberOfChunks - 1
+        chunks.append([begin, end])
+    return chunks
+
+def SaveAnimationInParallel(filename, numberOfWorkers=None, stateFile=None,
+        saveAllViews=False, executable=None, **params):
+    """Save the animation as a series of images, using several independent
+    batch processes each saving a part of the animation.
+
+    **Parameters**
+
+        filename (str)
+          Name of the output file. The extension is used to determine the
+          format and must be one of the image series formats supported by
+          `SaveAnimation`.
+
+        numberOfWorkers (int, optional)
+          Number of processes to use. Defaults to the number of cores.
+
+        stateFile (str, optional)
+          State file loaded by each worker. If None, the state of the current
+          session is saved to a temporary file and used.
+
+        saveAllViews (bool, optional)
+          When True, workers save the layout of the active view instead of
+          the active view only.
+
+        executable (str, optional)
+          Executable used to run the workers. Defaults to the `pvbatch`
+          executable next to the current one.
+
+    **Keyword Parameters (optional)**
+
+        All keyword parameters supported by `SaveAnimation` are passed to the
+        workers. `FrameWindow` defaults to the whole animation of the active
+        scene, which must match the one of the state file.
+
+    Returns True if all the workers succeeded.
+    """
+    from paraview import simple
+
+    extension = os.path.splitext(filename)[1].lower()
+    if extension not in _IMAGE_EXTENSIONS:
+        raise ValueError("Only image series can be saved in parallel, not '%s'." % extension)
+
+    if numberOfWorkers is None:
+        import multiprocessing
+        numberOfWorkers = multiprocessing.cpu_count()
+
+    executable = executable if executable else _GetWorkerExecutable()
+    if not os.path.exists(executable):
+        raise RuntimeError("Cannot find the worker executable '%s'." % executable)
+
+    frameWindow = params.pop("FrameWindow", None)
+    if frameWindow is None:
+        scene = simple.GetAnimationScene()
+        if not scene:
+            raise RuntimeError("Missing animation scene.")
+        frameWindow = _GetFrameWindow(scene, params.get("FrameRate"))
+
+    tempDir = None
+    if stateFile is None:
+        tempDir = tempfile.mkdtemp()
+        stateFile = os.path.join(tempDir, "state.pvsm")
+        simple.SaveState(stateFile)
+
+    try:
+        workers = []
+        for chunk in SplitFrameWindow(frameWindow, numberOfWorkers):
+            args = [executable, _GetWorkerScript(),
+                    "--state", stateFile,
+                    "--frame-window", str(chunk[0]), str(chunk[1]),
+                    "--params", json.dumps(params)]
+            if saveAllViews:
+                args.append("--save-all-views")
+            args.append(filename)
+            workers.append((chunk, subprocess.Popen(args)))
+
+        status = True
+        for chunk, worker in workers:
+            if worker.wait() != 0:
+                print("ERROR: failed to save frames %d to %d." % (chunk[0], chunk[1]),
+                      file=sys.stderr)
+                status = False
+        return status
+    finally:
+        if tempDir:
+            shutil.rmtree(tempDir, ignore_errors=True)
+
+def _SaveChunk(argv):
+    """Entry point of the workers: loads the state and saves a part of the
+    animation."""
+    import argparse
+    parser = argparse.ArgumentParser(description="Save a part of an animation.")
+    parser.add_argument("--state", required=True, help="state file to load")
+    parser.add_argument("--frame-window", nargs=2, type=int, required=True,
+                        help="first and last frames to save")
+    parser.add_argument("--params", default="{}",
+                        help="SaveAnimation keyword parameters, encoded in JSON")
+    parser.add_argument("--save-all-views", action="store_true",
+                        help="save the layout of the active view")
+    parser.add_argument("filename", help="name of the output file")
+    args = parser.parse_args(argv)
+
+    from paraview import simple
+    simple.LoadState(args.state)
+    view = simple.GetActiveView()
+    viewOrLayout = simple.GetLayout(view) if args.save_all_views else view
+
+    params = json.loads(args.params)
+    params["FrameWindow"] = args.frame_window
+    return simple.SaveAnimation(args.filename, viewOrLayout, **params)
+
+if __name__ == "__main__":
+    sys.exit(0 if _SaveChunk(sys.argv[1:]) else 1)